@@ -14,7 +14,7 @@
 #include "types.h"
 
 #define N_CMDT 2 /*!< It defines the number of ways each command can be call (the long and the short name). */
-#define N_CMD 14 /*!< It defines the number of arguments. */
+#define N_CMD 15 /*!< It defines the number of arguments. */
 
 /**
  * @brief It defines the two ways to call a command, by its short name (CMDS) or by its long name (CMDL).
@@ -45,7 +45,8 @@ typedef enum enum_Command
   TURNON,       /*!< Command type is to turn on an object to iluminate space. */
   TURNOFF,      /*!< Command type is to turn off an object so it stops lighting a space. */
   OPEN,         /*!< Command type is to open a link with an object */
-  USE           /*!< Command type is to use an object with the given id */
+  USE,          /*!< Command type is to use an object with the given id */
+  MAP           /*!< Command type is to switch between the map of the current space and the one of its floor */
 } T_Command;
 
 /**
@@ -70,4 +71,41 @@ T_Command command_get_user_input();
  */
 T_Command command_get_file_input(char *command, char *arg);
 
+/**
+ * @brief Gets the name of a command
+ * @author Miguel Soto
+ *
+ * @param cmd command
+ * @param type CMDS for the short name or CMDL for the long one
+ * @return the name of the command ("" if cmd or type are not valid). It must not be modified.
+ */
+const char *command_get_name(T_Command cmd, T_CmdType type);
+
+/**
+ * @brief Finds the command of a name
+ * @author Ignacio Nunez
+ *
+ * Both the short and the long names are accepted, in upper or lower case.
+ * It looks in a perfect hash of the names, so only one name is compared.
+ *
+ * @param name name of the command, without spaces
+ * @return the command, UNKNOWN if no command has that name, or NO_CMD if name is NULL
+ */
+T_Command command_lookup(const char *name);
+
+/**
+ * @brief Interprets a whole command line
+ * @author Miguel Soto
+ *
+ * Same interpretation as command_get_user_input, but the words are taken from
+ * the string line instead of stdin, so it can be used with sockets or files.
+ * The line is not modified and every argument is truncated to MAX_ARG - 1 chars.
+ *
+ * @param line string with the command line (it may end in '\n')
+ * @param arg1 string where the first argument is saved (MAX_ARG chars)
+ * @param arg2 string where the second argument is saved (MAX_ARG chars)
+ * @return the command interpreted, NO_CMD if the line is empty or there was an error
+ */
+T_Command command_get_line_input(const char *line, char *arg1, char *arg2);
+
 #endif
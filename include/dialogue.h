@@ -19,6 +19,8 @@
 #define COMMAND_SIZE 36
 #define EVENT_SIZE 7
 #define ERROR_SIZE 18
+#define DIALOGUE_LOG_SIZE 16  /*!< Messages kept in the scrollback */
+#define DIALOGUE_LOG_LEN 250  /*!< Maximun length of a message kept */
 
 typedef enum _enum_command_dialogue{
     DC_ERROR = 0,               /*!< Error command dialogue*/
@@ -92,6 +94,12 @@ typedef enum _enum_error_dialogue{
 
 }E_Enum;
 
+typedef enum _enum_log_dialogue{
+    DL_COMMAND = 0,             /*!< Message of a command that went well*/
+    DL_ERROR,                   /*!< Message of a command that went wrong*/
+    DL_EVENT                    /*!< Message of an event*/
+}DL_Kind;
+
 typedef struct _Dialogue Dialogue;
 
 /**
@@ -145,7 +153,7 @@ STATUS dialogue_set_command(Dialogue *dialogue, DC_Enum condition, Space *curren
  * @param dialogue pointer to the dialogue
  * @return Pointer to the event dialogue char 
  */
-char *dialogue_get_event(Dialogue *dialogue);
+const char *dialogue_get_event(Dialogue *dialogue);
  
 /**
  * @brief Sets the dialogue information after executing an event
@@ -174,5 +182,37 @@ char *dialogue_get_error(Dialogue *dialogue);
  */
 STATUS dialogue_set_error(Dialogue *dialogue, E_Enum condition, Space *current_loc, Object *obj, Enemy *enemy);
 
+/**
+ * @brief Keeps the messages of the turn in the scrollback
+ * @author Ignacio Nunez
+ *
+ * The error, or the command if there was no error, and the event if
+ * something happened. The scrollback has DIALOGUE_LOG_SIZE slots, so the
+ * oldest messages are overwritten and nothing is allocated.
+ * @param dialogue pointer to the dialogue
+ * @return ERROR if something went wrong
+ */
+STATUS dialogue_log_turn(Dialogue *dialogue);
+
+/**
+ * @brief Gets the number of messages in the scrollback
+ * @author Ignacio Nunez
+ *
+ * @param dialogue pointer to the dialogue
+ * @return number of messages, at most DIALOGUE_LOG_SIZE, or -1 if something went wrong
+ */
+int dialogue_log_get_count(Dialogue *dialogue);
+
+/**
+ * @brief Gets a message of the scrollback
+ * @author Ignacio Nunez
+ *
+ * @param dialogue pointer to the dialogue
+ * @param age 0 for the newest message, 1 for the one before it...
+ * @param kind where the kind of the message is returned, it can be NULL
+ * @return the message, or NULL if there is no such message
+ */
+const char *dialogue_log_get(Dialogue *dialogue, int age, DL_Kind *kind);
+
 
 #endif
@@ -215,4 +215,14 @@ STATUS enemy_set_gdesc(Enemy *s, char **newgdesc);
  */
 char **enemy_get_gdesc(Enemy *s);
 
+/**
+ * @brief Sets the change counter a enemy bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param enemy a pointer to target enemy
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS enemy_set_epoch(Enemy *enemy, unsigned long *epoch);
+
 #endif
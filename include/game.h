@@ -21,12 +21,14 @@
 #include "inventory.h"
 #include "game_rules.h"
 #include "dialogue.h"
+#include "trigger.h"
 
 #define MAX_LINKS 200  /*!< It established the maximun of links that can be in a game */
 #define MAX_SPACES 100  /*!< It established the maximun of spaces that can be in a game */
 #define MAX_ENEMYS 10   /*!< It established the maximun of enemies that can be in a game */
 #define MAX_OBJS 100   /*!< It established the maximun of objects that can be in a game */
 #define MAX_PLAYERS 1  /*!< It established the maximun of players that can be in a game */
+#define GAME_STATE_VERSION 3  /*!< Version of the format written by game_state_write */
 
 /**
  * @brief Game's structucture
@@ -35,6 +37,16 @@
  */
 typedef struct _Game Game;
 
+/**
+ * @brief A command with its arguments, as game_update gets them
+ */
+typedef struct
+{
+  T_Command cmd;      /*!< Command */
+  char arg1[MAX_ARG]; /*!< First argument, "" if it has none */
+  char arg2[MAX_ARG]; /*!< Second argument, "" if it has none */
+} Game_command;
+
 /**
   * @brief returns inspection' pointer
   * @author Antonio Van-Oers
@@ -79,6 +91,37 @@ STATUS game_create(Game *game);
   */
 int game_update(Game *game, T_Command cmd, char *arg1, char *arg2);
 
+/**
+  * @brief Plays several commands one after another
+  * @author Ignacio Nunez
+  *
+  * The game ends as if game_update was called with each command, but the
+  * updates done after every command (keys of dead enemies, broken objects,
+  * light) are skipped while nothing has changed since they last did nothing.
+  * Every command is played, even after an exit.
+  * 
+  * @param game a pointer to game
+  * @param cmds commands to play, in order
+  * @param n number of commands
+  * @param st where what game_update would return for each command is saved, n ints
+  * @param ns where the nanoseconds each command took are saved, n longs, NULL if not wanted
+  * @return number of commands played, or -1 if there was any mistake
+  */
+int game_update_batch(Game *game, Game_command *cmds, int n, int *st, long *ns);
+
+/**
+  * @brief Lets the time go on in a real time game
+  * @author Ignacio Nunez
+  *
+  * It is the part of a turn that does not depend on the player: the
+  * updates after a command and the random event. The last command and its
+  * status are kept, only its text is cleared.
+  * 
+  * @param game a pointer to game
+  * @return OK if everything goes well or ERROR if there was any mistake
+  */
+STATUS game_tick(Game *game);
+
 /**
   * @brief frees/destroys the game
   * @author Ignacio Nunez
@@ -140,6 +183,36 @@ STATUS game_set_time(Game *game, Time time);
  */
 Time game_get_time(Game *game);
 
+/**
+ * @brief Gets the light a space has now
+ * @author Ignacio Nunez
+ *
+ * It is worked out from the time, so day and night touch no space: a
+ * space with fixed light keeps its own, and any other one is bright by
+ * day, and by night only if the light of a source reaches it. Sources are
+ * the spaces with fire, the lit objects of the player and the lit objects
+ * left in a space, and their light goes through the open links around
+ * them.
+ *
+ * @param game Given game
+ * @param space pointer to the space
+ * @return BRIGHT or DARK, UNKNOWN_LIGHT if error
+ */
+Light game_get_space_light(Game *game, Space *space);
+
+/**
+ * @brief Spreads the light of every source of the game from scratch
+ * @author Ignacio Nunez
+ *
+ * It is needed once the spaces and links are loaded, or when they all
+ * change at once. Afterwards the light is moved only where a source or
+ * a link changes.
+ *
+ * @param game Given game
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_set_lights(Game *game);
+
 /**
  * @brief Gets the last event
  * @author Ignacio Nunnez
@@ -271,6 +344,114 @@ Id game_get_object_id(Game *game, int num);
  */
 Game* game_alloc2();
 
+/**
+ * @brief Sets the seed of the random generator of the game
+ * @author Ignacio Nunez
+ *
+ * Every game has its own random generator (events and combat), so games
+ * can be played at the same time from different threads and a game
+ * played again with the same seed and commands ends the same way.
+ *
+ * @param game pointer to game
+ * @param seed new seed
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_set_seed(Game *game, unsigned long seed);
+
+/**
+ * @brief Sets the random events of a game
+ * @author Ignacio Nunez
+ *
+ * The game keeps the table and frees it, along with the one it had. The
+ * next event is drawn again with the chances of the new table.
+ *
+ * @param game pointer to game
+ * @param table random events, usually loaded from the map
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_set_events(Game *game, Event_table *table);
+
+/**
+ * @brief Sets the triggers of a game
+ * @author Ignacio Nunez
+ *
+ * The game keeps the triggers and frees them, along with the ones it had.
+ * The spaces of the game get the light of their triggers, so they have to
+ * be loaded before.
+ *
+ * @param game pointer to game
+ * @param triggers triggers, usually loaded from the map
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_set_triggers(Game *game, Triggers *triggers);
+
+/**
+ * @brief Sets whether a game is played in real time
+ * @author Ignacio Nunez
+ *
+ * In real time game_update only plays the command and the random events
+ * come with game_tick, so they happen at the pace of the clock and not of
+ * the player. Games start not in real time.
+ *
+ * @param game pointer to game
+ * @param realtime TRUE for real time, FALSE for a turn after every command
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_set_realtime(Game *game, BOOL realtime);
+
+/**
+ * @brief Gets the seed of the random generator of the game
+ * @author Ignacio Nunez
+ *
+ * @param game pointer to game
+ * @return the seed, or 0 if there was any mistake
+ */
+unsigned long game_get_seed(Game *game);
+
+/**
+ * @brief Gets the change counter of the game
+ * @author Ignacio Nunez
+ *
+ * The counter goes up every time a space, object, player, enemy, link or
+ * the time of the day changes, so a view of the game only has to be
+ * built again when it is not the same as last time.
+ * @param game pointer to game
+ * @return the counter, or 0 if there was any mistake
+ */
+unsigned long game_get_epoch(Game *game);
+
+/**
+ * @brief Writes the state that changes while playing into a buffer
+ * @author Ignacio Nunez
+ *
+ * It writes the light and objects of every space, every object, the
+ * player with its inventory, the enemies, the status of the links, the
+ * time, the last command and event and the random generator. Data loaded
+ * from the map that never changes (names, descriptions, gdesc) is not
+ * written, so the state can only be read by a game loaded from the same map.
+ *
+ * @param game pointer to game
+ * @param buf buffer where the state is written, it can be NULL to get the size needed
+ * @param max size of buf
+ * @return number of bytes of the state, or -1 if buf is too small or there was any mistake
+ */
+long game_state_write(Game *game, unsigned char *buf, long max);
+
+/**
+ * @brief Restores a state written by game_state_write
+ * @author Ignacio Nunez
+ *
+ * The game must be loaded from the same map the state was written from.
+ * The text of the last command (inspection and dialogue) is cleared.
+ * If ERROR is returned the game may be partially restored.
+ *
+ * @param game pointer to game
+ * @param buf buffer with the state
+ * @param len number of bytes of the state
+ * @return OK if everything goes well or ERROR if the state does not belong to this map
+ */
+STATUS game_state_read(Game *game, const unsigned char *buf, long len);
+
 /**
  * @brief It get if link is open or close giving an space and a specific direction
  * @author Miguel Soto
@@ -419,7 +600,7 @@ Dialogue *game_get_dialogue(Game *game);
 Enemy *game_get_enemyWithPlayer(Game *game, Id player_loc); 
 
 /**
- * @brief Checks if space is dark and player has a turnedon object, and then changes the light status of the space
+ * @brief Counts the turnedon objects of the player again in the space it is in
  * @author Nicolas Victorino
  * 
  * @param game Pointer to the game
@@ -427,24 +608,6 @@ Enemy *game_get_enemyWithPlayer(Game *game, Id player_loc);
  */
 STATUS game_update_ls(Game *game);
 
-/**
- * @brief Checks if it is night time and sets all the rooms to dark
- * @author Nicolas Victorino
- * 
- * @param game pointer to game
- * @return ERROR if something went wrong
- */
-STATUS game_update_time(Game *game);
-
-/**
- * @brief Checks whether an object should be dropped on a space or not depending on the enemies health
- * @author Nicolas Victorino
- * 
- * @param game Pointer to game
- * @return ERROR if something went wrong 
- */
-STATUS game_update_object(Game *game);
-
 /**
  * @brief Checks whether an enemy has 0 health and then changes its location to -1
  * @author Nicolas Victorino
@@ -1,6 +1,18 @@
 /**
  * @brief It defines features of the game
  *
+ * Every random event has a timer in a timer wheel with the turn it is due.
+ * Each turn only the timers due then are looked at, the wheel costs the
+ * same whether it has one timer or many. The wheel has two levels of
+ * WHEEL_SLOTS turns (the next WHEEL_SLOTS turns and the next WHEEL_SLOTS
+ * groups of WHEEL_SLOTS turns) and a list for the timers further away,
+ * which are moved down when their group of turns comes.
+ *
+ * Which event happens is drawn from an event table, loaded from the map,
+ * with the alias method: one random number picks an entry whatever the
+ * number of entries. Each entry has its chance each turn, in percent, and
+ * the conditions it needs to happen.
+ *
  * @file game_rules.h
  * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
  * @version 1.0
@@ -8,6 +20,11 @@
  * @copyright GNU Public License
  */
 
+#ifndef GAME_RULES_H
+#define GAME_RULES_H
+
+#include "rng.h"
+
 #define EVENT_CERO 0
 #define EVENT_ONE 75
 #define EVENT_TWO 80
@@ -15,6 +32,17 @@
 #define EVENT_FOUR 93
 #define EVENT_FIVE 95
 
+#define WHEEL_BITS 6                   /*!< Bits of the turn that index a level of the wheel */
+#define WHEEL_SLOTS (1 << WHEEL_BITS)  /*!< Slots of each level of the wheel */
+#define WHEEL_TIMERS 8                 /*!< Maximun number of timers of a wheel */
+
+#define EVENT_TABLE_SIZE 64 /*!< Maximun number of entries of an event table */
+#define COND_NONE 0         /*!< The event can always happen */
+#define COND_NIGHT 1        /*!< Only at night */
+#define COND_DAY 2          /*!< Only by day */
+#define COND_MOVE 4         /*!< Only after a move */
+#define COND_NOATTACK 8     /*!< Not after an attack */
+
 typedef enum rules_Event
 {
   NOTHING = EVENT_CERO,
@@ -25,13 +53,203 @@ typedef enum rules_Event
   SPAWN = EVENT_FIVE
 } R_Event;
 
+typedef struct _Wheel Wheel; /*!< It defines a timer wheel */
+
+/**
+ * @brief Gets in how many turns something happens again
+ * @author Ignacio Nunez
+ *
+ * It has the same chance every turn, so the number of turns follows a
+ * geometric distribution.
+ *
+ * @param rng random generator of the game
+ * @param percent chance each turn, from 1 to 100
+ * @return number of turns, 1 or more, or -1 if there was any mistake
+ */
+long game_rules_get_delay(Rng *rng, int percent);
+
 /**
- * @brief Obtains the Event for the game
- * @author Ignacio Nunnez
+ * @brief Allocates memory for a new timer wheel, with no timer set
+ * @author Ignacio Nunez
  *
- * It generates a random number and according to some percentages
- * return the event for the inmediate game
+ * @param now turn the wheel starts at
+ * @return a pointer to the new wheel or NULL if anything went wrong
+ */
+Wheel *game_rules_wheel_create(long now);
+
+/**
+ * @brief Frees the previously allocated memory for a timer wheel
+ * @author Ignacio Nunez
  *
- * @return R_Event, most cases will be NOTHING
+ * @param w a pointer to target wheel
+ * @return OK if everything goes well, or ERROR if anything doesn't.
  */
-R_Event game_rules_get_event();
+STATUS game_rules_wheel_destroy(Wheel *w);
+
+/**
+ * @brief Sets a timer, moving it if it was already set
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param timer timer, from 0 to WHEEL_TIMERS - 1
+ * @param due turn the timer is due, after the current turn of the wheel
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_wheel_set(Wheel *w, int timer, long due);
+
+/**
+ * @brief Stops a timer
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param timer timer, from 0 to WHEEL_TIMERS - 1
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_wheel_stop(Wheel *w, int timer);
+
+/**
+ * @brief Gets the turn a timer is due
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param timer timer, from 0 to WHEEL_TIMERS - 1
+ * @return the turn, or -1 if the timer is not set or there was any mistake
+ */
+long game_rules_wheel_get_due(Wheel *w, int timer);
+
+/**
+ * @brief Moves a wheel to the next turn
+ * @author Ignacio Nunez
+ *
+ * The timers due in that turn are stopped and returned.
+ *
+ * @param w a pointer to the wheel
+ * @param due where the timers due are returned, from the lowest, WHEEL_TIMERS ints
+ * @return number of timers due, or -1 if there was any mistake
+ */
+int game_rules_wheel_next(Wheel *w, int *due);
+
+/**
+ * @brief Gets the current turn of a wheel
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @return the turn, or -1 if there was any mistake
+ */
+long game_rules_wheel_get_now(Wheel *w);
+
+/**
+ * @brief Moves a wheel to a turn, stopping every timer
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param now new turn of the wheel
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_wheel_reset(Wheel *w, long now);
+
+typedef struct _Event_table Event_table; /*!< It defines a table of random events */
+
+/**
+ * @brief Allocates memory for a new, empty event table
+ * @author Ignacio Nunez
+ *
+ * @return a pointer to the new table or NULL if anything went wrong
+ */
+Event_table *game_rules_table_create();
+
+/**
+ * @brief Frees the previously allocated memory for an event table
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to target table
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_table_destroy(Event_table *t);
+
+/**
+ * @brief Adds an entry to an event table
+ * @author Ignacio Nunez
+ *
+ * The chances of all the entries can add up to 100 at most.
+ *
+ * @param t a pointer to the table
+ * @param event event, not NOTHING
+ * @param chance chance each turn, in percent, 1 or more
+ * @param cond conditions it needs, COND_ flags or-ed
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_table_add(Event_table *t, R_Event event, int chance, int cond);
+
+/**
+ * @brief Adds the entries used when a map has no events
+ * @author Ignacio Nunez
+ *
+ * They are the five events of R_Event, each with the chance its EVENT_*
+ * range gives it and the conditions it always had.
+ *
+ * @param t a pointer to the table
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_table_add_default(Event_table *t);
+
+/**
+ * @brief Gets the number of entries of an event table
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the table
+ * @return number of entries, or -1 if there was any mistake
+ */
+int game_rules_table_get_count(Event_table *t);
+
+/**
+ * @brief Gets the chance each turn that any event of a table happens
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the table
+ * @return chance in percent, the sum of the chances of the entries, or -1 if there was any mistake
+ */
+int game_rules_table_get_chance(Event_table *t);
+
+/**
+ * @brief Draws the entry of an event table that happens
+ * @author Ignacio Nunez
+ *
+ * Each entry comes in proportion to its chance, in constant time.
+ *
+ * @param t a pointer to the table, not empty
+ * @param rng random generator of the game
+ * @param cond where the conditions of the entry are returned
+ * @return event of the entry, or NOTHING if there was any mistake
+ */
+R_Event game_rules_table_get(Event_table *t, Rng *rng, int *cond);
+
+/**
+ * @brief Prints the entries of an event table in the save file
+ * @author Ignacio Nunez
+ *
+ * @param filename save file
+ * @param t a pointer to the table
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_rules_table_print_save(char *filename, Event_table *t);
+
+/**
+ * @brief Gets an event by its name in the map file
+ * @author Ignacio Nunez
+ *
+ * @param name name: move_obj, trap, slime, daynight or spawn
+ * @return the event, or NOTHING if there is none with that name
+ */
+R_Event game_rules_event_get_byName(char *name);
+
+/**
+ * @brief Gets a condition by its name in the map file
+ * @author Ignacio Nunez
+ *
+ * @param name name: none, night, day, move or noattack
+ * @return the COND_ flag, or -1 if there is none with that name
+ */
+int game_rules_cond_get_byName(char *name);
+
+#endif
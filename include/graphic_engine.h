@@ -12,6 +12,7 @@
 #define __GRAPHIC_ENGINE__
 
 #include "game.h"
+#include "render_stats.h"
 
 /**
  * @brief Graphic engine
@@ -57,6 +58,28 @@ void graphic_engine_destroy(Graphic_engine *ge);
   */
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st);
 
+/**
+  * @brief Sets where the times of each frame are kept
+  * @author Ignacio Nunez
+  *
+  * It has to be called before the first turn is painted. The statistics
+  * are not freed with the graphic engine.
+  * @param ge pointer to the graphic engine
+  * @param stats pointer to the statistics, NULL if nothing is measured
+  */
+void graphic_engine_set_stats(Graphic_engine *ge, Render_stats *stats);
+
+/**
+  * @brief Waits until every turn handed to the graphic engine has been painted
+  * @author Ignacio Nunez
+  *
+  * graphic_engine_paint_game returns as soon as the view of the turn is
+  * built, the render thread paints it later. Anything else written to the
+  * terminal has to wait for it.
+  * @param ge pointer to the graphic engine
+  */
+void graphic_engine_wait(Graphic_engine *ge);
+
 /**
   * @brief Writes down the last inputted command
   * @author Profesores PPROG
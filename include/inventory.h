@@ -126,4 +126,14 @@ STATUS inventory_print(Inventory* inventory);
   */
 STATUS inventory_print_save(char *filename, Inventory* inventory, Id player);
 
+/**
+ * @brief Sets the change counter a inventory bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param inventory a pointer to target inventory
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS inventory_set_epoch(Inventory *inventory, unsigned long *epoch);
+
 #endif
@@ -0,0 +1,87 @@
+/**
+ * @brief It defines the layout of the screen, where each area goes
+ *
+ * The layout is worked out from the size of the terminal when the game
+ * starts and every time the terminal is resized, never while painting.
+ * A terminal big enough gets the usual screen; a smaller one gets a
+ * compact layout that fits in it, without banner or help.
+ *
+ * @file layout.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "types.h"
+
+#define LAYOUT_ROWS 44        /*!< Rows of the usual screen */
+#define LAYOUT_COLUMNS 120    /*!< Columns of the usual screen */
+#define LAYOUT_MIN_ROWS 16    /*!< Rows of the smallest screen */
+#define LAYOUT_MIN_COLUMNS 40 /*!< Columns of the smallest screen */
+
+/**
+ * @brief Areas of the screen
+ */
+typedef enum
+{
+  L_MAP,      /*!< Map */
+  L_DESCRIPT, /*!< Description */
+  L_BANNER,   /*!< Banner */
+  L_HELP,     /*!< Commands that can be used */
+  L_FEEDBACK, /*!< Last commands */
+  L_DIALOGUE, /*!< Dialogue */
+  L_EVENTS,   /*!< Events */
+  L_AREAS     /*!< Number of areas */
+} Layout_area;
+
+/**
+ * @brief Rectangle of an area, in cells of the screen
+ */
+typedef struct
+{
+  int x;      /*!< Column of the up-left corner */
+  int y;      /*!< Row of the up-left corner */
+  int width;  /*!< Width, 0 if the area is not shown */
+  int height; /*!< Height */
+} Layout_rect;
+
+/**
+ * @brief Layout of the screen
+ */
+typedef struct
+{
+  int rows;                   /*!< Rows of the screen */
+  int columns;                /*!< Columns of the screen */
+  BOOL compact;               /*!< TRUE if it is not the usual screen */
+  Layout_rect area[L_AREAS];  /*!< Rectangle of each area */
+} Layout;
+
+/**
+ * @brief Works out the layout for a terminal
+ * @author Ignacio Nunez
+ *
+ * One row of the terminal is left for the prompt, so a painted frame
+ * never makes the terminal scroll.
+ * @param layout pointer to the layout to fill
+ * @param rows rows of the terminal
+ * @param columns columns of the terminal
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS layout_compute(Layout *layout, int rows, int columns);
+
+/**
+ * @brief Gets the size of a terminal
+ * @author Ignacio Nunez
+ *
+ * @param fd file descriptor of the terminal
+ * @param rows where its rows are returned
+ * @param columns where its columns are returned
+ * @return OK if everything goes well, or ERROR if fd is not a terminal or anything doesn't.
+ */
+STATUS layout_get_terminal(int fd, int *rows, int *columns);
+
+#endif
@@ -42,6 +42,14 @@ void  screen_destroy();
   */
 void  screen_paint();
 
+/**
+  * @brief It gets the number of bytes sent to the terminal by the last paint
+  * @author Ignacio Nunez
+  *
+  * @return the number of bytes, 0 if nothing was painted yet
+  */
+long  screen_get_bytes();
+
 /**
   * @brief It creates a new area inside a screen
   * @author Profesores PPROG
@@ -173,4 +173,14 @@ int link_print(Link *link);
  */
 STATUS link_print_save(char *filename, Link *link);
 
+/**
+ * @brief Sets the change counter a link bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param link a pointer to target link
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS link_set_epoch(Link *link, unsigned long *epoch);
+
 #endif
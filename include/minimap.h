@@ -0,0 +1,98 @@
+/**
+ * @brief It defines the minimap, a view of the whole floor of the player
+ *
+ * The grid layout of a floor is worked out once from the directions of its
+ * links and kept, together with the boxes drawn from it. Every turn only
+ * the player marker and the light of the spaces are drawn on top.
+ *
+ * @file minimap.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef MINIMAP_H
+#define MINIMAP_H
+
+#include "types.h"
+#include "view_model.h"
+
+#define MINIMAP_ROWS 24   /*!< Rows of a minimap */
+#define MINIMAP_COLS 80   /*!< Width of a minimap */
+#define MINIMAP_CELL_X 10 /*!< Columns taken by a space, box and gap */
+#define MINIMAP_CELL_Y 5  /*!< Rows taken by a space, box and gap */
+
+typedef struct _Minimap Minimap; /*!< It defines a minimap and its cached layouts */
+
+/**
+ * @brief Allocates memory for a new minimap, without any layout
+ * @author Ignacio Nunez
+ *
+ * @return a pointer to the new minimap or NULL if anything went wrong
+ */
+Minimap *minimap_create();
+
+/**
+ * @brief Frees the previously allocated memory for a minimap
+ * @author Ignacio Nunez
+ *
+ * @param mm a pointer to target minimap
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS minimap_destroy(Minimap *mm);
+
+/**
+ * @brief Drops the layouts of every floor
+ * @author Ignacio Nunez
+ *
+ * Needed when the spaces themselves change (a game is loaded).
+ * @param mm a pointer to target minimap
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS minimap_clear(Minimap *mm);
+
+/**
+ * @brief Draws the floor of a view
+ * @author Ignacio Nunez
+ *
+ * The layout of the floor is worked out only the first time it is drawn,
+ * or if its spaces are not the ones it was worked out from.
+ * @param mm a pointer to the minimap
+ * @param view a pointer to the view
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS minimap_render(Minimap *mm, const View *view);
+
+/**
+ * @brief Gets a row of the last drawing of a minimap
+ * @author Ignacio Nunez
+ *
+ * @param mm a pointer to the minimap
+ * @param row number of the row, from 0
+ * @return the text of the row, MINIMAP_COLS characters, or NULL if anything went wrong
+ */
+const char *minimap_get_row(const Minimap *mm, int row);
+
+/**
+ * @brief Gets how many layouts a minimap has worked out
+ * @author Ignacio Nunez
+ *
+ * @param mm a pointer to the minimap
+ * @return number of layouts, -1 if anything went wrong
+ */
+long minimap_get_layouts(const Minimap *mm);
+
+/**
+ * @brief Gets where a space is in the last drawing of a minimap
+ * @author Ignacio Nunez
+ *
+ * @param mm a pointer to the minimap
+ * @param id id of the space
+ * @param row where the row of the top left corner of its box is returned
+ * @param col where the column of that corner is returned
+ * @return OK if the space is drawn, ERROR otherwise
+ */
+STATUS minimap_get_position(const Minimap *mm, Id id, int *row, int *col);
+
+#endif
@@ -306,5 +306,15 @@ STATUS object_set_durability(Object *obj, int dur);
  */
 BOOL object_isBroken(Object *obj);
 
+/**
+ * @brief Sets the change counter a obj bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param obj a pointer to target obj
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS object_set_epoch(Object *obj, unsigned long *epoch);
+
 #endif
 
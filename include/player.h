@@ -281,4 +281,14 @@ STATUS player_set_gdesc(Player *p, char **newgdesc);
  */
 char **player_get_gdesc(Player *p);
 
+/**
+ * @brief Sets the change counter a player bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param player a pointer to target player
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS player_set_epoch(Player *player, unsigned long *epoch);
+
 #endif
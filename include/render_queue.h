@@ -0,0 +1,105 @@
+/**
+ * @brief It defines the queue of views waiting to be painted
+ *
+ * The game loop puts the view of every turn in the queue and the render
+ * thread takes them out in the same order. There is only one thread on
+ * each end: the producer writes the slot at the back, the consumer reads
+ * the one at the front, and only the indexes are shared.
+ *
+ * @file render_queue.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include "types.h"
+#include "view_model.h"
+
+#define RENDER_QUEUE_SIZE 8 /*!< Views the game can be ahead of the screen */
+
+typedef struct _Render_queue Render_queue; /*!< It defines a queue of views */
+
+/**
+ * @brief Allocates memory for a new, empty queue
+ * @author Ignacio Nunez
+ *
+ * @param size number of views it can hold, at least 1
+ * @return a pointer to the new queue or NULL if anything went wrong
+ */
+Render_queue *render_queue_create(int size);
+
+/**
+ * @brief Frees the previously allocated memory for a queue
+ * @author Ignacio Nunez
+ *
+ * Neither end may be using it any more.
+ * @param q a pointer to target queue
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_queue_destroy(Render_queue *q);
+
+/**
+ * @brief Puts a copy of a view at the back of a queue
+ * @author Ignacio Nunez
+ *
+ * It waits while the queue is full. Only the producer calls it.
+ * @param q a pointer to the queue
+ * @param view a pointer to the view
+ * @return OK if everything goes well, or ERROR if the queue is closed or anything doesn't.
+ */
+STATUS render_queue_push(Render_queue *q, const View *view);
+
+/**
+ * @brief Gets the view at the front of a queue, leaving it there
+ * @author Ignacio Nunez
+ *
+ * It waits while the queue is empty and open. Only the consumer calls it,
+ * and the view can be used until render_queue_pop.
+ * @param q a pointer to the queue
+ * @return the view, or NULL if the queue is closed and empty
+ */
+const View *render_queue_front(Render_queue *q);
+
+/**
+ * @brief Takes out the view at the front of a queue
+ * @author Ignacio Nunez
+ *
+ * Only the consumer calls it, once it has finished with the view.
+ * @param q a pointer to the queue
+ * @return OK if everything goes well, or ERROR if the queue is empty or anything doesn't.
+ */
+STATUS render_queue_pop(Render_queue *q);
+
+/**
+ * @brief Waits until every view of a queue has been taken out
+ * @author Ignacio Nunez
+ *
+ * @param q a pointer to the queue
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_queue_wait(Render_queue *q);
+
+/**
+ * @brief Closes a queue, no more views will be put in it
+ * @author Ignacio Nunez
+ *
+ * The consumer still gets the views already in it.
+ * @param q a pointer to the queue
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_queue_close(Render_queue *q);
+
+/**
+ * @brief Gets the number of views in a queue
+ * @author Ignacio Nunez
+ *
+ * @param q a pointer to the queue
+ * @return number of views, -1 if anything went wrong
+ */
+int render_queue_get_count(Render_queue *q);
+
+#endif
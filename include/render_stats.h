@@ -0,0 +1,133 @@
+/**
+ * @brief It defines the statistics of the renderer
+ *
+ * Times of building and painting each frame, and bytes sent to the
+ * terminal, are kept in histograms of powers of two. They are only
+ * measured when the game is started with them, and printed when it ends.
+ *
+ * @file render_stats.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RENDER_STATS_H
+#define RENDER_STATS_H
+
+#include <stdio.h>
+#include "types.h"
+
+#define RENDER_STATS_BUCKETS 32 /*!< Buckets of a histogram, the last one for any bigger value */
+
+/**
+ * @brief What is measured
+ */
+typedef enum
+{
+  RS_BUILD,    /*!< Building the view of a turn, in the game loop (us) */
+  RS_MAP,      /*!< Painting the map or the minimap (us) */
+  RS_DESCRIPT, /*!< Painting the description (us) */
+  RS_HELP,     /*!< Painting the help and the banner (us) */
+  RS_FEEDBACK, /*!< Painting the feedback (us) */
+  RS_DIALOGUE, /*!< Painting the dialogue and the events (us) */
+  RS_SCREEN,   /*!< Sending the screen to the terminal (us) */
+  RS_PAINT,    /*!< Whole paint of a frame (us) */
+  RS_BYTES,    /*!< Bytes sent to the terminal in a frame */
+  RS_STATS     /*!< Number of things measured */
+} Render_stat;
+
+typedef struct _Render_stats Render_stats; /*!< It defines the statistics of the renderer */
+
+/**
+ * @brief Allocates memory for new, empty statistics
+ * @author Ignacio Nunez
+ *
+ * @return a pointer to the new statistics or NULL if anything went wrong
+ */
+Render_stats *render_stats_create();
+
+/**
+ * @brief Frees the previously allocated memory for some statistics
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to target statistics
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_stats_destroy(Render_stats *rs);
+
+/**
+ * @brief Adds a value to a histogram
+ * @author Ignacio Nunez
+ *
+ * It can be called from the game loop and the render thread at once.
+ * @param rs a pointer to the statistics
+ * @param stat what the value is
+ * @param value the value, negative ones count as 0
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_stats_add(Render_stats *rs, Render_stat stat, long value);
+
+/**
+ * @brief Starts measuring a time
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to the statistics, NULL if nothing is measured
+ * @return the current time in microseconds, 0 if rs is NULL
+ */
+long render_stats_start(Render_stats *rs);
+
+/**
+ * @brief Adds the time since render_stats_start to a histogram
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to the statistics, NULL if nothing is measured
+ * @param stat what was measured
+ * @param start the value returned by render_stats_start
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_stats_stop(Render_stats *rs, Render_stat stat, long start);
+
+/**
+ * @brief Gets the number of values added to a histogram
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to the statistics
+ * @param stat what was measured
+ * @return the number of values, -1 if anything went wrong
+ */
+long render_stats_get_count(Render_stats *rs, Render_stat stat);
+
+/**
+ * @brief Gets the number of values in a bucket of a histogram
+ * @author Ignacio Nunez
+ *
+ * Bucket 0 has the zeros, and bucket b the values from 2^(b-1) to 2^b - 1.
+ * @param rs a pointer to the statistics
+ * @param stat what was measured
+ * @param bucket the bucket
+ * @return the number of values, -1 if anything went wrong
+ */
+long render_stats_get_bucket(Render_stats *rs, Render_stat stat, int bucket);
+
+/**
+ * @brief Gets the biggest value added to a histogram
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to the statistics
+ * @param stat what was measured
+ * @return the value, -1 if anything went wrong or nothing was added
+ */
+long render_stats_get_max(Render_stats *rs, Render_stat stat);
+
+/**
+ * @brief Prints every histogram with values
+ * @author Ignacio Nunez
+ *
+ * @param rs a pointer to the statistics
+ * @param f file where they are printed
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS render_stats_print(Render_stats *rs, FILE *f);
+
+#endif
@@ -0,0 +1,133 @@
+/** 
+ * @brief It defines the record and replay of games
+ * 
+ * A replay file stores the map, the seed, every command played and a copy
+ * of the whole state of the game (keyframe) every few turns. Any turn can
+ * be reached restoring the nearest keyframe before it and playing only
+ * the commands after it.
+ * 
+ * @file replay.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "types.h"
+#include "command.h"
+#include "game.h"
+
+#define REPLAY_INTERVAL 50 /*!< Default number of turns between two keyframes */
+
+typedef struct _Replay Replay; /*!< It defines the replay structure, used both to record and to play */
+
+/**
+ * @brief Starts recording a game in a new replay file
+ * @author Ignacio Nunez
+ * 
+ * The current state of the game is written as the keyframe of turn 0, so
+ * a game that was loaded or moved to another turn can be recorded too.
+ * 
+ * @param filename name of the replay file, it is overwritten
+ * @param map name of the data file the game was loaded from
+ * @param game pointer to the game, already loaded
+ * @param interval turns between two keyframes, REPLAY_INTERVAL if it is 0 or less
+ * @return a pointer to the new replay or NULL if anything went wrong
+ */
+Replay *replay_record(char *filename, char *map, Game *game, int interval);
+
+/**
+ * @brief Adds a command to a replay that is being recorded
+ * @author Ignacio Nunez
+ * 
+ * It must be called after game_update with the same arguments. A keyframe
+ * is written after the command when the turn is a multiple of the interval.
+ * 
+ * @param r pointer to the replay
+ * @param game pointer to the game, after running the command
+ * @param cmd command played
+ * @param arg1 first argument of the command (it can be NULL)
+ * @param arg2 second argument of the command (it can be NULL)
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS replay_add_command(Replay *r, Game *game, T_Command cmd, char *arg1, char *arg2);
+
+/**
+ * @brief Loads a replay file to play it
+ * @author Ignacio Nunez
+ * 
+ * The file is read once and every command and keyframe is indexed. If the
+ * file was cut (the game crashed) it is loaded up to the last whole record.
+ * 
+ * @param filename name of the replay file
+ * @return a pointer to the replay or NULL if the file is not a replay
+ */
+Replay *replay_load(char *filename);
+
+/**
+ * @brief Frees a replay, closing the file if it was being recorded
+ * @author Ignacio Nunez
+ * 
+ * @param r pointer to the replay
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS replay_destroy(Replay *r);
+
+/**
+ * @brief Gets the number of commands (turns) of a replay
+ * @author Ignacio Nunez
+ * 
+ * @param r pointer to the replay
+ * @return number of turns, or -1 if r is NULL
+ */
+int replay_get_turns(Replay *r);
+
+/**
+ * @brief Gets the name of the map of a replay
+ * @author Ignacio Nunez
+ * 
+ * @param r pointer to the replay
+ * @return the name of the data file, or NULL if r is NULL
+ */
+const char *replay_get_map(Replay *r);
+
+/**
+ * @brief Gets the seed of the game of a replay
+ * @author Ignacio Nunez
+ * 
+ * @param r pointer to the replay
+ * @return the seed, or 0 if r is NULL
+ */
+unsigned long replay_get_seed(Replay *r);
+
+/**
+ * @brief Gets a command of a loaded replay
+ * @author Ignacio Nunez
+ * 
+ * @param r pointer to the replay
+ * @param turn turn of the command, from 1 to replay_get_turns
+ * @param cmd where the command is copied
+ * @param arg1 where the first argument is copied, at least MAX_ARG chars
+ * @param arg2 where the second argument is copied, at least MAX_ARG chars
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS replay_get_command(Replay *r, int turn, T_Command *cmd, char *arg1, char *arg2);
+
+/**
+ * @brief Moves a game to a turn of a loaded replay
+ * @author Ignacio Nunez
+ * 
+ * It restores the nearest keyframe at or before the turn and plays the
+ * commands from there, so at most interval - 1 commands are played.
+ * 
+ * @param r pointer to the replay
+ * @param game pointer to a game loaded from the map of the replay
+ * @param turn turn to reach, from 0 to replay_get_turns
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS replay_seek(Replay *r, Game *game, int turn);
+
+#endif
@@ -0,0 +1,103 @@
+/** 
+ * @brief It defines the random number generator of a game
+ * 
+ * Every game has its own generator (xoshiro128**), so games are
+ * reproducible from their seed and never share the state of libc's rand().
+ * 
+ * @file rng.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026 
+ * @copyright GNU Public License
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include "types.h"
+
+#define RNG_STATE_SIZE 4 /*!< Number of 32 bits words of the state of a generator */
+
+typedef struct _Rng Rng; /*!< It defines the random number generator structure */
+
+/**
+ * @brief Allocates memory for a new generator
+ * @author Ignacio Nunez
+ * 
+ * @param seed seed of the generator, the same seed gives the same numbers
+ * @return a pointer to the new generator or NULL if anything went wrong
+ */
+Rng *rng_create(unsigned long seed);
+
+/**
+ * @brief Frees the previously allocated memory for a generator
+ * @author Ignacio Nunez
+ * 
+ * @param rng a pointer to target generator
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS rng_destroy(Rng *rng);
+
+/**
+ * @brief Restarts the generator from a seed
+ * @author Ignacio Nunez
+ * 
+ * @param rng a pointer to target generator
+ * @param seed new seed
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS rng_set_seed(Rng *rng, unsigned long seed);
+
+/**
+ * @brief Gets the seed the generator was started from
+ * @author Ignacio Nunez
+ * 
+ * @param rng a pointer to target generator
+ * @return the seed, or 0 if rng is NULL
+ */
+unsigned long rng_get_seed(Rng *rng);
+
+/**
+ * @brief Gets the next random number
+ * @author Ignacio Nunez
+ * 
+ * @param rng a pointer to target generator
+ * @return a random number between 0 and 2^32 - 1, or 0 if rng is NULL
+ */
+unsigned long rng_next(Rng *rng);
+
+/**
+ * @brief Gets a random number in a range
+ * @author Ignacio Nunez
+ * 
+ * All the numbers of the range have the same probability.
+ * 
+ * @param rng a pointer to target generator
+ * @param max size of the range, it must be greater than 0
+ * @return a random number between 0 and max - 1, or -1 if there was any mistake
+ */
+int rng_range(Rng *rng, int max);
+
+/**
+ * @brief Copies the state of the generator
+ * @author Ignacio Nunez
+ * 
+ * Used together with rng_set_state to continue a sequence later.
+ * 
+ * @param rng a pointer to target generator
+ * @param state array where the state is copied
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS rng_get_state(Rng *rng, unsigned long state[RNG_STATE_SIZE]);
+
+/**
+ * @brief Restores a state copied with rng_get_state
+ * @author Ignacio Nunez
+ * 
+ * @param rng a pointer to target generator
+ * @param state state to restore, it can not be all zeros
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS rng_set_state(Rng *rng, const unsigned long state[RNG_STATE_SIZE]);
+
+#endif
@@ -0,0 +1,65 @@
+/**
+ * @brief It defines the scripts of commands
+ *
+ * A script is a file with one command per line, as typed by the player.
+ * The whole file is read at once and every line is interpreted when it is
+ * loaded, so playing it is only taking the next command out of an array.
+ * Blank lines are left out.
+ *
+ * @file script.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include "types.h"
+#include "command.h"
+
+typedef struct _Script Script; /*!< It defines a script of commands */
+
+/**
+ * @brief Loads a script from a file
+ * @author Ignacio Nunez
+ *
+ * Each line is interpreted as command_get_line_input does, and the lines
+ * longer than WORD_SIZE - 1 chars are cut there.
+ * @param filename name of the file, or NULL to read the standard input
+ * @return a pointer to the script or NULL if the file can't be read or anything went wrong
+ */
+Script *script_load(const char *filename);
+
+/**
+ * @brief Frees the previously allocated memory for a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to target script
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS script_destroy(Script *s);
+
+/**
+ * @brief Gets the number of commands of a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to the script
+ * @return number of commands, -1 if s is NULL
+ */
+long script_get_count(Script *s);
+
+/**
+ * @brief Gets a command of a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to the script
+ * @param i position of the command, from 0 to script_get_count - 1
+ * @param arg1 where the first argument is copied ("" if it has none), at least MAX_ARG chars
+ * @param arg2 where the second argument is copied ("" if it has none), at least MAX_ARG chars
+ * @return the command, or NO_CMD if i is out of the script or anything went wrong
+ */
+T_Command script_get(Script *s, long i, char *arg1, char *arg2);
+
+#endif
@@ -308,4 +308,55 @@ STATUS space_set_fire(Space *s, BOOL fire);
  */
 BOOL space_get_fire(Space *s);
 
+/**
+ * @brief It sets if day and night change the light of a space
+ * @author Ignacio Nunez
+ *
+ * @param s pointer to space
+ * @param fixed TRUE if its light stays as it is, FALSE if it follows the time
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS space_set_light_fixed(Space *s, BOOL fixed);
+
+/**
+ * @brief It gets if day and night change the light of a space
+ * @author Ignacio Nunez
+ *
+ * @param s pointer to space
+ * @return TRUE if its light stays as it is. In case of error returns FALSE.
+ */
+BOOL space_get_light_fixed(Space *s);
+
+/**
+ * @brief It sets the number of lit objects in a space
+ * @author Ignacio Nunez
+ *
+ * The game keeps it as lit objects come in and go out, so the light of
+ * the space is known without looking at its objects.
+ *
+ * @param s pointer to space
+ * @param n number of lit objects
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS space_set_light_sources(Space *s, int n);
+
+/**
+ * @brief It gets the number of lit objects in a space
+ * @author Ignacio Nunez
+ *
+ * @param s pointer to space
+ * @return number of lit objects, or -1 if there was some mistake
+ */
+int space_get_light_sources(Space *s);
+
+/**
+ * @brief Sets the change counter a space bumps every time it is modified
+ * @author Ignacio Nunez
+ *
+ * @param space a pointer to target space
+ * @param epoch pointer to the counter, NULL for none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS space_set_epoch(Space *space, unsigned long *epoch);
+
 #endif
@@ -0,0 +1,97 @@
+/**
+ * @brief It defines the cache of pre-rendered room tiles of the map
+ *
+ * A tile is the box of a space as it is drawn in the map area. Tiles are
+ * rendered once and kept until what they show (space, light, object
+ * marker, enemy sprite) changes.
+ *
+ * @file tile.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TILE_H
+#define TILE_H
+
+#include "types.h"
+#include "view_model.h"
+
+#define TILE_ROWS 12      /*!< Rows of the box of a space in the middle row of the map */
+#define TILE_STUB_ROWS 5  /*!< Rows of the boxes to the north and south */
+#define TILE_COLS 19      /*!< Width of a box */
+#define TILE_LEN 64       /*!< Maximun length of a row of a tile */
+
+typedef struct _Tile Tile;             /*!< It defines a pre-rendered box of a space */
+typedef struct _Tile_cache Tile_cache; /*!< It defines the cache of tiles */
+
+/**
+ * @brief Allocates memory for a new, empty cache
+ * @author Ignacio Nunez
+ *
+ * @return a pointer to the new cache or NULL if anything went wrong
+ */
+Tile_cache *tile_cache_create();
+
+/**
+ * @brief Frees the previously allocated memory for a cache
+ * @author Ignacio Nunez
+ *
+ * @param tc a pointer to target cache
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS tile_cache_destroy(Tile_cache *tc);
+
+/**
+ * @brief Drops every tile of a cache
+ * @author Ignacio Nunez
+ *
+ * Needed when the spaces themselves change (a game is loaded).
+ * @param tc a pointer to target cache
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS tile_cache_clear(Tile_cache *tc);
+
+/**
+ * @brief Gets the tile of a space of a view
+ * @author Ignacio Nunez
+ *
+ * The tile is rendered only if it is not in the cache with the same
+ * light, object marker and enemy sprite.
+ * @param tc a pointer to the cache
+ * @param view a pointer to the view
+ * @param slot which space of the view
+ * @return the tile, or NULL if there is no space in that slot
+ */
+const Tile *tile_cache_get(Tile_cache *tc, const View *view, View_slot slot);
+
+/**
+ * @brief Gets how many tiles a cache has rendered
+ * @author Ignacio Nunez
+ *
+ * @param tc a pointer to the cache
+ * @return number of tiles rendered, -1 if anything went wrong
+ */
+long tile_cache_get_misses(Tile_cache *tc);
+
+/**
+ * @brief Gets the number of rows of a tile
+ * @author Ignacio Nunez
+ *
+ * @param tile a pointer to the tile
+ * @return TILE_ROWS or TILE_STUB_ROWS, 0 if anything went wrong
+ */
+int tile_get_rows(const Tile *tile);
+
+/**
+ * @brief Gets a row of a tile
+ * @author Ignacio Nunez
+ *
+ * @param tile a pointer to the tile
+ * @param row number of the row, from 0
+ * @return the text of the row, or NULL if anything went wrong
+ */
+const char *tile_get_row(const Tile *tile, int row);
+
+#endif
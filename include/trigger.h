@@ -0,0 +1,151 @@
+/**
+ * @brief It defines the triggers of a map
+ *
+ * A trigger is a rule of the map that is run when something happens to
+ * an element, instead of being looked for every turn: when an enemy dies
+ * it drops an object in a space, when an object has no durability left it
+ * is taken out of the inventory, and some spaces keep their light by day
+ * and by night. The game asks for the triggers of an element only when
+ * that element changes.
+ *
+ * @file trigger.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+#include "types.h"
+
+#define MAX_TRIGGERS 64 /*!< Maximun number of triggers of a map */
+
+/**
+ * @brief What a trigger is run on
+ */
+typedef enum
+{
+  T_NONE = -1, /*!< No trigger */
+  T_DEATH,     /*!< An enemy dies: its object goes to its space */
+  T_BROKEN,    /*!< An object has no durability left: it leaves the inventory */
+  T_LIGHT      /*!< A space keeps its light by day and by night */
+} T_Trigger;
+
+typedef struct _Triggers Triggers; /*!< It defines the triggers of a map */
+
+/**
+ * @brief Allocates memory for a new, empty set of triggers
+ * @author Ignacio Nunez
+ *
+ * @return a pointer to the new triggers or NULL if anything went wrong
+ */
+Triggers *trigger_create();
+
+/**
+ * @brief Frees the previously allocated memory for some triggers
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to target triggers
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS trigger_destroy(Triggers *t);
+
+/**
+ * @brief Adds a trigger
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @param type what it is run on
+ * @param subject enemy, object or space it is run for
+ * @param object object dropped, T_DEATH only, NO_ID otherwise
+ * @param space space the object is dropped in, T_DEATH only, NO_ID otherwise
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS trigger_add(Triggers *t, T_Trigger type, Id subject, Id object, Id space);
+
+/**
+ * @brief Gets the number of triggers
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @return number of triggers, or -1 if there was any mistake
+ */
+int trigger_get_count(Triggers *t);
+
+/**
+ * @brief Finds the next trigger of an element
+ * @author Ignacio Nunez
+ *
+ * To go through all the triggers of an element, start with from = 0 and
+ * go on from the one found plus one.
+ *
+ * @param t a pointer to the triggers
+ * @param type what it is run on, T_NONE for any
+ * @param subject enemy, object or space, NO_ID for any
+ * @param from first trigger looked at
+ * @return the trigger, or -1 if there are no more
+ */
+int trigger_find(Triggers *t, T_Trigger type, Id subject, int from);
+
+/**
+ * @brief Gets what a trigger is run on
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @param i trigger
+ * @return the type, or T_NONE if there was any mistake
+ */
+T_Trigger trigger_get_type(Triggers *t, int i);
+
+/**
+ * @brief Gets the element a trigger is run for
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @param i trigger
+ * @return the enemy, object or space, or NO_ID if there was any mistake
+ */
+Id trigger_get_subject(Triggers *t, int i);
+
+/**
+ * @brief Gets the object a trigger drops
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @param i trigger
+ * @return the object, or NO_ID if it has none or there was any mistake
+ */
+Id trigger_get_object(Triggers *t, int i);
+
+/**
+ * @brief Gets the space a trigger drops its object in
+ * @author Ignacio Nunez
+ *
+ * @param t a pointer to the triggers
+ * @param i trigger
+ * @return the space, or NO_ID if it has none or there was any mistake
+ */
+Id trigger_get_space(Triggers *t, int i);
+
+/**
+ * @brief Gets what a trigger is run on by its name in the map file
+ * @author Ignacio Nunez
+ *
+ * @param name name: death, broken or light
+ * @return the type, or T_NONE if there is none with that name
+ */
+T_Trigger trigger_get_type_byName(char *name);
+
+/**
+ * @brief Prints the triggers in the save file
+ * @author Ignacio Nunez
+ *
+ * @param filename save file
+ * @param t a pointer to the triggers
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS trigger_print_save(char *filename, Triggers *t);
+
+#endif
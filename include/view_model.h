@@ -0,0 +1,189 @@
+/**
+ * @brief It defines the view of a game, the data the graphic engine paints
+ *
+ * A view is built once per turn from the game and holds copies of
+ * everything the screen shows, so drawing code never goes back to the game
+ * and the renderer can be tested without a screen.
+ *
+ * @file view_model.h
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef VIEW_MODEL_H
+#define VIEW_MODEL_H
+
+#include "types.h"
+#include "game.h"
+#include "space.h"
+#include "player.h"
+#include "enemy.h"
+#include "object.h"
+#include "link.h"
+
+#define VIEW_NAME_PAD 15     /*!< Width space names are padded to inside the map boxes */
+#define VIEW_NAME_LEN 40     /*!< Maximun length of a space name in a view */
+#define VIEW_MAX_LINKS 6     /*!< Number of links (one per direction) a space can have */
+#define VIEW_HIDDEN_SPACE 16 /*!< Space that can not be seen during the day */
+#define VIEW_CELL_NAME 6     /*!< Characters of a space name shown in the minimap */
+#define VIEW_CELL_LINKS 4    /*!< Directions (N, S, E, W) a space links to in the minimap */
+#define VIEW_LOG 6           /*!< Lines of scrollback of the dialogue and of the events */
+#define VIEW_LOG_LEN DIALOGUE_LOG_LEN /*!< Maximun length of one of those lines */
+
+/**
+ * @brief Spaces of a view, the current one and its neighbours
+ */
+typedef enum
+{
+  V_ACT,   /*!< Space of the player */
+  V_NORTH, /*!< Space to the north */
+  V_SOUTH, /*!< Space to the south */
+  V_EAST,  /*!< Space to the east */
+  V_WEST,  /*!< Space to the west */
+  V_SPACES /*!< Number of spaces in a view */
+} View_slot;
+
+/**
+ * @brief Areas of the screen that are painted again only when their part of a view changes
+ */
+typedef enum
+{
+  VA_MAP,      /*!< Map or minimap, from space to cells */
+  VA_DESCRIPT, /*!< Description, from player_location to game_over */
+  VA_DIALOGUE, /*!< Dialogue and events, from n_dialogue to the end */
+  V_AREAS      /*!< Number of areas of a view */
+} View_area;
+
+/**
+ * @brief A space as it is shown in the map
+ */
+typedef struct
+{
+  Id id;                                        /*!< Id of the space, NO_ID if there is none */
+  char name[VIEW_NAME_LEN + 1];                 /*!< Name padded to VIEW_NAME_PAD characters */
+  char gdesc[TAM_GDESC_Y][TAM_GDESC_X + 1];     /*!< Graphic description */
+  Light light;                                  /*!< Light status of the space */
+  BOOL object;                                  /*!< TRUE if any of its objects can be seen */
+  BOOL hidden;                                  /*!< TRUE if it can not be seen now */
+} View_space;
+
+/**
+ * @brief A space of the floor of the player, as it is shown in the minimap
+ */
+typedef struct
+{
+  Id id;                                        /*!< Id of the space */
+  char name[VIEW_CELL_NAME + 1];                /*!< First characters of its name */
+  Id next[VIEW_CELL_LINKS];                     /*!< Space its link goes to in each direction, NO_ID if none */
+  Light light;                                  /*!< Light status of the space */
+  BOOL hidden;                                  /*!< TRUE if it can not be seen now */
+} View_cell;
+
+/**
+ * @brief An enemy as it is listed in the description
+ */
+typedef struct
+{
+  Id location;                      /*!< Where the enemy is */
+  int health;                       /*!< Its health */
+  char name[ENEMY_LEN_NAME + 1];    /*!< Its name */
+} View_enemy;
+
+/**
+ * @brief A closed link as it is listed in the description
+ */
+typedef struct
+{
+  DIRECTION direction;              /*!< Direction the link goes */
+  char name[LINK_NAME_LEN + 1];     /*!< Its name */
+} View_link;
+
+/**
+ * @brief View of a game
+ *
+ * Plain data, it does not point to anything inside the game.
+ * view_model_changed compares each View_area as the bytes from its first
+ * field up to the first field of the next block, so the fields of an area
+ * must stay together and in the block of that area. last_cmd and st are
+ * in no area, the feedback is painted every turn.
+ */
+typedef struct
+{
+  /* VA_MAP, space must stay first and cells last */
+  View_space space[V_SPACES];                             /*!< Current space and its neighbours */
+  BOOL open[VIEW_MAX_LINKS];                              /*!< TRUE if the link of the current space in that direction is open */
+  BOOL enemy_here;                                        /*!< TRUE if an enemy is drawn in the current space */
+  char enemy_gdesc[ENEMY_GDESC_Y][ENEMY_GDESC_X + 1];     /*!< Graphic description of that enemy */
+  Floor floor;                                            /*!< Floor of the current space */
+  int n_cells;                                            /*!< Number of spaces in that floor */
+  View_cell cells[MAX_SPACES];                            /*!< Those spaces, in the order of the game */
+
+  /* VA_DESCRIPT, player_location must stay first and game_over last */
+  Id player_location;                                     /*!< Location of the player */
+  int player_health;                                      /*!< Health of the player */
+  char player_gdesc[PLAYER_GDESC_Y][PLAYER_GDESC_X + 1];  /*!< Graphic description of the player */
+  int n_objects;                                          /*!< Number of visible objects in the current space */
+  char objects[MAX_OBJS][OBJ_NAME_LEN + 1];               /*!< Their names */
+  int n_inventory;                                        /*!< Number of objects the player carries */
+  char inventory[MAX_OBJS][OBJ_NAME_LEN + 1];             /*!< Their names */
+  int n_enemies;                                          /*!< Number of enemies in the game */
+  View_enemy enemies[MAX_ENEMYS];                         /*!< All of them */
+  int n_closed;                                           /*!< Number of named closed links of the current space */
+  View_link closed[VIEW_MAX_LINKS];                       /*!< Those links */
+  char description[WORD_SIZE + 1];                        /*!< Brief description of the current space */
+  BOOL has_inspection;                                    /*!< TRUE if there is an inspection to show */
+  char inspection[WORD_SIZE + 1];                         /*!< Text of the inspection */
+  Time time;                                              /*!< Day or night */
+  BOOL game_over;                                         /*!< TRUE if the game has finished */
+
+  /* No area, last_cmd must stay first */
+  T_Command last_cmd;                                     /*!< Last command */
+  int st;                                                 /*!< Status of the last command */
+  /* VA_DIALOGUE, n_dialogue must stay first and the area ends with the view */
+  int n_dialogue;                                         /*!< Number of dialogue lines, the newest is the last one */
+  char dialogue[VIEW_LOG][VIEW_LOG_LEN + 1];              /*!< Their text */
+  int n_events;                                           /*!< Number of event lines, the newest is the last one */
+  char events[VIEW_LOG][VIEW_LOG_LEN + 1];                /*!< Their text */
+} View;
+
+/**
+ * @brief Builds the view of a game
+ * @author Ignacio Nunez
+ *
+ * Every field of the view is written (unused bytes are zeroed), so two
+ * views of the same game compare equal with memcmp.
+ * @param view pointer to the view to fill
+ * @param game pointer to the game
+ * @param st status of the last command (0 ERROR, 1 OK, other not shown)
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS view_model_build(View *view, Game *game, int st);
+
+/**
+ * @brief Rebuilds the parts of a view that change every turn
+ * @author Ignacio Nunez
+ *
+ * Those are the last command, its status, the inspection, the dialogue
+ * and the event. The rest of the view is left as it was, which is enough
+ * while game_get_epoch has not changed since it was built.
+ * @param view pointer to a view already built from this game
+ * @param game pointer to the game
+ * @param st status of the last command (0 ERROR, 1 OK, other not shown)
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS view_model_build_turn(View *view, Game *game, int st);
+
+/**
+ * @brief Checks if an area of a view differs from another view
+ * @author Ignacio Nunez
+ *
+ * @param old pointer to the view painted last
+ * @param view pointer to the new view
+ * @param area area to compare
+ * @return TRUE if that area differs, FALSE if it does not or the arguments are wrong
+ */
+BOOL view_model_changed(const View *old, const View *view, View_area area);
+
+#endif
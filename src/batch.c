@@ -0,0 +1,266 @@
+/**
+ * @brief It defines a headless runner for command scripts
+ *
+ * Every script given is played in its own game, from the state the map
+ * is loaded with, without drawing anything. For every script one line is
+ * printed:
+ *
+ *   <script> turns=<n> errors=<n> digest=<hash> turn_ns=<min>/<avg>/<max>
+ *
+ * The digest is a FNV-1a hash of the final state of the game
+ * (game_state_write), so two runs end the same way if their digest is equal.
+ * Commands are played BATCH_CHUNK at a time with game_update_batch, which
+ * times every turn on its own.
+ * The map file is read only once, the next games restore its state.
+ *
+ * @file batch.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers and Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/game.h"
+#include "../include/command.h"
+#include "../include/game_managment.h"
+#include "../include/script.h"
+
+#define BATCH_SEED 0   /*!< Default seed, so every run is repeatable */
+#define BATCH_CHUNK 64 /*!< Commands given to game_update_batch at once */
+
+/**
+ * @brief Result of a script
+ */
+typedef struct
+{
+  long turns;            /*!< Commands played */
+  long errors;           /*!< Commands that returned ERROR */
+  unsigned long digest;  /*!< Hash of the final state */
+  long min_ns;           /*!< Fastest turn */
+  long max_ns;           /*!< Slowest turn */
+  double total_ns;       /*!< Time of all the turns */
+} Batch_result;
+
+/**
+ * Private functions
+ */
+STATUS batch_play(Game *game, Script *script, unsigned char *initial, long initial_len, unsigned long seed, Batch_result *res);
+unsigned long batch_digest(Game *game);
+void batch_print(const char *name, Batch_result *res);
+void print_syntaxinfo(char *argv[]);
+
+/**
+ * @brief Main function of the batch runner
+ * @author Miguel Soto
+ *
+ * @param argc number of arguments
+ * @param argv arguments: the data file, optionally "-s <seed>" and the scripts.
+ * If there are no scripts, commands are read from the standard input.
+ * @return 0 if every script was played, 1 if there was an error
+ */
+int main(int argc, char *argv[])
+{
+  Game *game = NULL;
+  unsigned char *initial = NULL;
+  long initial_len;
+  unsigned long seed = BATCH_SEED;
+  Batch_result res;
+  Script *script = NULL;
+  int i, first, played = 0, ret = 0;
+
+  if (argc < 2)
+  {
+    print_syntaxinfo(argv);
+    return 1;
+  }
+
+  first = 2;
+  if (argc > 3 && strcmp(argv[2], "-s") == 0)
+  {
+    seed = strtoul(argv[3], NULL, 10);
+    first = 4;
+  }
+
+  game = game_alloc2();
+  if (!game || game_create_from_file(game, argv[1]) == ERROR)
+  {
+    fprintf(stderr, "Error while loading %s.\n", argv[1]);
+    game_destroy(game);
+    return 1;
+  }
+
+  /* Copy of the state of the map, restored before every script */
+  initial_len = game_state_write(game, NULL, 0);
+  initial = (unsigned char *)malloc(initial_len);
+  if (!initial || game_state_write(game, initial, initial_len) != initial_len)
+  {
+    fprintf(stderr, "Error saving memory for the state of the game.\n");
+    free(initial);
+    game_destroy(game);
+    return 1;
+  }
+
+  for (i = first; i < argc || (first == argc && !played); i++)
+  {
+    script = script_load((i < argc) ? argv[i] : NULL);
+    played++;
+    if (!script)
+    {
+      fprintf(stderr, "Error opening %s.\n", (i < argc) ? argv[i] : "stdin");
+      ret = 1;
+      continue;
+    }
+
+    if (batch_play(game, script, initial, initial_len, seed, &res) == ERROR)
+    {
+      fprintf(stderr, "Error playing %s.\n", (i < argc) ? argv[i] : "stdin");
+      ret = 1;
+    }
+    else
+    {
+      batch_print((i < argc) ? argv[i] : "stdin", &res);
+    }
+
+    script_destroy(script);
+  }
+
+  free(initial);
+  game_destroy(game);
+
+  return ret;
+}
+
+/**
+ * @brief Plays a script from the initial state of the game
+ * @author Ignacio Nunez
+ *
+ * The script ends with its last line or with the exit command.
+ *
+ * @param game pointer to the game
+ * @param script commands of the script
+ * @param initial state the game starts from
+ * @param initial_len size of initial
+ * @param seed seed of the game
+ * @param res where the result is saved
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS batch_play(Game *game, Script *script, unsigned char *initial, long initial_len, unsigned long seed, Batch_result *res)
+{
+  Game_command cmds[BATCH_CHUNK];
+  int st[BATCH_CHUNK];
+  long ns[BATCH_CHUNK];
+  T_Command cmd = NO_CMD;
+  long i = 0;
+  int n, j;
+
+  if (game_state_read(game, initial, initial_len) == ERROR || game_set_seed(game, seed) == ERROR)
+  {
+    return ERROR;
+  }
+
+  res->turns = 0;
+  res->errors = 0;
+  res->min_ns = 0;
+  res->max_ns = 0;
+  res->total_ns = 0;
+
+  while (cmd != EXIT && i < script_get_count(script))
+  {
+    /* The chunk ends with the script or with the exit command */
+    for (n = 0; n < BATCH_CHUNK && cmd != EXIT && i < script_get_count(script); n++, i++)
+    {
+      cmd = script_get(script, i, cmds[n].arg1, cmds[n].arg2);
+      cmds[n].cmd = cmd;
+    }
+
+    if (game_update_batch(game, cmds, n, st, ns) != n)
+    {
+      return ERROR;
+    }
+
+    for (j = 0; j < n; j++, res->turns++)
+    {
+      if (st[j] == 0)
+      {
+        res->errors++;
+      }
+      if (res->turns == 0 || ns[j] < res->min_ns)
+      {
+        res->min_ns = ns[j];
+      }
+      if (ns[j] > res->max_ns)
+      {
+        res->max_ns = ns[j];
+      }
+      res->total_ns += (double)ns[j];
+    }
+  }
+
+  res->digest = batch_digest(game);
+
+  return OK;
+}
+
+/**
+ * @brief Hashes the state of the game with FNV-1a (32 bits)
+ * @author Ignacio Nunez
+ *
+ * @param game pointer to the game
+ * @return the hash, or 0 if there was any mistake
+ */
+unsigned long batch_digest(Game *game)
+{
+  unsigned char *buf = NULL;
+  unsigned long hash = 2166136261UL;
+  long len, i;
+
+  len = game_state_write(game, NULL, 0);
+  if (len < 0)
+  {
+    return 0;
+  }
+
+  buf = (unsigned char *)malloc(len);
+  if (!buf)
+  {
+    return 0;
+  }
+
+  game_state_write(game, buf, len);
+  for (i = 0; i < len; i++)
+  {
+    hash ^= buf[i];
+    hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+  }
+  free(buf);
+
+  return hash;
+}
+
+/**
+ * @brief Prints the result of a script
+ */
+void batch_print(const char *name, Batch_result *res)
+{
+  fprintf(stdout, "%s turns=%ld errors=%ld digest=%08lx turn_ns=%ld/%ld/%ld\n",
+          name, res->turns, res->errors, res->digest, res->min_ns,
+          res->turns ? (long)(res->total_ns / res->turns) : 0L, res->max_ns);
+}
+
+/**
+ * @brief Prints syntax info when running the  program.
+ * @author Miguel Soto
+ *
+ * @param argv Arguments from the command used to execute program.
+ */
+void print_syntaxinfo(char *argv[])
+{
+  fprintf(stderr, "\nUse: %s <game_data_file> [-s <seed>] [<command_file> ...]\n", argv[0]);
+  fprintf(stderr, "Every command file is played in a new game without drawing it.\n");
+  fprintf(stderr, "Without command files, commands are read from the standard input.\n \n");
+}
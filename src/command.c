@@ -15,14 +15,17 @@
 #include <string.h>
 #include <strings.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include "../include/command.h"
 
 #define CMD_LENGHT 30 /*!< It defines the maximun lenght from an input command */
+#define CMD_HASH_SIZE 64 /*!< It defines the number of slots of the table of command names, a power of 2 */
+#define CMD_HASH(first, last, len) ((2 * (first) + 4 * (last) + 3 * (len)) & (CMD_HASH_SIZE - 1)) /*!< Slot of a name, from its first and last chars in lower case and its length */
 
 /**
  * @brief Two dimensional string array where commands names are included. When reading commands case sensitivity is off.
  */
-char *cmd_to_str[N_CMD]
+static const char *cmd_to_str[N_CMD]
 [N_CMDT] = {{"", "No command"},    /*!< At the beginning, there is no commands */
       {"", "Unknown"},             /*!< If an empty or unknown string is received, it is interpreted as Unknown */
       {"e", "Exit"},               /*!< If an "e" or "exit" is received, it is interpreted as Exit */
@@ -36,13 +39,31 @@ char *cmd_to_str[N_CMD]
       {"ton", "Turnon"},           /*!< If a "ton" or "Turnon" is received, it is interpreted as Turnon */
       {"toff", "Turnoff"},         /*!< If a "toff" or "Turnoff" is received, it is interpreted as Turnoff */
       {"o", "Open"},               /*!< If an "o" or "Open" is received, it is interpreted as Open */
-      {"u", "Use"}                 /*!< If an "u" or "Use" is received, it is interpreted as Use */
+      {"u", "Use"},                /*!< If an "u" or "Use" is received, it is interpreted as Use */
+      {"mp", "Map"}                /*!< If a "mp" or "Map" is received, it is interpreted as Map */
       };
 
+/**
+ * @brief Perfect hash of the names of cmd_to_str. The slot CMD_HASH of a name has
+ * i * N_CMDT + type, where cmd_to_str[i][type] is that name, and -1 if no name falls there.
+ * No two names share a slot, so a word is compared with one name at most.
+ * If a name is added or changed this table has to be written again (command_test checks it).
+ */
+static const signed char cmd_hash[CMD_HASH_SIZE] = {
+     11,  26,  -1,  -1,  -1,  -1,  17,  27,  /* Attack, u, -, -, -, -, Save, Use */
+      7,  10,  -1,  18,  22,  -1,  -1,  -1,  /* Take, a, -, l, toff, -, -, - */
+     -1,  12,  -1,  -1,   9,  23,  -1,  -1,  /* -, m, -, -, Drop, Turnoff, -, - */
+     -1,  -1,  -1,   8,  -1,  24,  -1,  -1,  /* -, -, -, d, -, o, -, - */
+     28,   4,  25,  29,  -1,  -1,   5,  -1,  /* mp, e, Open, Map, -, -, Exit, - */
+     -1,  20,  -1,  -1,  -1,  -1,  -1,  -1,  /* -, ton, -, -, -, -, -, - */
+     -1,  -1,  21,  -1,  19,  16,  -1,  15,  /* -, -, Turnon, -, Load, s, -, Inspect */
+     -1,  14,  13,   6,  -1,  -1,  -1,  -1}; /* -, i, Move, t, -, -, -, - */
+
 /**
  * Funciones privadas
  */
 void print_syntax_command(T_Command cmd);
+const char *command_next_word(const char *line, char *word, int size);
 
 /**It scans the cmd searching for key words introduced by the user 
   *in order to interpret and clasify the info
@@ -51,7 +72,6 @@ T_Command command_get_user_input(char *arg1, char *arg2)
 {
   T_Command cmd = NO_CMD; 
   char input[CMD_LENGHT] = "", aux[CMD_LENGHT] = "\0";
-  int i = UNKNOWN - NO_CMD + 1;
   
   /* Error control*/
   if (!arg1 || !arg2)
@@ -59,39 +79,28 @@ T_Command command_get_user_input(char *arg1, char *arg2)
     return NO_CMD;
   }
   
-  if (scanf("%s", input) > 0)
+  if (scanf("%29s", input) > 0)
   {
-    cmd = UNKNOWN;
-    while (cmd == UNKNOWN && i < N_CMD)     /*!< Condition to continue reading */
+    cmd = command_lookup(input);
+    if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == LOAD || cmd == TURNON || cmd == TURNOFF || cmd == USE)
     {
-      if (!strcasecmp(input, cmd_to_str[i][CMDS]) || !strcasecmp(input, cmd_to_str[i][CMDL]))
+      if (scanf("%s", arg1) < 0)
       {
-        cmd = i + NO_CMD;                   /*!< If any differences are detected between CMDS, CMDL and the input, cmd is modified */
-        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == LOAD || cmd == TURNON || cmd == TURNOFF || cmd == USE)
-        {
-          if (scanf("%s", arg1) < 0)
-          {
-            print_syntax_command(cmd);
-          }
-        }
-        else if (cmd == OPEN)
-        {
-          if (scanf("%s %s %s", arg1, aux, arg2) != 3)
-          {
-            print_syntax_command(cmd);
-          }
-
-          strncat(aux, "\0", 1);
-          if (strcasecmp("with\0", aux) != 0)
-          {
-            print_syntax_command(cmd);
-            return UNKNOWN;
-          }
-        }
+        print_syntax_command(cmd);
       }
-      else                                  /*!< In any other case, continue reading >! */
+    }
+    else if (cmd == OPEN)
+    {
+      if (scanf("%s %s %s", arg1, aux, arg2) != 3)
+      {
+        print_syntax_command(cmd);
+      }
+
+      strncat(aux, "\0", 1);
+      if (strcasecmp("with\0", aux) != 0)
       {
-        i++;                                 
+        print_syntax_command(cmd);
+        return UNKNOWN;
       }
     }
   }
@@ -103,7 +112,7 @@ T_Command command_get_file_input(char *command, char *arg)
 {
   T_Command cmd = NO_CMD; 
   char input[CMD_LENGHT] = "";
-  int i = UNKNOWN - NO_CMD + 1, j = 0, z = 0;
+  int j = 0, z = 0;
   
   /* Error control*/
   if (!arg)
@@ -114,51 +123,163 @@ T_Command command_get_file_input(char *command, char *arg)
   if (command != NULL)
   {
     cmd = UNKNOWN;
-    for (j = 0; command[j] != ' '; j++) { /*Reads first part of command*/
+    for (j = 0; j < CMD_LENGHT - 1 && command[j] != ' ' && command[j] != '\n' && command[j] != '\0'; j++) { /*Reads first part of command*/
       input[j] = command[j];
     }
     input[j] = '\0';
-    while (cmd == UNKNOWN && i < N_CMD)     /*!< Condition to continue reading */
+    cmd = command_lookup(input);
+    if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT)
     {
-      if (!strcasecmp(input, cmd_to_str[i][CMDS]) || !strcasecmp(input, cmd_to_str[i][CMDL]))
+      z = 0;
+      if (command[j] == ' ')
       {
-        cmd = i + NO_CMD;                   /*!< If any differences are detected between CMDS, CMDL and the input, cmd is modified */
-        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT)
-        {
-          for (j++, z = 0; command[j] != ' '; j++, z++) { /*Reads the second argument of command and saves it in arg*/ 
-            arg[z] = command[j];
-          } 
-          arg[z] = '\0';
-          if (arg == NULL)
-          {
-            fprintf(stdout, "Comando incorrecto. Los comandos TAKE DROP INSPECT MOVE USE OPEN necesitan un argumento mas como el nombre del objeto .\n");
-          }
+        for (j++; z < MAX_ARG - 1 && command[j] != ' ' && command[j] != '\n' && command[j] != '\0'; j++, z++) { /*Reads the second argument of command and saves it in arg*/ 
+          arg[z] = command[j];
         }
-        /*
-        else if (cmd == OPEN)
-        {
-          if (scanf("%s %s %s", arg[0], arg[1], arg[2]) != 3)
-          {
-            print_syntax_command(cmd);
-          }
-          if (strcasecmp("with\0", arg[1]) != 0)
-          {
-            print_syntax_command(cmd);
-            return UNKNOWN;
-          }
-        }
-        */
       }
-      else                                  /*!< In any other case, continue reading >! */
+      arg[z] = '\0';
+      if (arg == NULL)
       {
-        i++;
+        fprintf(stdout, "Comando incorrecto. Los comandos TAKE DROP INSPECT MOVE USE OPEN necesitan un argumento mas como el nombre del objeto .\n");
       }
     }
+    /*
+    else if (cmd == OPEN)
+    {
+      if (scanf("%s %s %s", arg[0], arg[1], arg[2]) != 3)
+      {
+        print_syntax_command(cmd);
+      }
+      if (strcasecmp("with\0", arg[1]) != 0)
+      {
+        print_syntax_command(cmd);
+        return UNKNOWN;
+      }
+    }
+    */
   }
   
   return cmd;
 }
 
+/**
+ * Gets the name of a command
+ */
+const char *command_get_name(T_Command cmd, T_CmdType type)
+{
+  /* Error control*/
+  if (cmd < NO_CMD || cmd >= N_CMD + NO_CMD || (type != CMDS && type != CMDL))
+  {
+    return "";
+  }
+
+  return cmd_to_str[cmd - NO_CMD][type];
+}
+
+/**
+ * Finds the command of a name
+ */
+T_Command command_lookup(const char *name)
+{
+  int len, k;
+
+  /* Error control*/
+  if (!name)
+  {
+    return NO_CMD;
+  }
+
+  len = (int)strlen(name);
+  if (len == 0)
+  {
+    return UNKNOWN;
+  }
+
+  k = cmd_hash[CMD_HASH(tolower((unsigned char)name[0]), tolower((unsigned char)name[len - 1]), len)];
+  if (k < 0 || strcasecmp(name, cmd_to_str[k / N_CMDT][k % N_CMDT]) != 0)
+  {
+    return UNKNOWN;
+  }
+
+  return k / N_CMDT + NO_CMD;
+}
+
+/**
+ * Interprets a whole command line
+ */
+T_Command command_get_line_input(const char *line, char *arg1, char *arg2)
+{
+  T_Command cmd = NO_CMD;
+  char input[CMD_LENGHT] = "", aux[CMD_LENGHT] = "";
+
+  /* Error control*/
+  if (!line || !arg1 || !arg2)
+  {
+    return NO_CMD;
+  }
+
+  arg1[0] = '\0';
+  arg2[0] = '\0';
+
+  line = command_next_word(line, input, CMD_LENGHT);
+  if (input[0] == '\0')
+  {
+    return NO_CMD;
+  }
+
+  cmd = command_lookup(input);
+
+  if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == SAVE || cmd == LOAD || cmd == TURNON || cmd == TURNOFF || cmd == USE)
+  {
+    command_next_word(line, arg1, MAX_ARG);
+  }
+  else if (cmd == OPEN)
+  {
+    line = command_next_word(line, arg1, MAX_ARG);
+    line = command_next_word(line, aux, CMD_LENGHT);
+    command_next_word(line, arg2, MAX_ARG);
+
+    if (strcasecmp("with", aux) != 0 || arg2[0] == '\0')
+    {
+      return UNKNOWN;
+    }
+  }
+
+  return cmd;
+}
+
+/**
+ * @brief Copies the next word of a line
+ * @author Miguel Soto
+ *
+ * Blanks before the word are skipped and the word is truncated to size - 1 chars.
+ *
+ * @param line string where the word is read from
+ * @param word string where the word is saved ("" if there are no more words)
+ * @param size size of word
+ * @return pointer to the rest of the line
+ */
+const char *command_next_word(const char *line, char *word, int size)
+{
+  int n = 0;
+
+  while (*line == ' ' || *line == '\t' || *line == '\r' || *line == '\n')
+  {
+    line++;
+  }
+
+  for (; *line != '\0' && *line != ' ' && *line != '\t' && *line != '\r' && *line != '\n'; line++)
+  {
+    if (n < size - 1)
+    {
+      word[n++] = *line;
+    }
+  }
+  word[n] = '\0';
+
+  return line;
+}
+
 /**
  * @brief Print syntax information of a given command
  * @author Miguel Soto
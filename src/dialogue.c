@@ -14,7 +14,9 @@
 #include <string.h>
 #include "../include/dialogue.h"
 
-char matrix_command[COMMAND_SIZE][WORD_SIZE] =
+#define DIALOGUE_TEXT_LEN (2 * WORD_SIZE)  /*!< Maximun length of a formatted message*/
+
+static const char matrix_command[COMMAND_SIZE][WORD_SIZE] =
 { " ",                                                                      /*!< DC_ERROR*/
   "Exiting game...",                                                        /*!< DC_EXIT*/   
   "You picked *",                                                           /*!< DC_TAKE*/      
@@ -53,7 +55,7 @@ char matrix_command[COMMAND_SIZE][WORD_SIZE] =
   "As soon as you took the Moon_Armor, the  Sun_Sword dissapeared, you should inspect it, you feel a lot stronger wearing it "
 };
 
-char matrix_event[EVENT_SIZE][WORD_SIZE] =
+static const char matrix_event[EVENT_SIZE][WORD_SIZE] =
 { "All seems ok",                                                           /*!< DE_NOTHING*/
   "This object was not here, someone moved it...",                          /*!< DE_MOVEOBJ*/
   "Be carefull! You stepped on spikes and lost 1 HP",                       /*!< DE_TRAP*/
@@ -63,7 +65,7 @@ char matrix_event[EVENT_SIZE][WORD_SIZE] =
   "You got lost and got back where you started"                             /*!< DE_SPAWN*/
 };
 
-char matrix_error[ERROR_SIZE][WORD_SIZE] =
+static const char matrix_error[ERROR_SIZE][WORD_SIZE] =
 { " ",                                                                      /*!< E_ERROR*/
   "Error exiting game...",                                                        /*!< E_EXIT*/   
   "You can't take that * (if it is a key, it might be unreachable)",                                                           /*!< E_TAKE*/      
@@ -84,47 +86,107 @@ char matrix_error[ERROR_SIZE][WORD_SIZE] =
   "You couldn't turn * off "                                             /*!< E_TOFF*/
 };
 
+/**
+ * @brief Where the '*' of a message of the matrices is
+ */
+typedef struct
+{
+    int prefix;    /*!< Characters before the '*', all of them if there is none*/
+    int suffix;    /*!< Characters after the '*', -1 if there is none*/
+} Dialogue_format;
+
 struct _Dialogue
 {
-    char *command;      /*!< Command´s dialogue*/
-    char *event;        /*!< Event´s dialogue*/
-    char *error;         /*!< Error´s dialogue*/
+    char *command;      /*!< Command´s dialogue (it points to command_text)*/
+    const char *event;  /*!< Event´s dialogue (it points to matrix_event)*/
+    char *error;         /*!< Error´s dialogue (it points to error_text)*/
+    char command_text[DIALOGUE_TEXT_LEN + 1];          /*!< Where the command´s dialogue is formatted*/
+    char error_text[DIALOGUE_TEXT_LEN + 1];            /*!< Where the error´s dialogue is formatted*/
+    Dialogue_format command_format[COMMAND_SIZE];      /*!< '*' of each message of matrix_command*/
+    Dialogue_format error_format[ERROR_SIZE];          /*!< '*' of each message of matrix_error*/
+    char log[DIALOGUE_LOG_SIZE][DIALOGUE_LOG_LEN + 1]; /*!< Scrollback of the last messages*/
+    DL_Kind log_kind[DIALOGUE_LOG_SIZE];               /*!< Kind of each of them*/
+    long n_log;         /*!< Messages kept so far, the newest is in slot (n_log - 1) % DIALOGUE_LOG_SIZE*/
 };
 
 /**
- * @brief Function that substitutes the * on each default dialogue by specific modifiers
+ * @brief Finds the '*' of every message of a matrix
+ * 
+ * @param format where the position of each '*' is kept
+ * @param matrix the messages
+ * @param n number of messages
+ */
+void dialogue_compile(Dialogue_format *format, const char matrix[][WORD_SIZE], int n);
+
+/**
+ * @brief Writes a message substituting its * by a modifier
+ * 
+ * @param dest buffer of DIALOGUE_TEXT_LEN + 1 characters
+ * @param format where the '*' of the message is
+ * @param str the message
+ * @param arg the modifier, NULL is taken as " "
+ * @return dest
+ */
+char *dialogue_format(char *dest, const Dialogue_format *format, const char *str, const char *arg);
+
+/**
+ * @brief Copies a message in the next slot of the scrollback
  * 
- * @param str given command string
- * @param arg Given argument
- * @return Modified command
+ * @param dialogue pointer to the dialogue
+ * @param kind kind of the message
+ * @param text the message
  */
-char *strmod(char *str, const char *arg);
+void dialogue_log_add(Dialogue *dialogue, DL_Kind kind, const char *text);
 
 
-char *strmod(char *str, const char *arg) {
-    char *res;
-    int k = 0;
+void dialogue_compile(Dialogue_format *format, const char matrix[][WORD_SIZE], int n)
+{
+    const char *star;
     int i;
 
-    if(!str){
-        return NULL;
+    for (i = 0; i < n; i++)
+    {
+        star = strchr(matrix[i], '*');
+        if (star == NULL)
+        {
+            format[i].prefix = (int)strlen(matrix[i]);
+            format[i].suffix = -1;
+        }
+        else
+        {
+            format[i].prefix = (int)(star - matrix[i]);
+            format[i].suffix = (int)strlen(star + 1);
+        }
     }
+}
 
-    if(arg == NULL){
-        arg = " ";
-    }
+char *dialogue_format(char *dest, const Dialogue_format *format, const char *str, const char *arg)
+{
+    int len, n;
+
+    n = format->prefix;
+    memcpy(dest, str, n);
 
-    res = (char *) malloc(strlen(str)+strlen(arg)+1);
-    for (i=0; i<strlen(str); i++) {
-        if (str[i] != '*') 
-            res[k++] = str[i];
-        else {
-            strcpy(res+k, arg);
-            k += strlen(arg);
+    if (format->suffix >= 0)
+    {
+        if (arg == NULL)
+        {
+            arg = " ";
         }
+
+        len = (int)strlen(arg);
+        if (len > DIALOGUE_TEXT_LEN - n - format->suffix)
+        {
+            len = DIALOGUE_TEXT_LEN - n - format->suffix;
+        }
+        memcpy(dest + n, arg, len);
+        n += len;
+        memcpy(dest + n, str + format->prefix + 1, format->suffix);
+        n += format->suffix;
     }
-    res[k] = 0;
-    return res;
+
+    dest[n] = '\0';
+    return dest;
 }
 
 
@@ -145,6 +207,11 @@ Dialogue *dialogue_create()
     new_dialogue->command = NULL;
     new_dialogue->event = NULL;
     new_dialogue->error = NULL;
+    new_dialogue->n_log = 0;
+
+    /* The messages are looked at once, formatting them is then only copying */
+    dialogue_compile(new_dialogue->command_format, matrix_command, COMMAND_SIZE);
+    dialogue_compile(new_dialogue->error_format, matrix_error, ERROR_SIZE);
     
     return new_dialogue;
 
@@ -158,13 +225,6 @@ STATUS dialogue_destroy(Dialogue *d)
     if (!d)
     return ERROR;
 
-    if(d->command != NULL){
-        free(d->command);
-    }
-    if(d->error != NULL){
-        free(d->error);
-    }
-
     free(d);
 
     return OK;
@@ -179,16 +239,9 @@ STATUS dialogue_reset(Dialogue *dialogue){
         return ERROR;
     }
 
-    if(dialogue->command != NULL){
-        free(dialogue->command);
-    }
-    if(dialogue->error != NULL){
-        free(dialogue->error);
-    }
-
-    dialogue->command = strmod(matrix_command[DC_ERROR], " ");
+    dialogue->command = dialogue_format(dialogue->command_text, &dialogue->command_format[DC_ERROR], matrix_command[DC_ERROR], " ");
     dialogue->event = matrix_event[DE_NOTHING];
-    dialogue->error = strmod(matrix_error[E_ERROR], " ");
+    dialogue->error = dialogue_format(dialogue->error_text, &dialogue->error_format[E_ERROR], matrix_error[E_ERROR], " ");
 
     return OK;
 }
@@ -209,65 +262,51 @@ char *dialogue_get_command(Dialogue *dialogue)
 */
 STATUS dialogue_set_command(Dialogue *dialogue, DC_Enum condition, Space *current_loc, Object *obj, Enemy *enemy)
 {
+    const char *arg = " ";
+
     /*Error control*/
-    if(dialogue == NULL){
+    if(dialogue == NULL || condition < 0 || condition >= COMMAND_SIZE){
         return ERROR;
     }
-  
-    if(dialogue->command!=NULL){
-        free(dialogue->command);
-    }
 
      if (condition == DC_TAKE || condition == DC_DROP || condition == DC_TON || condition == DC_TOFF){
         if(obj == NULL)
         {
-            dialogue->command = strmod(matrix_command[DC_PUZZLE], " ");   
+            condition = DC_PUZZLE;
         }
         else
         {
-            dialogue->command = strmod(matrix_command[condition], obj_get_name(obj) );
+            arg = obj_get_name(obj);
         }
          
      }
 
      else if (condition == DC_MOVE_N || condition == DC_MOVE_E || condition == DC_MOVE_S || condition == DC_MOVE_W || condition == DC_MOVE_U || condition == DC_MOVE_D){
         
-         dialogue->command = strmod(matrix_command[condition], space_get_name(current_loc));
+         arg = space_get_name(current_loc);
      }
 
      else if (condition == DC_ATTACK_HIT || condition == DC_ATTACK_MISSED || condition == DC_ATTACK_CRITICAL ){
         
-         dialogue->command = strmod(matrix_command[condition], enemy_get_name(enemy));
+         arg = enemy_get_name(enemy);
      }
 
      else if (condition == DC_INSPECT_O){
-         dialogue->command = strmod(matrix_command[condition], obj_get_description(obj));
+         arg = obj_get_description(obj);
      }
 
      else if (condition == DC_INSPECT_S){
-         dialogue->command = strmod(matrix_command[condition], space_get_long_description(current_loc));
+         arg = space_get_long_description(current_loc);
      }
-     
-     else
-     {
-        dialogue->command = strmod(matrix_command[condition], " ");      
-     }
-   
-    if(dialogue->command == NULL){
-        return ERROR;
-    }
+
+    dialogue->command = dialogue_format(dialogue->command_text, &dialogue->command_format[condition], matrix_command[condition], arg);
 
     return OK;
 }
-/**                     
-                 
-    DC_OPEN,                   
-                       
-    **/
 
 /** Gets the dialogue information after executing an event
 */
-char *dialogue_get_event(Dialogue *dialogue)
+const char *dialogue_get_event(Dialogue *dialogue)
 {
     /*Error control */
     if(dialogue == NULL){
@@ -303,32 +342,89 @@ char *dialogue_get_error(Dialogue *dialogue)
 
 STATUS dialogue_set_error(Dialogue *dialogue, E_Enum condition, Space *current_loc, Object *obj, Enemy *enemy)
 {
+    const char *arg = " ";
+
     /*Error control*/
-    if(dialogue == NULL){
+    if(dialogue == NULL || condition < 0 || condition >= ERROR_SIZE){
         return ERROR;
     }
-  
-    if(dialogue->error!=NULL){
-        free(dialogue->error);
-    }
 
      if (condition == E_TAKE || condition == E_DROP || condition == E_TON || condition == E_TOFF){
         
-            dialogue->error = strmod(matrix_error[condition], obj_get_name(obj) );
+            arg = obj_get_name(obj);
         }
      else if (condition == E_MOVE_N || condition == E_MOVE_E || condition == E_MOVE_S || condition == E_MOVE_W || condition == E_MOVE_U || condition == E_MOVE_D){
         
-         dialogue->error = strmod(matrix_error[condition], space_get_name(current_loc));
+         arg = space_get_name(current_loc);
      }
 
-     else
-     {
-        dialogue->error = strmod(matrix_error[condition], " ");      
-     }
-   
-    if(dialogue->error == NULL){
+    dialogue->error = dialogue_format(dialogue->error_text, &dialogue->error_format[condition], matrix_error[condition], arg);
+
+    return OK;
+}
+
+/** Keeps the messages of the turn in the scrollback
+*/
+STATUS dialogue_log_turn(Dialogue *dialogue)
+{
+    /*Error control*/
+    if(dialogue == NULL){
         return ERROR;
     }
 
+    /* A message of " " means there was none */
+    if(dialogue->error != NULL && strcmp(dialogue->error, matrix_error[E_ERROR]) != 0){
+        dialogue_log_add(dialogue, DL_ERROR, dialogue->error);
+    }
+    else if(dialogue->command != NULL && strcmp(dialogue->command, matrix_command[DC_ERROR]) != 0){
+        dialogue_log_add(dialogue, DL_COMMAND, dialogue->command);
+    }
+
+    if(dialogue->event != NULL && dialogue->event != matrix_event[DE_NOTHING]){
+        dialogue_log_add(dialogue, DL_EVENT, dialogue->event);
+    }
+
     return OK;
 }
+
+/** Gets the number of messages in the scrollback
+*/
+int dialogue_log_get_count(Dialogue *dialogue)
+{
+    /*Error control*/
+    if(dialogue == NULL){
+        return -1;
+    }
+
+    return dialogue->n_log < DIALOGUE_LOG_SIZE ? (int)dialogue->n_log : DIALOGUE_LOG_SIZE;
+}
+
+/** Gets a message of the scrollback
+*/
+const char *dialogue_log_get(Dialogue *dialogue, int age, DL_Kind *kind)
+{
+    int slot;
+
+    /*Error control*/
+    if(dialogue == NULL || age < 0 || age >= dialogue_log_get_count(dialogue)){
+        return NULL;
+    }
+
+    slot = (int)((dialogue->n_log - 1 - age) % DIALOGUE_LOG_SIZE);
+    if(kind != NULL){
+        *kind = dialogue->log_kind[slot];
+    }
+
+    return dialogue->log[slot];
+}
+
+void dialogue_log_add(Dialogue *dialogue, DL_Kind kind, const char *text)
+{
+    int slot;
+
+    slot = (int)(dialogue->n_log % DIALOGUE_LOG_SIZE);
+    strncpy(dialogue->log[slot], text, DIALOGUE_LOG_LEN);
+    dialogue->log[slot][DIALOGUE_LOG_LEN] = '\0';
+    dialogue->log_kind[slot] = kind;
+    dialogue->n_log++;
+}
@@ -29,8 +29,12 @@ struct _Enemy
   int Crit_dmg;               /*!< Enemy's crit chance (scale 0 to 10) */
   int base_dmg;               /*!< Enemy's base damage */
   char **gdesc;   /*!< Graphic visualization enemy */
+  unsigned long *epoch; /*!< Change counter of the game it belongs to, NULL if none */
 } ;
 
+/*Private functions*/
+void enemy_touch(Enemy *enemy);
+
 /**enemy_create allocates memory for a new enemy and initializes all its members .
  */
 Enemy *enemy_create(Id id)
@@ -57,6 +61,8 @@ Enemy *enemy_create(Id id)
   new_enemy->location = NO_ID;
   new_enemy->gdesc = NULL;
 
+  new_enemy->epoch = NULL;
+
   return new_enemy;
 }
 
@@ -179,6 +185,7 @@ STATUS enemy_set_health(Enemy *enemy, int health)
   } 
   
   enemy->health = health;
+  enemy_touch(enemy);
   return OK;
 }
  
@@ -194,6 +201,7 @@ STATUS enemy_set_location(Enemy *enemy, Id location)
   }
   
   enemy->location = location;
+  enemy_touch(enemy);
   return OK;
 }
 
@@ -217,6 +225,7 @@ STATUS enemy_set_name(Enemy *enemy, char *name)
     strcpy(enemy->name, name);
   }
   
+  enemy_touch(enemy);
   return OK;
 }
 
@@ -282,6 +291,7 @@ STATUS enemy_set_crit(Enemy *enemy, int crit){
   }
  enemy->Crit_dmg = crit;
 
+ enemy_touch(enemy);
  return OK;
 }
 
@@ -298,6 +308,7 @@ STATUS enemy_set_baseDmg(Enemy *enemy, int base_dmg){
   }
  enemy->base_dmg = base_dmg;
 
+ enemy_touch(enemy);
  return OK;
 } 
 
@@ -370,6 +381,7 @@ STATUS enemy_set_gdesc(Enemy *e, char **newgdesc)
 
   e->gdesc = newgdesc;
 
+  enemy_touch(e);
   return OK;
 }
 
@@ -383,3 +395,32 @@ char **enemy_get_gdesc(Enemy *e)
 
   return e->gdesc;
 }
+
+/** enemy_set_epoch sets the change counter the enemy bumps when it is modified
+ */
+STATUS enemy_set_epoch(Enemy *enemy, unsigned long *epoch)
+{
+  /* Error control */
+  if (!enemy)
+  {
+    return ERROR;
+  }
+
+  enemy->epoch = epoch;
+
+  return OK;
+}
+
+/**
+ * @brief Tells the game that an enemy changed
+ * @author Ignacio Nunez
+ *
+ * @param enemy pointer to the enemy
+ */
+void enemy_touch(Enemy *enemy)
+{
+  if (enemy->epoch)
+  {
+    (*enemy->epoch)++;
+  }
+}
@@ -9,6 +9,8 @@
  * @copyright GNU Public License
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -17,6 +19,10 @@
 #include "../include/game.h"
 #include "../include/game_managment.h"
 
+#define GAME_TIMERS 1 /*!< Number of timers in the wheel of the game */
+#define TIMER_EVENT 0 /*!< Timer of the next random event */
+#define LIGHT_RADIUS 1 /*!< Open links the light of a source goes through */
+
 /**
  * @brief Game
  * 
@@ -34,6 +40,15 @@ struct _Game
   T_Command last_cmd;          /*!< Last command input */
   R_Event last_event;          /*!< Last event */
   Dialogue *dialogue;          /*!< Text to print*/
+  Rng *rng;                    /*!< Random generator of the game (events and combat) */
+  Wheel *events;               /*!< Turn the next random event is due, its current turn is the one of the game */
+  Event_table *table;          /*!< Random events of the map */
+  Triggers *triggers;          /*!< Triggers of the map */
+  Space *lit_space;            /*!< Space the lit objects of the player were last counted in */
+  int lit_count;               /*!< Lit objects of the player counted in lit_space */
+  Space *floor_lit[MAX_OBJS];  /*!< Space each object lights lying in it, NULL if none */
+  unsigned long epoch;         /*!< Change counter, bumped every time anything shown changes */
+  BOOL realtime;               /*!< TRUE if events come with game_tick instead of with every command */
 } ;
 
 /**
@@ -41,6 +56,18 @@ struct _Game
 */
 int game_command_unknown(Game *game, char *arg);
 void game_get_new_event(Game *game);
+void game_set_event(Game *game);
+void game_trigger_death(Game *game, Enemy *enemy);
+void game_trigger_broken(Game *game, Object *obj);
+int game_count_lights(Game *game);
+void game_move_lights(Game *game, Space *space, int count);
+void game_light_object(Game *game, Object *obj);
+int game_light_area(Game *game, Space *source, Space **area, int *dist);
+void game_spread_light(Game *game, Space *source, int delta);
+BOOL game_light_through(Game *game, Space *source, Space *s);
+STATUS game_open_link(Game *game, Link *link);
+int game_update_turn(Game *game, T_Command cmd, char *arg1, char *arg2, BOOL *settled, unsigned long *settled_epoch);
+void game_update_bookkeeping(Game *game, BOOL *settled, unsigned long *settled_epoch);
 STATUS game_command_exit(Game *game, char *arg);
 STATUS game_command_take(Game *game, char *arg);
 STATUS game_command_drop(Game *game, char *arg);
@@ -54,11 +81,14 @@ STATUS game_command_turnon(Game *game, char *arg);
 STATUS game_command_turnoff(Game *game, char *arg);
 STATUS game_command_open(Game *game, char *link_name, char *obj_name);
 STATUS game_command_use(Game *game, char *arg);
+STATUS game_command_map(Game *game);
 STATUS game_event_move(Game *game);
 STATUS game_event_trap(Game *game);
 STATUS game_event_slime(Game *game);
 STATUS game_event_daynight(Game *game);
 STATUS game_event_spawn(Game *game);
+void game_state_put(unsigned char *buf, long max, long *pos, long value);
+long game_state_get(const unsigned char *buf, long len, long *pos, BOOL *ok);
 
 /**
  * Game interface implementation
@@ -84,6 +114,7 @@ STATUS game_alloc(Game *game)
     {
       return ERROR;
     }
+    player_set_epoch(game->player[i], &game->epoch);
   }
 
   for (i = 0; i < MAX_ENEMYS; i++)
@@ -93,6 +124,7 @@ STATUS game_alloc(Game *game)
     {
       return ERROR;
     }
+    enemy_set_epoch(game->enemy[i], &game->epoch);
   }
 
   game->inspection = " ";
@@ -121,6 +153,7 @@ STATUS game_create(Game *game)
   for (i = 0; i < MAX_OBJS; i++)
   {
     game->object[i] = NULL;
+    game->floor_lit[i] = NULL;
   }
 
   for (i = 0; i < MAX_PLAYERS; i++)
@@ -139,7 +172,10 @@ STATUS game_create(Game *game)
   }
 
   game->day_time = DAY;
+  game->lit_space = NULL;
+  game->lit_count = 0;
   game->last_cmd = NO_CMD;
+  game->epoch++;
   
   return OK;
 }
@@ -188,6 +224,10 @@ STATUS game_destroy(Game *game)
   }
 
   dialogue_destroy(game->dialogue);
+  rng_destroy(game->rng);
+  game_rules_wheel_destroy(game->events);
+  game_rules_table_destroy(game->table);
+  trigger_destroy(game->triggers);
 
   free(game);
   game = NULL;
@@ -225,6 +265,8 @@ STATUS game_add_space(Game *game, Space *space)
   }
 
   game->spaces[i] = space;
+  space_set_epoch(space, &game->epoch);
+  game->epoch++;
 
   return OK;
 }
@@ -253,6 +295,8 @@ STATUS game_add_object(Game *game, Object *obj)
   }
 
   game->object[i] = obj;
+  object_set_epoch(obj, &game->epoch);
+  game->epoch++;
 
   return OK;
 }
@@ -281,6 +325,8 @@ STATUS game_add_player(Game *game, Player *p)
   }
 
   game->player[i] = p;
+  player_set_epoch(p, &game->epoch);
+  game->epoch++;
 
   return OK;
 }
@@ -309,6 +355,8 @@ STATUS game_add_enemy(Game *game, Enemy *e)
   }
 
   game->enemy[i] = e;
+  enemy_set_epoch(e, &game->epoch);
+  game->epoch++;
 
   return OK;
 }
@@ -337,6 +385,8 @@ STATUS game_add_link(Game *game, Link *l)
   }
 
   game->links[i] = l;
+  link_set_epoch(l, &game->epoch);
+  game->epoch++;
 
   return OK;
 }
@@ -383,56 +433,19 @@ Space *game_get_space(Game *game, Id id)
  */
 STATUS game_set_time(Game *game, Time time)
 {
-  int i = 0;
-  Space *s = NULL;
-  Id id = NO_ID;
-
   if (!game || (time != DAY && time != NIGHT))
   {
     return ERROR;
   }
 
-  game->day_time = time;
-
-  if (time == NIGHT)
+  /* No space is touched, their light is worked out from the time when asked */
+  if (game->day_time != time)
   {
-    for (i = 0; i < MAX_SPACES; i++)
-    {
-      s = game->spaces[i];
-      id = space_get_id(s);
-
-      if (s != NULL)
-      {
-        if (id != 121 && id != 125)
-        {
-          if (space_set_light_status(s, DARK) == ERROR)
-          {
-            return ERROR;
-          }
-        } 
-      }
-    } 
-  } else 
-  {
-    for (i = 0; i < MAX_SPACES; i++)
-    {
-      s = game->spaces[i];
-      id = space_get_id(s);
+    game->epoch++;
+  }
+  game->day_time = time;
 
-      if (s != NULL)
-      {
-        if (id != 121 && id != 125)
-        {
-          if (space_set_light_status(s, BRIGHT) == ERROR)
-          {
-            return ERROR;
-          }
-        } 
-      }
-    }
-  }  
   return OK;
-
 }
 
 /** Gets if it is day or night
@@ -447,6 +460,68 @@ Time game_get_time(Game *game)
   return game->day_time;
 }
 
+/** Gets the light a space has now
+ */
+Light game_get_space_light(Game *game, Space *space)
+{
+  /* Error control */
+  if (!game || !space)
+  {
+    return UNKNOWN_LIGHT;
+  }
+
+  if (space_get_light_fixed(space) == TRUE)
+  {
+    return space_get_light_status(space);
+  }
+
+  return (game->day_time == DAY || space_get_light_sources(space) > 0) ? BRIGHT : DARK;
+}
+
+/** Spreads the light of every source of the game from scratch
+ */
+STATUS game_set_lights(Game *game)
+{
+  int i;
+
+  /* Error control */
+  if (!game)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  {
+    if (space_get_light_sources(game->spaces[i]) != 0)
+    {
+      space_set_light_sources(game->spaces[i], 0);
+    }
+  }
+
+  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  {
+    if (space_get_fire(game->spaces[i]) == TRUE)
+    {
+      game_spread_light(game, game->spaces[i], 1);
+    }
+  }
+
+  for (i = 0; i < MAX_OBJS; i++)
+  {
+    game->floor_lit[i] = NULL;
+  }
+  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  {
+    game_light_object(game, game->object[i]);
+  }
+
+  game->lit_space = NULL;
+  game->lit_count = 0;
+  game_move_lights(game, game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1])), game_count_lights(game));
+
+  return OK;
+}
+
 
 /**
  * Gets a game's object with target id
@@ -874,1384 +949,2407 @@ Id game_get_connection(Game *game, Id act_spaceid, DIRECTION dir)
   return dest_id;
 }
 
-/*Functions for the new event
-(just a continuation of game_update)*/
-void game_get_new_event(Game *game){
-
-  R_Event new_event = 0;
-  STATUS st = ERROR;
-
-  new_event = game_rules_get_event();
-  game->last_event = new_event;
+/**
+ * @brief Sets the timer of the random events to the next turn one happens
+ * @author Ignacio Nunez
+ *
+ * @param game a pointer to game
+ */
+void game_set_event(Game *game)
+{
+  int chance = game_rules_table_get_chance(game->table);
 
-  switch(new_event)
+  if (chance < 1)
   {
-    case MOVE_OBJ:
-      st = game_event_move(game);
-      break;
-
-    case TRAP:
-      st = game_event_trap(game);
-      break;
-
-    case SLIME:
-      st = game_event_slime(game);
-      break;
+    game_rules_wheel_stop(game->events, TIMER_EVENT);
+    return;
+  }
 
-    case DAYNIGHT:
-      st = game_event_daynight(game);
-      break;
+  game_rules_wheel_set(game->events, TIMER_EVENT, game_rules_wheel_get_now(game->events) + game_rules_get_delay(game->rng, chance));
+}
 
-    case SPAWN:
-      st = game_event_spawn(game);
-      break;
+/**
+ * @brief Runs the triggers of an enemy if it has just died
+ * @author Ignacio Nunez
+ *
+ * The objects it drops go to their spaces, unless they are already
+ * there, and the enemy leaves the map.
+ *
+ * @param game a pointer to game
+ * @param enemy a pointer to the enemy, after its health changed
+ */
+void game_trigger_death(Game *game, Enemy *enemy)
+{
+  Object *obj = NULL;
+  Space *s = NULL;
+  Id id = NO_ID;
+  int i;
 
-    default:
-      break;
+  if (!enemy || enemy_get_health(enemy) > 0 || enemy_get_location(enemy) == NO_ID)
+  {
+    return;
   }
 
-  if(st == ERROR){
-    game->last_event = NOTHING;
+  id = enemy_get_id(enemy);
+  for (i = trigger_find(game->triggers, T_DEATH, id, 0); i != -1; i = trigger_find(game->triggers, T_DEATH, id, i + 1))
+  {
+    obj = game_get_object(game, trigger_get_object(game->triggers, i));
+    s = game_get_space(game, trigger_get_space(game->triggers, i));
+    if (obj && s && space_has_object(s, obj_get_id(obj)) == FALSE)
+    {
+      obj_set_location(obj, space_get_id(s));
+      space_add_objectid(s, obj_get_id(obj));
+      game_light_object(game, obj);
+    }
   }
 
-  return;
+  enemy_set_health(enemy, -1);
+  enemy_set_location(enemy, -1);
 }
 
-
-/** game_update updates cmd whenever something is typed in, this is where
- * every known case gets interpreted as the various actions on the game,
- * any other input would be considered unknown
+/**
+ * @brief Runs the triggers of an object if it has no durability left
+ * @author Ignacio Nunez
+ *
+ * It is run when the durability changes and after the object is taken
+ * or dropped, so a broken object is never carried nor left anywhere.
+ *
+ * @param game a pointer to game
+ * @param obj a pointer to the object, after its durability changed
  */
-int game_update(Game *game, T_Command cmd, char *arg1, char *arg2)
+void game_trigger_broken(Game *game, Object *obj)
 {
-  int st = 0;
-  
-  if(!game){
-    return 0;
-  }
-  
-  game->last_cmd = cmd;
-  game->inspection = 0;
-  dialogue_reset(game->dialogue);
-  
-  if (update_game_over(game) == TRUE)
+  Inventory *inv = NULL;
+  Id id = NO_ID;
+
+  if (!obj || object_get_durability(obj) > 0)
   {
-    game_is_over(game);
+    return;
   }
 
-  switch (cmd)
+  id = obj_get_id(obj);
+  if (trigger_find(game->triggers, T_BROKEN, id, 0) == -1)
   {
-  case UNKNOWN:
-    st = game_command_unknown(game, arg1);
-    break;
-
-  case EXIT:
-    st = (int)game_command_exit(game, arg1);
-    break;
-
-  case TAKE:
-    st = (int)game_command_take(game, arg1);
-    break;
-
-  case DROP:
-    st = (int)game_command_drop(game, arg1);
-    break;
-
-  case ATTACK:
-    st = (int)game_command_attack(game, arg1);
-    break;
-
-  case MOVE:
-    st = (int)game_command_move(game, arg1);
-    break;
-
-  case INSPECT:
-    st = (int)game_command_inspect(game, arg1);
-    break;
-
-  case SAVE:
-    st = (int)game_command_save(game, arg1);
-    break;
-
-  case LOAD:
-    st = (int)game_command_load(game, arg1);
-    break;
-    
-  case TURNON:
-    st = (int)game_command_turnon(game, arg1);
-    break;
-
-  case TURNOFF:
-    st = (int)game_command_turnoff(game, arg1);
-    break;
-
-  case OPEN:
-    st = (int)game_command_open(game, arg1, arg2);
-    break;
-
-  case USE:
-    st = (int)game_command_use(game, arg1);
-    break;
-      
-  default:
-    break;
+    return;
   }
 
-  game_update_object(game);
-  game_update_enemy(game);
-  game_update_time(game);
-  game_update_ls(game);
-  
-  game_get_new_event(game);
-
-  return st;
+  inv = player_get_inventory(game->player[MAX_PLAYERS - 1]);
+  /* Every copy of it, as taking an object twice leaves it twice */
+  while (inventory_has_id(inv, id) == TRUE && inventory_remove_object(inv, id) == OK)
+    ;
+  obj_set_location(obj, NO_ID);
 }
 
+/**
+ * @brief Counts the lit objects the player carries
+ * @author Ignacio Nunez
+ *
+ * @param game a pointer to game
+ * @return number of lit objects in the inventory of the player
+ */
+int game_count_lights(Game *game)
+{
+  int i, count = 0;
+  Set *set = inventory_get_objects(player_get_inventory(game->player[MAX_PLAYERS - 1]));
 
-/* Gets the last event in the input
-*/
-R_Event game_get_last_event(Game *game){
-  if(game == NULL){
-    return -1;
+  for (i = 0; i < set_get_nids(set); i++)
+  {
+    if (object_get_turnedon(game_get_object(game, set_get_ids_by_number(set, i))) == TRUE)
+    {
+      count++;
+    }
   }
-  
-  return game->last_event;
+
+  return count;
 }
 
-/** Gets the last command in the input
+/**
+ * @brief Moves the lit objects of the player to the space it is in
+ * @author Ignacio Nunez
+ *
+ * Their light leaves the spaces it reached from where they were counted
+ * and spreads from the new one, so only those neighbourhoods are
+ * touched, and none if no light moved.
+ *
+ * @param game a pointer to game
+ * @param space space the player is in, NULL if none
+ * @param count lit objects the player carries
  */
-T_Command game_get_last_command(Game *game)
+void game_move_lights(Game *game, Space *space, int count)
 {
-  if(game == NULL){
-    return -1;
+  if (space == game->lit_space && count == game->lit_count)
+  {
+    return;
   }
-  
-  return game->last_cmd;
+
+  game_spread_light(game, game->lit_space, -game->lit_count);
+  game_spread_light(game, space, count);
+  game->lit_space = space;
+  game->lit_count = count;
 }
 
 /**
- * game_print_data prints all game related relevant data
+ * @brief Moves the light of an object lying in a space
+ * @author Ignacio Nunez
+ *
+ * The lit objects of the inventory are counted with the player, so an
+ * object lights a space on its own only while it is lit and out of the
+ * inventory. It has to be called when one is left, taken or moved.
+ *
+ * @param game a pointer to game
+ * @param obj object that may have changed
  */
-void game_print_data(Game *game)
+void game_light_object(Game *game, Object *obj)
 {
-  int i = 0;
-
-  printf("\n\n-------------\n\n");
+  Space *s = NULL;
+  int i;
 
-  printf("=> Spaces: \n");
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  if (!obj)
   {
-    space_print(game->spaces[i]);
+    return;
   }
 
-  printf("=> Objects:\n");
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  for (i = 0; i < MAX_OBJS && game->object[i] != obj; i++)
+    ;
+  if (i == MAX_OBJS)
   {
-    obj_print(game->object[i]);
+    return;
   }
 
-  printf("=> Players:\n");
-  for (i = 0; i < MAX_PLAYERS && game->player[i] != NULL; i++)
+  if (object_get_turnedon(obj) == TRUE && inventory_has_id(player_get_inventory(game->player[MAX_PLAYERS - 1]), obj_get_id(obj)) == FALSE)
   {
-    player_print(game->player[i]);
+    s = game_get_space(game, obj_get_location(obj));
   }
 
-  printf("=> Enemies:\n");
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  if (s != game->floor_lit[i])
   {
-    enemy_print(game->enemy[i]);
+    game_spread_light(game, game->floor_lit[i], -1);
+    game_spread_light(game, s, 1);
+    game->floor_lit[i] = s;
   }
 }
 
-/** False is the output when called
- * meaning game has ended
+/**
+ * @brief Finds the spaces the light of a source reaches
+ * @author Ignacio Nunez
+ *
+ * The light goes out of a space through its open links, and through at
+ * most LIGHT_RADIUS of them from the source.
+ *
+ * @param game a pointer to game
+ * @param source space the light comes from
+ * @param area where the spaces reached are returned, the source first
+ * @param dist where the number of links gone through to each one is returned
+ * @return number of spaces reached
  */
-BOOL game_is_over(Game *game)
+int game_light_area(Game *game, Space *source, Space **area, int *dist)
 {
-  if (player_get_health(game->player[MAX_PLAYERS - 1]) <= 0)
+  int i, k, n = 0;
+  DIRECTION d;
+  Link *l = NULL;
+  Space *s = NULL;
+
+  area[n] = source;
+  dist[n++] = 0;
+  for (i = 0; i < n; i++)
   {
-    dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
-    return TRUE;
-  }
+    if (dist[i] == LIGHT_RADIUS)
+    {
+      continue;
+    }
 
-   if (enemy_get_health(game_get_enemy(game, 45)) <= 0)
-  {
-    dialogue_set_command(game->dialogue, DC_END, NULL, NULL, NULL);
-    return TRUE;
+    for (d = N; d <= D; d++)
+    {
+      l = game_get_link(game, space_get_link(area[i], d));
+      if (link_get_status(l) != OPEN_L || !(s = game_get_space(game, link_get_destination(l))))
+      {
+        continue;
+      }
+
+      for (k = 0; k < n && area[k] != s; k++)
+        ;
+      if (k == n && n < MAX_SPACES)
+      {
+        area[n] = s;
+        dist[n++] = dist[i] + 1;
+      }
+    }
   }
 
-  return FALSE;
+  return n;
 }
 
 /**
- *Calls implementation for each action
- */
-
-/**
- * @brief It executes UNKNOWN command in game.
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @brief Adds the light of a source to the spaces it reaches
+ * @author Ignacio Nunez
+ *
+ * @param game a pointer to game
+ * @param source space the light comes from, NULL if none
+ * @param delta light added, negative to take it away
  */
-int game_command_unknown(Game *game, char *arg)
+void game_spread_light(Game *game, Space *source, int delta)
 {
-  dialogue_set_command(game->dialogue, DC_UNKNOWN, NULL, NULL, NULL);
-  return 5;
-}
+  Space *area[MAX_SPACES];
+  int dist[MAX_SPACES];
+  int i, n;
 
-/**
- * @brief It executes EXIT command in game.
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
- */
-STATUS game_command_exit(Game *game, char *arg)
-{
-  dialogue_set_command(game->dialogue, DC_EXIT, NULL, NULL, NULL);
-  return OK;
+  if (!source || delta == 0)
+  {
+    return;
+  }
+
+  n = game_light_area(game, source, area, dist);
+  for (i = 0; i < n; i++)
+  {
+    space_set_light_sources(area[i], space_get_light_sources(area[i]) + delta);
+  }
 }
 
 /**
- * @brief It executes TAKE command in game.
- * 
- * This command is for the player to take the object located
- * on the current position. It requires the name of the object for it
- * to be taken correctly
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @brief Checks if the light of a source goes on through a space
+ * @author Ignacio Nunez
+ *
+ * @param game a pointer to game
+ * @param source space the light comes from
+ * @param s space looked at
+ * @return TRUE if the light reaches s and can go through its links
  */
-STATUS game_command_take(Game *game, char *arg)
+BOOL game_light_through(Game *game, Space *source, Space *s)
 {
-  Id player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
-  Id id_obj_taken = NO_ID, obj_loc = NO_ID;
-  Object *obj_taken;
-  Space *s = NULL;
-  Object *o = NULL;
-  STATUS st = OK;
+  Space *area[MAX_SPACES];
+  int dist[MAX_SPACES];
+  int i, n;
 
-  obj_taken = game_get_object_byName(game, arg);
-  id_obj_taken = obj_get_id(obj_taken);
-  
-  /* Error control*/
-  if(object_get_movable(obj_taken)==TRUE && obj_is_visible(obj_taken, space_get_light_status(game_get_space(game, player_location))) && id_obj_taken != 398){  
-    /* Error control*/
-    if (space_has_object(game_get_space(game, player_location), id_obj_taken) == TRUE && set_get_nids(inventory_get_objects(player_get_inventory(game->player[0]))) < inventory_get_maxObjs(player_get_inventory(game->player[0])))
+  n = game_light_area(game, source, area, dist);
+  for (i = 0; i < n; i++)
+  {
+    if (area[i] == s)
     {
-      s = game_get_space(game, player_location);
-      o = game_get_object(game, id_obj_taken);
-      obj_loc = game_get_object_location(game, id_obj_taken);
-      
-      /* Error control*/
-      if (s == NULL)
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-
-      /* Error control*/
-      if (o == NULL)
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-
-      /* Error control*/
-      if (player_location != obj_loc)
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-
-      if (game_set_object_location(game, obj_get_id(o), NO_ID) == ERROR)
-      /* Error control */
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-
-      /* Error control */
-      if (player_add_object(game->player[MAX_PLAYERS - 1], o) == ERROR)
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-      /* Error control */
-      if (space_del_objectid(s, id_obj_taken) == ERROR)
-      {
-        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-        st = ERROR;
-      }
-      
-      if (id_obj_taken == 383)
-      {
-        dialogue_set_command(game->dialogue, DC_TAKE_M, NULL, NULL, NULL);
-        player_set_max_health(game_get_player(game, 21), player_get_max_health(game_get_player(game, 21)) + 10);
-        player_set_health(game_get_player(game, 21), player_get_health(game_get_player(game, 21)) + 10);
-        return st;
-      }
-
-      if (id_obj_taken == 384)
-      {
-        dialogue_set_command(game->dialogue, DC_TAKE_S, NULL, NULL, NULL);
-        player_set_baseDmg(game_get_player(game, 21), player_get_baseDmg(game_get_player(game, 21)) + 1);
-        return st;
-      }
-
-      if (id_obj_taken == 380)
-      {
-        dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
-        player_set_crit(game_get_player(game, 21), object_get_crit(obj_taken));
-        return st;
-      }
-      
-      dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
-      return st;
+      return dist[i] < LIGHT_RADIUS ? TRUE : FALSE;
     }
   }
-  
-  dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
-  st=ERROR;
-  return st;
+
+  return FALSE;
 }
 
 /**
- * @brief It executes DROP command in game.
- * 
- * This command is for dropping the object that carries the player
- * on the current position. It requires the name of the object to be dropped
- * to work correctly
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @brief Opens a link, letting the light go through it
+ * @author Ignacio Nunez
+ *
+ * Only the sources whose light goes on through the start of the link
+ * can reach farther, so only theirs is spread again.
+ *
+ * @param game a pointer to game
+ * @param link link to open
+ * @return OK if everything goes well, or ERROR if anything doesn't.
  */
-STATUS game_command_drop(Game *game, char *arg)
+STATUS game_open_link(Game *game, Link *link)
 {
-  Id player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
-  Id obj_id = NO_ID;
-  Object *obj;
-  STATUS st = OK;
-  Space *s = NULL;
-  Object *o = NULL;
+  Space *start = NULL, *fires[MAX_SPACES];
+  BOOL lit = FALSE, floor[MAX_OBJS];
+  STATUS st;
+  int i, n = 0;
 
-  obj = game_get_object_byName(game, arg);
-  obj_id = obj_get_id(obj);
-
-  /* Error control */
-  if (obj_id != obj_get_id(obj) || inventory_has_id(player_get_inventory(game->player[MAX_PLAYERS - 1]), obj_id) == FALSE)
+  if (!link || link_get_status(link) == OPEN_L)
   {
-    dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-    st = ERROR;
+    return link_set_status(link, OPEN_L);
   }
 
-  /* Error control*/
-  if (player_get_inventory(game->player[MAX_PLAYERS - 1]) == NULL)
+  start = game_get_space(game, link_get_start(link));
+  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL && start; i++)
   {
-   dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-   st = ERROR;
+    if (space_get_fire(game->spaces[i]) == TRUE && game_light_through(game, game->spaces[i], start) == TRUE)
+    {
+      game_spread_light(game, game->spaces[i], -1);
+      fires[n++] = game->spaces[i];
+    }
   }
-
-  s = game_get_space(game, player_location);
-  /* Error control*/
-  if (s == NULL)
+  if (game->lit_space && start && game_light_through(game, game->lit_space, start) == TRUE)
   {
-     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-     st = ERROR;
+    game_spread_light(game, game->lit_space, -game->lit_count);
+    lit = TRUE;
   }
-
-  o = game_get_object(game, obj_id);
-  /* Error control*/
-  if (o == NULL)
+  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
   {
-     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-    st = ERROR;
+    floor[i] = (game->floor_lit[i] && start && game_light_through(game, game->floor_lit[i], start) == TRUE) ? TRUE : FALSE;
+    if (floor[i] == TRUE)
+    {
+      game_spread_light(game, game->floor_lit[i], -1);
+    }
   }
 
-  /* Error control */
-  if (space_add_objectid(s, obj_get_id(o)) == ERROR)
-  {
-     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-    st = ERROR;
-  }
+  st = link_set_status(link, OPEN_L);
 
-  /* Error control */
-  if (game_set_object_location(game, obj_get_id(o), space_get_id(s)) == ERROR)
+  for (i = 0; i < n; i++)
   {
-     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-    st = ERROR;
+    game_spread_light(game, fires[i], 1);
   }
-  /* Error control */
-  if (player_del_object(game->player[MAX_PLAYERS - 1], obj_id) == ERROR)
+  if (lit == TRUE)
   {
-     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
-    st = ERROR;
+    game_spread_light(game, game->lit_space, game->lit_count);
   }
-
-  /* If the object is the ladder or Candle_1(Turnedon==TRUE and are dropped in the correct space, make them not movable) */
-  if((obj_id == 397 && space_get_id(s) == 11) || (obj_id==394 && space_get_id(s)==13)){
-    object_set_movable(obj, FALSE);
-
-    if (obj_id == 397)
-    {
-      link_set_status(game_get_link(game, space_get_link(s, U)), OPEN_L);
-    }
-    /*Puzzle completed*/
-    else 
+  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  {
+    if (floor[i] == TRUE)
     {
-      link_set_status(game_get_link(game, 526), OPEN_L);
-      dialogue_set_command(game->dialogue, DC_PUZZLE, NULL, NULL, NULL);
-      return st;
+      game_spread_light(game, game->floor_lit[i], 1);
     }
-
   }
 
-  dialogue_set_command(game->dialogue, DC_DROP, NULL, o, NULL);
   return st;
 }
 
 /**
- * @brief It executes ATTACK command in game.
- * 
- * This command allows the player to engage in combat with an enemy.
- * The deciding factor is up to chance, a random number will determine
- * whether the player or the enemy won that round resulting in the loser
- * getting his health reduced by 1
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @brief Updates what depends on the rest of the game after a command
+ * @author Ignacio Nunez
+ *
+ * Dead enemies leave the map and the lit objects of the player light the
+ * space it is in. All of it depends only on the
+ * state, so if it changed nothing at some epoch it changes nothing while
+ * the epoch stays the same, and it is not run again.
+ *
+ * @param game a pointer to game
+ * @param settled whether settled_epoch is known, NULL to always run it
+ * @param settled_epoch epoch at which it last changed nothing
  */
-STATUS game_command_attack(Game *game, char *arg)
+void game_update_bookkeeping(Game *game, BOOL *settled, unsigned long *settled_epoch)
 {
-  int rand_num = 0, rand_crit_player = 0, rand_crit_enemy = 0;
-  Id player_loc = player_get_location(game->player[MAX_PLAYERS - 1]);
-  Enemy *enemy = game_get_enemyWithPlayer(game, player_loc);
-  Id enemy_loc = enemy_get_location(enemy);
-  
-  int player_crit = player_get_crit(game->player[MAX_PLAYERS - 1]);
-  int player_baseDmg = player_get_baseDmg(game->player[MAX_PLAYERS - 1]);
+  unsigned long before = game->epoch;
 
-  int enemy_crit = enemy_get_crit(enemy);
-  int enemy_baseDmg = enemy_get_baseDmg(enemy);
+  if (settled && *settled == TRUE && *settled_epoch == before)
+  {
+    return;
+  }
 
-  Object *Sword1 = game_get_object_byName(game, "Sword1");
-  Object *Sword2 = game_get_object_byName(game, "Sword2");
+  game_update_enemy(game);
+  game_update_ls(game);
 
-  Id id_Sword1 = obj_get_id(Sword1) ;
-  Id id_Sword2 = obj_get_id(Sword2) ;
+  if (settled)
+  {
+    *settled = (game->epoch == before) ? TRUE : FALSE;
+    *settled_epoch = game->epoch;
+  }
+}
 
-  int hit_chance=5;
- 
-
-  srand(time(NULL));
-
-  rand_num = rand() % 10;
-  rand_crit_player = rand() % 10;
-  rand_crit_enemy = rand() % 10;
+/*Functions for the new event
+(just a continuation of game_update)*/
+void game_get_new_event(Game *game){
 
-  /* Error control */
-  if(!enemy)
-  {
-     dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
-    return ERROR;
-  }
+  R_Event new_event = NOTHING;
+  STATUS st = ERROR;
+  int due[WHEEL_TIMERS], cond = COND_NONE;
 
-  /* Error control */
-  if (enemy_get_health(enemy) == 0)
+  /*Which event happens is only drawn in the turns one is due*/
+  if (game_rules_wheel_next(game->events, due) > 0)
   {
-    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
-    return ERROR;
+    new_event = game_rules_table_get(game->table, game->rng, &cond);
+    game_set_event(game);
   }
 
-  /* Error control */
-  if (player_loc == NO_ID || enemy_loc == NO_ID)
+  if ((cond & COND_NIGHT && game->day_time != NIGHT) || (cond & COND_DAY && game->day_time != DAY) ||
+      (cond & COND_MOVE && game->last_cmd != MOVE) || (cond & COND_NOATTACK && game->last_cmd == ATTACK))
   {
-    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
-    return ERROR;
+    dialogue_set_event(game->dialogue, DE_NOTHING);
+    new_event = NOTHING;
   }
+  game->last_event = new_event;
 
-  /* Error control */
-  if (player_loc != enemy_loc)
+  switch(new_event)
   {
-    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
-    return ERROR;
-  }
+    case MOVE_OBJ:
+      st = game_event_move(game);
+      break;
 
+    case TRAP:
+      st = game_event_trap(game);
+      break;
 
-  /* Changing the base dmg if it is a crit from the player*/
-  if(rand_crit_player < player_crit){
-    player_baseDmg = player_baseDmg*2;
-  }
-  if(rand_crit_enemy < enemy_crit){
-    enemy_baseDmg = enemy_baseDmg*2;
-    dialogue_set_command(game->dialogue, DC_ATTACK_CRITICAL, NULL, NULL, NULL);
-  }
+    case SLIME:
+      st = game_event_slime(game);
+      break;
 
-/*Basically if a player has either sword, hit chance is increased, each attack removes one durability, after 3 attacks sword must be destroyed*/
-if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword1))
-  {
-     hit_chance= hit_chance-2;
-    object_set_durability(Sword1, (object_get_durability(Sword1)-1));
-    if(object_get_durability(Sword1)<=0){
-      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword1);
-      dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
-    }
-  }
-  else if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword2))
-  {
-    hit_chance= hit_chance-2;
-    object_set_durability(Sword2, (object_get_durability(Sword2)-1));
-     if(object_get_durability(Sword1)<=0){
-      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword2);
-      dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
-      
-    }
-  }
+    case DAYNIGHT:
+      st = game_event_daynight(game);
+      break;
 
-  if(enemy_loc != 11){
-  /*Player wins if rand_num es > 5, else, they lose a life as the enemy won that round*/
-    if (rand_num > hit_chance)
-    {
-      enemy_set_health(enemy, (enemy_get_health(enemy) - player_baseDmg));
-      dialogue_set_command(game->dialogue, DC_ATTACK_HIT, NULL, NULL, enemy);
-       if (enemy_get_health(enemy) == 0 && enemy_loc==123)
-      {
-       dialogue_set_command(game->dialogue, DC_END, NULL, NULL, NULL);
-      }
-    }
-    else
-    {
-      player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - enemy_baseDmg));
-      dialogue_set_command(game->dialogue, DC_ATTACK_MISSED, NULL, NULL, enemy);
-      if (player_get_health(game->player[MAX_PLAYERS - 1]) == 0)
-      {
-       dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
-        game_is_over(game);
-      }
-      
-    }
+    case SPAWN:
+      st = game_event_spawn(game);
+      break;
 
+    default:
+      break;
   }
-  else{
-    player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - enemy_baseDmg));
-    dialogue_set_command(game->dialogue, DC_HIM, NULL, NULL, NULL);
-    enemy_set_name(enemy, "HIM");
-    if (player_get_health(game->player[MAX_PLAYERS - 1]) == 0)
-      {
-       dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
-        game_is_over(game);
-      }
+
+  if(st == ERROR){
+    game->last_event = NOTHING;
   }
 
+  return;
+}
 
 
-  
+/** game_update updates cmd whenever something is typed in, this is where
+ * every known case gets interpreted as the various actions on the game,
+ * any other input would be considered unknown
+ */
+int game_update(Game *game, T_Command cmd, char *arg1, char *arg2)
+{
+  if(!game){
+    return 0;
+  }
 
-  return OK;
+  return game_update_turn(game, cmd, arg1, arg2, NULL, NULL);
 }
 
-
-/**
- * @brief It executes MOVE command in game.
- * 
- * Another way to move, commands move n,s,e,w,u,d
- * to north, south, east, west, up or down respectively
- * 
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+/** game_update_batch plays several commands one after another, as game_update
  */
-STATUS game_command_move(Game *game, char *arg)
+int game_update_batch(Game *game, Game_command *cmds, int n, int *st, long *ns)
 {
-  char *west[2] = {"w", "West"};
-  char *north[2] = {"n", "North"};
-  char *south[2] = {"s", "South"};
-  char *east[2] = {"e", "East"};
-  char *up[2] = {"u", "Up"};
-  char *down[2] = {"d", "Down"};
-  STATUS st = ERROR;
-  Space *s=NULL;
-
+  struct timespec start, end;
+  BOOL settled = FALSE;
+  unsigned long settled_epoch = 0;
+  int i;
 
-  if (strcasecmp(arg, west[0]) == 0 || strcasecmp(arg, west[1]) == 0)
+  /* Error control */
+  if (!game || !cmds || !st || n < 0)
   {
-    /* Moving west */
-    st = game_command_movement(game, W);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    dialogue_set_command(game->dialogue, DC_MOVE_W, s, NULL, NULL);
-
-    if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_W, s, NULL, NULL);
-    }
+    return -1;
   }
-  else if (strcasecmp(arg, north[0]) == 0 || strcasecmp(arg, north[1]) == 0)
-  {
-    /* Moving north */
-    st = game_command_movement(game, N);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    dialogue_set_command(game->dialogue, DC_MOVE_N, s, NULL, NULL);
 
-     if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_N, s, NULL, NULL);
-    }
-  }
-  else if (strcasecmp(arg, south[0]) == 0 || strcasecmp(arg, south[1]) == 0)
+  for (i = 0; i < n; i++)
   {
-    /* Moving south */
-    st = game_command_movement(game, S);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    if( player_get_location(game->player[MAX_PLAYERS-1])!=123){
-      dialogue_set_command(game->dialogue, DC_MOVE_S, s, NULL, NULL);
-    }
-    else{
-       dialogue_set_command(game->dialogue, DC_BOSS, NULL, NULL, NULL);
-    }
-
-    if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_S, s, NULL, NULL);
+    if (ns)
+    {
+      clock_gettime(CLOCK_MONOTONIC, &start);
     }
-  }
-  else if (strcasecmp(arg, east[0]) == 0 || strcasecmp(arg, east[1]) == 0)
-  {
-    /* Moving east */
-    st = game_command_movement(game, E);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    dialogue_set_command(game->dialogue, DC_MOVE_E, s, NULL, NULL);
-
-     if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_E, s, NULL, NULL);
+    st[i] = game_update_turn(game, cmds[i].cmd, cmds[i].arg1, cmds[i].arg2, &settled, &settled_epoch);
+    if (ns)
+    {
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      ns[i] = (long)(end.tv_sec - start.tv_sec) * 1000000000L + (end.tv_nsec - start.tv_nsec);
     }
   }
-  else if (strcasecmp(arg, up[0]) == 0 || strcasecmp(arg, up[1]) == 0)
-  {
-    /* Moving up */
-    st = game_command_movement(game, U);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    dialogue_set_command(game->dialogue, DC_MOVE_U, s, NULL, NULL);
 
-     if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_U, s, NULL, NULL);
-    }
-  }
-  else if (strcasecmp(arg, down[0]) == 0 || strcasecmp(arg, down[1]) == 0)
-  {
-    /* Moving down */
-    st = game_command_movement(game, D);
-    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
-    dialogue_set_command(game->dialogue, DC_MOVE_D, s, NULL, NULL);
+  return n;
+}
 
-     if (st==ERROR){
-      dialogue_set_error(game->dialogue, E_MOVE_D, s, NULL, NULL);
-    }
-  }
-  else
+/** game_tick lets the time go on in a real time game
+ */
+STATUS game_tick(Game *game)
+{
+  /* Error control */
+  if (!game)
   {
-    st = ERROR;
+    return ERROR;
   }
 
-  return st;
+  /*The last command was already shown and kept in the scrollback*/
+  dialogue_reset(game->dialogue);
+
+  game_update_bookkeeping(game, NULL, NULL);
+  game_get_new_event(game);
+
+  dialogue_log_turn(game->dialogue);
+
+  return OK;
 }
 
 /**
- * @brief It executes the movement from a move command in game.
+ * @brief Plays a command and the rest of the turn
  * @author Miguel Soto
- * 
- * @param game pointer to game struct
- * @param dir movement direction
- * @return OK if everything goes well or ERROR if there was any mistake
+ *
+ * @param game a pointer to game
+ * @param cmd command
+ * @param arg1 first argument of the command
+ * @param arg2 second argument of the command
+ * @param settled whether settled_epoch is known, NULL to always run the bookkeeping
+ * @param settled_epoch epoch at which the bookkeeping last changed nothing
+ * @return 0 if ERROR, 1 if OK, and 5 if OK but dont print condition
  */
-STATUS game_command_movement(Game *game, DIRECTION dir)
+int game_update_turn(Game *game, T_Command cmd, char *arg1, char *arg2, BOOL *settled, unsigned long *settled_epoch)
 {
-  Id player_location = NO_ID, player_id = NO_ID;
-  Space *s = NULL;
-  Link *l = NULL;
-  STATUS st = OK;
-  if (!game || dir == ND)
-  {
-   st = ERROR;
-  }
+  int st = 0;
 
-  player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
-  player_id = player_get_id(game->player[MAX_PLAYERS - 1]);
-  if (player_location == NO_ID || player_id == NO_ID)
-  {
-    st = ERROR;
-  }
+  game->last_cmd = cmd;
+  game->inspection = 0;
+  dialogue_reset(game->dialogue);
   
-  s = game_get_space(game, player_location);
-  if (!s)
+  if (update_game_over(game) == TRUE)
   {
-    st = ERROR;
+    game_is_over(game);
   }
-  
-  l = game_get_link(game, space_get_link(s, dir));
-  if (!l)
-  {
+
+  switch (cmd)
+  {
+  case UNKNOWN:
+    st = game_command_unknown(game, arg1);
+    break;
+
+  case EXIT:
+    st = (int)game_command_exit(game, arg1);
+    break;
+
+  case TAKE:
+    st = (int)game_command_take(game, arg1);
+    break;
+
+  case DROP:
+    st = (int)game_command_drop(game, arg1);
+    break;
+
+  case ATTACK:
+    st = (int)game_command_attack(game, arg1);
+    break;
+
+  case MOVE:
+    st = (int)game_command_move(game, arg1);
+    break;
+
+  case INSPECT:
+    st = (int)game_command_inspect(game, arg1);
+    break;
+
+  case SAVE:
+    st = (int)game_command_save(game, arg1);
+    break;
+
+  case LOAD:
+    st = (int)game_command_load(game, arg1);
+    break;
+    
+  case TURNON:
+    st = (int)game_command_turnon(game, arg1);
+    break;
+
+  case TURNOFF:
+    st = (int)game_command_turnoff(game, arg1);
+    break;
+
+  case OPEN:
+    st = (int)game_command_open(game, arg1, arg2);
+    break;
+
+  case USE:
+    st = (int)game_command_use(game, arg1);
+    break;
+
+  case MAP:
+    st = (int)game_command_map(game);
+    break;
+      
+  default:
+    break;
+  }
+
+  game_update_bookkeeping(game, settled, settled_epoch);
+  
+  /*In real time the events come with the ticks*/
+  if (game->realtime == FALSE)
+  {
+    game_get_new_event(game);
+  }
+
+  /*What was said this turn goes to the scrollback*/
+  dialogue_log_turn(game->dialogue);
+
+  return st;
+}
+
+
+/* Gets the last event in the input
+*/
+R_Event game_get_last_event(Game *game){
+  if(game == NULL){
+    return -1;
+  }
+  
+  return game->last_event;
+}
+
+/** Gets the last command in the input
+ */
+T_Command game_get_last_command(Game *game)
+{
+  if(game == NULL){
+    return -1;
+  }
+  
+  return game->last_cmd;
+}
+
+/**
+ * game_print_data prints all game related relevant data
+ */
+void game_print_data(Game *game)
+{
+  int i = 0;
+
+  printf("\n\n-------------\n\n");
+
+  printf("=> Spaces: \n");
+  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  {
+    space_print(game->spaces[i]);
+  }
+
+  printf("=> Objects:\n");
+  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  {
+    obj_print(game->object[i]);
+  }
+
+  printf("=> Players:\n");
+  for (i = 0; i < MAX_PLAYERS && game->player[i] != NULL; i++)
+  {
+    player_print(game->player[i]);
+  }
+
+  printf("=> Enemies:\n");
+  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  {
+    enemy_print(game->enemy[i]);
+  }
+}
+
+/** False is the output when called
+ * meaning game has ended
+ */
+BOOL game_is_over(Game *game)
+{
+  if (player_get_health(game->player[MAX_PLAYERS - 1]) <= 0)
+  {
+    dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
+    return TRUE;
+  }
+
+   if (enemy_get_health(game_get_enemy(game, 45)) <= 0)
+  {
+    dialogue_set_command(game->dialogue, DC_END, NULL, NULL, NULL);
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+ *Calls implementation for each action
+ */
+
+/**
+ * @brief It executes UNKNOWN command in game.
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+int game_command_unknown(Game *game, char *arg)
+{
+  dialogue_set_command(game->dialogue, DC_UNKNOWN, NULL, NULL, NULL);
+  return 5;
+}
+
+/**
+ * @brief It executes EXIT command in game.
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_exit(Game *game, char *arg)
+{
+  dialogue_set_command(game->dialogue, DC_EXIT, NULL, NULL, NULL);
+  return OK;
+}
+
+/**
+ * @brief It executes MAP command in game.
+ *
+ * Nothing changes in the game, the graphic engine switches the map it
+ * shows when it sees this command.
+ * @param game pointer to game struct
+ * @return OK
+ */
+STATUS game_command_map(Game *game)
+{
+  return OK;
+}
+
+/**
+ * @brief It executes TAKE command in game.
+ * 
+ * This command is for the player to take the object located
+ * on the current position. It requires the name of the object for it
+ * to be taken correctly
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_take(Game *game, char *arg)
+{
+  Id player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
+  Id id_obj_taken = NO_ID, obj_loc = NO_ID;
+  Object *obj_taken;
+  Space *s = NULL;
+  Object *o = NULL;
+  STATUS st = OK;
+
+  obj_taken = game_get_object_byName(game, arg);
+  id_obj_taken = obj_get_id(obj_taken);
+  
+  /* Error control*/
+  if(object_get_movable(obj_taken)==TRUE && obj_is_visible(obj_taken, game_get_space_light(game, game_get_space(game, player_location))) && id_obj_taken != 398){  
+    /* Error control*/
+    if (space_has_object(game_get_space(game, player_location), id_obj_taken) == TRUE && set_get_nids(inventory_get_objects(player_get_inventory(game->player[0]))) < inventory_get_maxObjs(player_get_inventory(game->player[0])))
+    {
+      s = game_get_space(game, player_location);
+      o = game_get_object(game, id_obj_taken);
+      obj_loc = game_get_object_location(game, id_obj_taken);
+      
+      /* Error control*/
+      if (s == NULL)
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+
+      /* Error control*/
+      if (o == NULL)
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+
+      /* Error control*/
+      if (player_location != obj_loc)
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+
+      if (game_set_object_location(game, obj_get_id(o), NO_ID) == ERROR)
+      /* Error control */
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+
+      /* Error control */
+      if (player_add_object(game->player[MAX_PLAYERS - 1], o) == ERROR)
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+      /* Error control */
+      if (space_del_objectid(s, id_obj_taken) == ERROR)
+      {
+        dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+        st = ERROR;
+      }
+      /* A broken object does not stay in the inventory */
+      game_trigger_broken(game, o);
+      game_light_object(game, o);
+      
+      if (id_obj_taken == 383)
+      {
+        dialogue_set_command(game->dialogue, DC_TAKE_M, NULL, NULL, NULL);
+        player_set_max_health(game_get_player(game, 21), player_get_max_health(game_get_player(game, 21)) + 10);
+        player_set_health(game_get_player(game, 21), player_get_health(game_get_player(game, 21)) + 10);
+        return st;
+      }
+
+      if (id_obj_taken == 384)
+      {
+        dialogue_set_command(game->dialogue, DC_TAKE_S, NULL, NULL, NULL);
+        player_set_baseDmg(game_get_player(game, 21), player_get_baseDmg(game_get_player(game, 21)) + 1);
+        return st;
+      }
+
+      if (id_obj_taken == 380)
+      {
+        dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
+        player_set_crit(game_get_player(game, 21), object_get_crit(obj_taken));
+        return st;
+      }
+      
+      dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
+      return st;
+    }
+  }
+  
+  dialogue_set_error(game->dialogue, E_TAKE, NULL, o, NULL);
+  st=ERROR;
+  return st;
+}
+
+/**
+ * @brief It executes DROP command in game.
+ * 
+ * This command is for dropping the object that carries the player
+ * on the current position. It requires the name of the object to be dropped
+ * to work correctly
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_drop(Game *game, char *arg)
+{
+  Id player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
+  Id obj_id = NO_ID;
+  Object *obj;
+  STATUS st = OK;
+  Space *s = NULL;
+  Object *o = NULL;
+
+  obj = game_get_object_byName(game, arg);
+  obj_id = obj_get_id(obj);
+
+  /* Error control */
+  if (obj_id != obj_get_id(obj) || inventory_has_id(player_get_inventory(game->player[MAX_PLAYERS - 1]), obj_id) == FALSE)
+  {
+    dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+    st = ERROR;
+  }
+
+  /* Error control*/
+  if (player_get_inventory(game->player[MAX_PLAYERS - 1]) == NULL)
+  {
+   dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+   st = ERROR;
+  }
+
+  s = game_get_space(game, player_location);
+  /* Error control*/
+  if (s == NULL)
+  {
+     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+     st = ERROR;
+  }
+
+  o = game_get_object(game, obj_id);
+  /* Error control*/
+  if (o == NULL)
+  {
+     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+    st = ERROR;
+  }
+
+  /* Error control */
+  if (space_add_objectid(s, obj_get_id(o)) == ERROR)
+  {
+     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+    st = ERROR;
+  }
+
+  /* Error control */
+  if (game_set_object_location(game, obj_get_id(o), space_get_id(s)) == ERROR)
+  {
+     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+    st = ERROR;
+  }
+  /* Error control */
+  if (player_del_object(game->player[MAX_PLAYERS - 1], obj_id) == ERROR)
+  {
+     dialogue_set_error(game->dialogue, E_DROP, NULL, o, NULL);
+    st = ERROR;
+  }
+  /* A broken object is not left anywhere */
+  game_trigger_broken(game, o);
+  /* A lit object keeps lighting the space it is left in */
+  game_light_object(game, o);
+
+  /* If the object is the ladder or Candle_1(Turnedon==TRUE and are dropped in the correct space, make them not movable) */
+  if((obj_id == 397 && space_get_id(s) == 11) || (obj_id==394 && space_get_id(s)==13)){
+    object_set_movable(obj, FALSE);
+
+    if (obj_id == 397)
+    {
+      game_open_link(game, game_get_link(game, space_get_link(s, U)));
+    }
+    /*Puzzle completed*/
+    else 
+    {
+      game_open_link(game, game_get_link(game, 526));
+      dialogue_set_command(game->dialogue, DC_PUZZLE, NULL, NULL, NULL);
+      return st;
+    }
+
+  }
+
+  dialogue_set_command(game->dialogue, DC_DROP, NULL, o, NULL);
+  return st;
+}
+
+/**
+ * @brief It executes ATTACK command in game.
+ * 
+ * This command allows the player to engage in combat with an enemy.
+ * The deciding factor is up to chance, a random number will determine
+ * whether the player or the enemy won that round resulting in the loser
+ * getting his health reduced by 1
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_attack(Game *game, char *arg)
+{
+  int rand_num = 0, rand_crit_player = 0, rand_crit_enemy = 0;
+  Id player_loc = player_get_location(game->player[MAX_PLAYERS - 1]);
+  Enemy *enemy = game_get_enemyWithPlayer(game, player_loc);
+  Id enemy_loc = enemy_get_location(enemy);
+  
+  int player_crit = player_get_crit(game->player[MAX_PLAYERS - 1]);
+  int player_baseDmg = player_get_baseDmg(game->player[MAX_PLAYERS - 1]);
+
+  int enemy_crit = enemy_get_crit(enemy);
+  int enemy_baseDmg = enemy_get_baseDmg(enemy);
+
+  Object *Sword1 = game_get_object_byName(game, "Sword1");
+  Object *Sword2 = game_get_object_byName(game, "Sword2");
+
+  Id id_Sword1 = obj_get_id(Sword1) ;
+  Id id_Sword2 = obj_get_id(Sword2) ;
+
+  int hit_chance=5;
+
+  rand_num = rng_range(game->rng, 10);
+  rand_crit_player = rng_range(game->rng, 10);
+  rand_crit_enemy = rng_range(game->rng, 10);
+
+  /* Error control */
+  if(!enemy)
+  {
+     dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+  /* Error control */
+  if (enemy_get_health(enemy) == 0)
+  {
+    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+  /* Error control */
+  if (player_loc == NO_ID || enemy_loc == NO_ID)
+  {
+    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+  /* Error control */
+  if (player_loc != enemy_loc)
+  {
+    dialogue_set_error(game->dialogue, E_ATTACK, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+
+  /* Changing the base dmg if it is a crit from the player*/
+  if(rand_crit_player < player_crit){
+    player_baseDmg = player_baseDmg*2;
+  }
+  if(rand_crit_enemy < enemy_crit){
+    enemy_baseDmg = enemy_baseDmg*2;
+    dialogue_set_command(game->dialogue, DC_ATTACK_CRITICAL, NULL, NULL, NULL);
+  }
+
+/*Basically if a player has either sword, hit chance is increased, each attack removes one durability, after 3 attacks sword must be destroyed*/
+if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword1))
+  {
+     hit_chance= hit_chance-2;
+    object_set_durability(Sword1, (object_get_durability(Sword1)-1));
+    if(object_get_durability(Sword1)<=0){
+      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword1);
+      dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
+    }
+    game_trigger_broken(game, Sword1);
+  }
+  else if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword2))
+  {
+    hit_chance= hit_chance-2;
+    object_set_durability(Sword2, (object_get_durability(Sword2)-1));
+     if(object_get_durability(Sword1)<=0){
+      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword2);
+      dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
+      
+    }
+    game_trigger_broken(game, Sword2);
+  }
+
+  if(enemy_loc != 11){
+  /*Player wins if rand_num es > 5, else, they lose a life as the enemy won that round*/
+    if (rand_num > hit_chance)
+    {
+      enemy_set_health(enemy, (enemy_get_health(enemy) - player_baseDmg));
+      dialogue_set_command(game->dialogue, DC_ATTACK_HIT, NULL, NULL, enemy);
+       if (enemy_get_health(enemy) == 0 && enemy_loc==123)
+      {
+       dialogue_set_command(game->dialogue, DC_END, NULL, NULL, NULL);
+      }
+      game_trigger_death(game, enemy);
+    }
+    else
+    {
+      player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - enemy_baseDmg));
+      dialogue_set_command(game->dialogue, DC_ATTACK_MISSED, NULL, NULL, enemy);
+      if (player_get_health(game->player[MAX_PLAYERS - 1]) == 0)
+      {
+       dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
+        game_is_over(game);
+      }
+      
+    }
+
+  }
+  else{
+    player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - enemy_baseDmg));
+    dialogue_set_command(game->dialogue, DC_HIM, NULL, NULL, NULL);
+    enemy_set_name(enemy, "HIM");
+    if (player_get_health(game->player[MAX_PLAYERS - 1]) == 0)
+      {
+       dialogue_set_command(game->dialogue, DC_GOVER, NULL, NULL, NULL);
+        game_is_over(game);
+      }
+  }
+
+
+
+  
+
+  return OK;
+}
+
+
+/**
+ * @brief It executes MOVE command in game.
+ * 
+ * Another way to move, commands move n,s,e,w,u,d
+ * to north, south, east, west, up or down respectively
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_move(Game *game, char *arg)
+{
+  char *west[2] = {"w", "West"};
+  char *north[2] = {"n", "North"};
+  char *south[2] = {"s", "South"};
+  char *east[2] = {"e", "East"};
+  char *up[2] = {"u", "Up"};
+  char *down[2] = {"d", "Down"};
+  STATUS st = ERROR;
+  Space *s=NULL;
+
+
+  if (strcasecmp(arg, west[0]) == 0 || strcasecmp(arg, west[1]) == 0)
+  {
+    /* Moving west */
+    st = game_command_movement(game, W);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    dialogue_set_command(game->dialogue, DC_MOVE_W, s, NULL, NULL);
+
+    if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_W, s, NULL, NULL);
+    }
+  }
+  else if (strcasecmp(arg, north[0]) == 0 || strcasecmp(arg, north[1]) == 0)
+  {
+    /* Moving north */
+    st = game_command_movement(game, N);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    dialogue_set_command(game->dialogue, DC_MOVE_N, s, NULL, NULL);
+
+     if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_N, s, NULL, NULL);
+    }
+  }
+  else if (strcasecmp(arg, south[0]) == 0 || strcasecmp(arg, south[1]) == 0)
+  {
+    /* Moving south */
+    st = game_command_movement(game, S);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    if( player_get_location(game->player[MAX_PLAYERS-1])!=123){
+      dialogue_set_command(game->dialogue, DC_MOVE_S, s, NULL, NULL);
+    }
+    else{
+       dialogue_set_command(game->dialogue, DC_BOSS, NULL, NULL, NULL);
+    }
+
+    if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_S, s, NULL, NULL);
+    }
+  }
+  else if (strcasecmp(arg, east[0]) == 0 || strcasecmp(arg, east[1]) == 0)
+  {
+    /* Moving east */
+    st = game_command_movement(game, E);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    dialogue_set_command(game->dialogue, DC_MOVE_E, s, NULL, NULL);
+
+     if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_E, s, NULL, NULL);
+    }
+  }
+  else if (strcasecmp(arg, up[0]) == 0 || strcasecmp(arg, up[1]) == 0)
+  {
+    /* Moving up */
+    st = game_command_movement(game, U);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    dialogue_set_command(game->dialogue, DC_MOVE_U, s, NULL, NULL);
+
+     if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_U, s, NULL, NULL);
+    }
+  }
+  else if (strcasecmp(arg, down[0]) == 0 || strcasecmp(arg, down[1]) == 0)
+  {
+    /* Moving down */
+    st = game_command_movement(game, D);
+    s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS-1]));
+    dialogue_set_command(game->dialogue, DC_MOVE_D, s, NULL, NULL);
+
+     if (st==ERROR){
+      dialogue_set_error(game->dialogue, E_MOVE_D, s, NULL, NULL);
+    }
+  }
+  else
+  {
+    st = ERROR;
+  }
+
+  return st;
+}
+
+/**
+ * @brief It executes the movement from a move command in game.
+ * @author Miguel Soto
+ * 
+ * @param game pointer to game struct
+ * @param dir movement direction
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_movement(Game *game, DIRECTION dir)
+{
+  Id player_location = NO_ID, player_id = NO_ID;
+  Space *s = NULL;
+  Link *l = NULL;
+  STATUS st = OK;
+  if (!game || dir == ND)
+  {
+   st = ERROR;
+  }
+
+  player_location = player_get_location(game->player[MAX_PLAYERS - 1]);
+  player_id = player_get_id(game->player[MAX_PLAYERS - 1]);
+  if (player_location == NO_ID || player_id == NO_ID)
+  {
+    st = ERROR;
+  }
+  
+  s = game_get_space(game, player_location);
+  if (!s)
+  {
+    st = ERROR;
+  }
+  
+  l = game_get_link(game, space_get_link(s, dir));
+  if (!l)
+  {
+    st = ERROR;
+  }
+  
+  if (link_get_status(l) == OPEN_L)
+  {
+    game_set_player_location(game, player_id, link_get_destination(l));
+    return st;
+  }
+  else
+  {
+    /* Link is closed */
+    st = ERROR;
+    return st;
+  }
+}
+
+
+/**
+ * @brief It executes INSPECT command in game.
+ * 
+ * Changes the description of game to the one user wanted
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_inspect(Game *game, char *arg)
+{
+  Object *obj = game_get_object_byName(game, arg);
+  STATUS st = OK;
+
+  /*SPACE CASE*/
+  if (strcmp(arg, "space") == 0 || strcmp(arg, "s") == 0)
+  {
+    if(game_get_space_light(game, game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1]))) == BRIGHT){
+      dialogue_set_command(game->dialogue, DC_INSPECT_S,game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1])) , NULL, NULL);
+      game->inspection = (char *)space_get_long_description(game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1])));
+    }
+    else{
+      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
+    
+      game->inspection = "El lugar esta muy oscuro, no puedes ver nada";
+    }
+    
+    return st;
+  }
+
+  /*OBJECT CASE*/
+  else
+  {
+    if (arg == NULL)
+    {
+      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
+      game->inspection = " ";
+      st = ERROR;
+    }
+
+    if (obj == NULL)
+    {
+      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
+      game->inspection = " ";
+      st = ERROR;
+    }
+    if (player_has_object(game->player[0], obj_get_id(obj)) == FALSE && player_get_location(game->player[0]) != obj_get_location(obj))
+    {
+       dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
+      st = ERROR;
+    }
+    game->inspection = (char *)obj_get_description(obj);
+    dialogue_set_command(game->dialogue, DC_INSPECT_O, NULL, obj, NULL);
+    return st;
+  }
+  return st;
+}
+
+/**
+ * @brief It executes SAVE command in game.
+ * 
+ * Creates a file with the info of the game
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_save(Game* game, char *arg){
+  dialogue_set_command(game->dialogue, DC_SAVE, NULL, NULL, NULL);
+  return game_managment_save(arg, game);
+}
+
+/**
+ * @brief It executes LOAD command in game.
+ * 
+ * Generates a new game throught a file 
+ * 
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_load(Game* game, char *arg){
+  STATUS st = OK;
+  if(strcasecmp(arg, "savedata.dat") != 0 && strcasecmp(arg, "hormiguero.dat") != 0){
+    dialogue_set_error(game->dialogue, E_LOAD, NULL, NULL, NULL);
+    st = ERROR;
+  }
+
+ st = game_managment_load(arg, game);
+ dialogue_set_command(game->dialogue, DC_LOAD, NULL, NULL, NULL);
+ return st;
+}
+
+/**
+ * @brief It executes TURNON command in game
+ * @author Miguel Soto
+ *
+ * It turn on an object so it iluminates.
+ *
+ * @param game pointer to game struct.
+ * @param arg string with command argument.
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_turnon(Game *game, char *arg)
+{
+  Object *obj = NULL;
+  Id player_loc = NO_ID;
+
+#ifdef DEBUG
+  printf("**\nEntrando en turnon\n");
+#endif
+  if (!game || !arg)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+#ifdef DEBUG
+  printf("Getting obj\n");
+#endif
+  obj = game_get_object_byName(game, arg);
+  if (!obj)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+#ifdef DEBUG
+    printf("ERROR Obj is NULL\n**\n");
+#endif
+    return ERROR;
+  }
+
+  player_loc = player_get_location(game->player[0]);
+  if (player_loc == NO_ID)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+    return ERROR;
+  }
+  
+  if (player_has_object(game->player[MAX_PLAYERS-1], obj_get_id(obj)) == FALSE)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+    return ERROR;
+  }
+#ifdef DEBUG
+  printf("Checking obj properties\n");
+#endif
+  if (object_get_illuminate(obj) == FALSE || object_get_turnedon(obj) == TRUE)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+    /* Object has not iluminate attribute or object is already iluminated*/
+#ifdef DEBUG
+    printf("ERROR object properties\n**\n");
+#endif
+    return ERROR;
+  }
+  else if (space_get_fire(game_get_space(game, player_loc)) == FALSE)
+  {
+    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
+#ifdef DEBUG
+    printf("There is no fire in space\n");
+#endif
+    return ERROR;
+  }
+  
+  dialogue_set_command(game->dialogue, DC_TON, NULL, obj, NULL);
+#ifdef DEBUG
+  printf("Calling object_set_turnon");
+#endif
+  return object_set_turnedon(obj, TRUE);
+}
+
+/**
+ * @brief It executes TURN OFF command in game
+ * @author Miguel Soto
+ *
+ * It turn off an object so it stop to iluminate.
+ *
+ * @param game pointer to game struct.
+ * @param arg string with command argument.
+ * @return OK if everything goes well or ERROR if there was any mistake .
+ */
+STATUS game_command_turnoff(Game *game, char *arg)
+{
+  Object *obj = NULL;
+
+#ifdef DEBUG
+  printf("**\nEntrando en turnon\n");
+#endif
+  if (!game || !arg)
+  {
+    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+#ifdef DEBUG
+  printf("Getting obj\n");
+#endif
+  obj = game_get_object_byName(game, arg);
+  if (!obj)
+  {
+    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
+#ifdef DEBUG
+    printf("ERROR Obj es NULL\n**\n");
+#endif
+    return ERROR;
+  }
+
+  if (player_has_object(game->player[MAX_PLAYERS-1], obj_get_id(obj)) == FALSE)
+  {
+    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
+    return ERROR;
+  }
+#ifdef DEBUG
+  printf("Checking obj properties\n");
+#endif
+  if (object_get_illuminate(obj) == FALSE || object_get_turnedon(obj) == FALSE)
+  {
+    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
+    /* Object has not iluminate attribute or object is already not iluminated*/
+#ifdef DEBUG
+    printf("ERROR object properties\n**\n");
+#endif
+    return ERROR;
+  }
+
+  dialogue_set_command(game->dialogue, DC_TOFF, NULL, obj, NULL);
+#ifdef DEBUG
+  printf("Calling object_set_turnon FALSE object properties\n**\n");
+#endif
+  return object_set_turnedon(obj, FALSE);
+}
+
+/**
+ * @brief It executes OPEN command in game
+ * @author Miguel Soto
+ * 
+ * It opens a link with an object.
+ * 
+ * @param game pointer to game struct.
+ * @param link_name string with link name that is about to be open.
+ * @param obj_name string with object name that opens link.
+ * @return OK if everything goes well or ERROR if there was any mistake .
+ */
+STATUS game_command_open(Game *game, char *link_name, char *obj_name)
+{
+  Link *l = NULL;
+  Object *obj = NULL;
+  Id obj_open_link = NO_ID;
+
+  if (!game || !link_name || !obj_name)
+  {
+    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
+    return ERROR;
+  }  
+
+  l = game_get_link_byName(game, link_name);
+  obj = game_get_object_byName(game, obj_name);
+  if (!l || !obj)
+  {
+    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+  if (link_get_status(l) == OPEN_L || player_has_object(game->player[0], obj_get_id(obj)) == FALSE)
+  {
+    /* Link is already open */
+    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
+    return ERROR;
+  }
+
+  obj_open_link = object_get_open(obj);
+
+  if (link_get_id(l) == obj_open_link && player_get_location(game->player[0]) == link_get_start(l))
+  {
+    dialogue_set_command(game->dialogue, DC_OPEN, game_get_space(game,player_get_location(game->player[MAX_PLAYERS - 1])), NULL, NULL) ;
+    inventory_remove_object(player_get_inventory(game->player[0]),obj_get_id(obj));
+    obj_set_location(obj, -1);
+    return game_open_link(game, l);
+  }
+
+  dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
+  return ERROR;
+}
+
+/**
+ * @brief It executes USE command in game.
+ *
+ * Uses a given object
+ *
+ * @param game pointer to game struct
+ * @param arg string with command argument
+ * @return OK if everything goes well or ERROR if there was any mistake
+ */
+STATUS game_command_use(Game *game, char *arg)
+{
+  Object *obj = NULL;
+  Id id = NO_ID;
+  Obj_type type = UNKNOWN_TYPE;
+  Player *player = NULL;
+  STATUS st = OK;
+
+#ifdef DEBUG
+  printf("**\nEntrando use\n");
+#endif
+
+  if (!game || !arg)
+  {
+    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
     st = ERROR;
+    return st;
   }
-  
-  if (link_get_status(l) == OPEN_L)
+
+  obj = game_get_object_byName(game, arg);
+#ifdef DEBUG
+  printf("Getting obj\n");
+#endif
+
+  if (obj == NULL)
   {
-    game_set_player_location(game, player_id, link_get_destination(l));
+    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+#ifdef DEBUG
+    printf("Obj es NULL\n**\n");
+#endif
+    st = ERROR;
     return st;
   }
-  else
+
+#ifdef DEBUG
+  printf("Gettin id & player\n");
+#endif
+  id = obj_get_id(obj);
+  player = game_get_player(game, 21);
+  
+  
+  if (id == NO_ID || !player)
   {
-    /* Link is closed */
+    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+#ifdef DEBUG
+    printf("Id obj es NO_ID or player == NULL\n**\n");
+#endif
     st = ERROR;
     return st;
   }
+
+#ifdef DEBUG
+  printf("Viendo tipo object\n");
+#endif
+  type = obj_get_type(id);
+
+#ifdef DEBUG
+  printf("Viendo si el player tiene el objeto\n");
+#endif
+  if (type != BED)
+  {
+    if (inventory_has_id(player_get_inventory(player), id) == FALSE)
+    {
+      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+#ifdef DEBUG
+      printf("No tiene el objeto\n**\n");
+#endif
+      st = ERROR;
+      return st;
+    }
+  }
+  else if (type == BED)
+  {
+    if (space_has_object(game_get_space(game, player_get_location(player)), id) == FALSE)
+    {
+      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+#ifdef DEBUG
+      printf("No tiene el objeto\n**\n");
+#endif
+      st = ERROR;
+      return st;
+    }
+  }
+
+
+  if (type == APPLE && st == OK) /*Case apples*/
+  {
+#ifdef DEBUG
+    printf("Es manzana\n");
+#endif
+    st = inventory_remove_object(player_get_inventory(player), id);
+    st = player_set_health(player, player_get_health(player) + 1);
+
+    st = obj_set_location(game_get_object(game, id), -1);
+    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
+
+    return st;
+  }
+  else if (type == ELIXIR && st == OK) /*Case elixir*/
+  {
+#ifdef DEBUG
+    printf("Es elixir\n");
+#endif
+    st = inventory_remove_object(player_get_inventory(player), id);
+    st = player_set_health(player, player_get_health(player) + 2);
+
+    st = obj_set_location(game_get_object(game, id), -1);
+    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
+
+    return st;
+  }
+  else if (type == ARMOR && st == OK) /*Case armour*/
+  {
+#ifdef DEBUG
+    printf("Es armadura\n");
+#endif
+    st = inventory_remove_object(player_get_inventory(player), id);
+    st = player_set_max_health(player, player_get_max_health(player) + 1);
+
+    st = obj_set_location(game_get_object(game, id), -1);
+    dialogue_set_command(game->dialogue, DC_USE_ARMOR, NULL, NULL, NULL);
+
+    return st;
+  }
+  else if (type == HOOK && st == OK) /*Case hook*/
+  {
+#ifdef DEBUG
+    printf("Es hook\n");
+#endif
+    st = inventory_remove_object(player_get_inventory(player), id);
+    if (player_get_location(player) == 125)
+    {
+      st = obj_set_location(game_get_object(game, 398), -1);
+      st = inventory_add_object(player_get_inventory(player), 398);
+
+      st = obj_set_location(game_get_object(game, id), -1);
+      dialogue_set_command(game->dialogue, DC_USE_HOOK, NULL, NULL, NULL);
+
+      return st;
+    }
+  }
+  else if (type == BED && st == OK) /*Case bed*/
+  {
+#ifdef DEBUG
+    printf("Es cama\n");
+#endif
+    /*st = set_del_id(space_get_objects(game_get_space(game, player_get_location(player))), id);*/
+    if (game_get_time(game) == DAY)
+    {
+      st = game_set_time(game, NIGHT);
+    }
+    else
+    {
+      st = game_set_time(game, DAY);
+    }
+
+    dialogue_set_command(game->dialogue, DC_USE_BED, NULL, NULL, NULL);
+
+    return st;
+  } else if (type == BREAD_CRUMBS)
+  {
+    if (player_get_location(player) == 11) 
+    {
+      dialogue_set_command(game->dialogue, DC_BREAD, NULL, NULL, NULL);
+      st = inventory_remove_object(player_get_inventory(player), id);
+      return st;
+    }
+    else 
+    {
+      st = ERROR;
+      return st;
+    }
+  }
+
+  dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+#ifdef DEBUG
+  printf("No es ninguno: %d", (int) type);
+#endif
+  st = ERROR;
+  return st;  
+}
+/**
+ * @brief It executes MOVE event
+ * 
+ * Apple or Elixir will appear on the player's room 
+ * 
+ * @param game pointer to game struct
+ * @return OK if event happens, ERROR if not
+ */
+STATUS game_event_move(Game *game){
+  
+  Object *elixir;
+  Id id, current_id, elixir_loc;
+  Space *current_location, *elixir_space;
+
+
+  elixir = game_get_object_byName(game, "Elixir4");
+
+  if(elixir == NULL || obj_get_location(elixir) == -1){
+    elixir = game_get_object_byName(game, "Elixir6");
+    if(elixir == NULL || obj_get_location(elixir) == -1){
+      dialogue_set_event(game->dialogue, DE_NOTHING);
+      return ERROR;
+    }
+  }
+
+  current_id = player_get_location(game->player[MAX_PLAYERS - 1]);
+  current_location = game_get_space(game, current_id);
+  elixir_loc = obj_get_location(elixir);
+  elixir_space = game_get_space(game, elixir_loc);
+
+  id = obj_get_id(elixir);
+
+  if(space_del_objectid(elixir_space, id) == ERROR){
+    dialogue_set_event(game->dialogue, DE_NOTHING);
+    return ERROR; 
+  }
+
+  if(space_add_objectid(current_location, id)==ERROR){
+    dialogue_set_event(game->dialogue, DE_NOTHING);
+    return ERROR; 
+  }
+
+  if(obj_set_location(elixir, current_id)){
+    dialogue_set_event(game->dialogue, DE_MOVEOBJ);
+    return ERROR; 
+  }
+  game_light_object(game, elixir);
+
+  dialogue_set_event(game->dialogue, DE_MOVEOBJ);
+  return OK; 
 }
 
-
 /**
- * @brief It executes INSPECT command in game.
+ * @brief It executes TRAP event
  * 
- * Changes the description of game to the one user wanted
+ * Player losses 1 HP
  * 
  * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @return OK if event happens, ERROR if not
  */
-STATUS game_command_inspect(Game *game, char *arg)
-{
-  Object *obj = game_get_object_byName(game, arg);
-  STATUS st = OK;
-
-  /*SPACE CASE*/
-  if (strcmp(arg, "space") == 0 || strcmp(arg, "s") == 0)
-  {
-    if(space_get_light_status(game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1]))) == BRIGHT){
-      dialogue_set_command(game->dialogue, DC_INSPECT_S,game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1])) , NULL, NULL);
-      game->inspection = (char *)space_get_long_description(game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1])));
-    }
-    else{
-      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
-    
-      game->inspection = "El lugar esta muy oscuro, no puedes ver nada";
-    }
-    
-    return st;
-  }
+STATUS game_event_trap(Game *game){
 
-  /*OBJECT CASE*/
-  else
-  {
-    if (arg == NULL)
-    {
-      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
-      game->inspection = " ";
-      st = ERROR;
-    }
+  /*Player losses one of HP*/
+  player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - 1));
 
-    if (obj == NULL)
-    {
-      dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
-      game->inspection = " ";
-      st = ERROR;
-    }
-    if (player_has_object(game->player[0], obj_get_id(obj)) == FALSE && player_get_location(game->player[0]) != obj_get_location(obj))
-    {
-       dialogue_set_error(game->dialogue, E_INSPECT, NULL, NULL, NULL);
-      st = ERROR;
-    }
-    game->inspection = (char *)obj_get_description(obj);
-    dialogue_set_command(game->dialogue, DC_INSPECT_O, NULL, obj, NULL);
-    return st;
-  }
-  return st;
+  dialogue_set_event(game->dialogue, DE_TRAP);
+  return OK;
 }
 
 /**
- * @brief It executes SAVE command in game.
+ * @brief It executes SLIME event
  * 
- * Creates a file with the info of the game
+ * An slime appear on the players location 
  * 
  * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @return OK if event happens, ERROR if not
  */
-STATUS game_command_save(Game* game, char *arg){
-  dialogue_set_command(game->dialogue, DC_SAVE, NULL, NULL, NULL);
-  return game_managment_save(arg, game);
+STATUS game_event_slime(Game *game){
+  
+  Enemy *slime = game_get_enemy_byName(game, "Rat1");
+  Id slime_loc = enemy_get_location(slime);
+  
+    if(slime == NULL){
+    slime = game_get_enemy_byName(game, "Rat2");
+  }
+  /*In case slime is already dead*/
+  if(slime_loc == -1){
+    dialogue_set_event(game->dialogue, DE_NOTHING);
+    dialogue_set_event(game->dialogue, DE_NOTHING);
+    return ERROR;
+  }
+
+  /*Sets the enemy on players location*/
+  enemy_set_location(slime, player_get_location(game->player[MAX_PLAYERS - 1]));
+
+  dialogue_set_event(game->dialogue, DE_SLIME);
+  return OK;
 }
 
 /**
- * @brief It executes LOAD command in game.
+ * @brief It executes DAYNIGHT event
  * 
- * Generates a new game throught a file 
+ * Changes day to night and night to day 
  * 
  * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @return OK if event happens, ERROR if not
  */
-STATUS game_command_load(Game* game, char *arg){
-  STATUS st = OK;
-  if(strcasecmp(arg, "savedata.dat") != 0 && strcasecmp(arg, "hormiguero.dat") != 0){
-    dialogue_set_error(game->dialogue, E_LOAD, NULL, NULL, NULL);
-    st = ERROR;
+STATUS game_event_daynight(Game *game){
+
+  if(game_get_time(game) == DAY){
+    dialogue_set_event(game->dialogue, DE_NIGHT);
+    game_set_time(game, NIGHT);
+  }
+  else if(game_get_time(game) == NIGHT){
+    dialogue_set_event(game->dialogue, DE_DAY);
+    game_set_time(game, DAY);
   }
 
- st = game_managment_load(arg, game);
- dialogue_set_command(game->dialogue, DC_LOAD, NULL, NULL, NULL);
- return st;
+  return OK;
 }
 
 /**
- * @brief It executes TURNON command in game
- * @author Miguel Soto
- *
- * It turn on an object so it iluminates.
- *
- * @param game pointer to game struct.
- * @param arg string with command argument.
- * @return OK if everything goes well or ERROR if there was any mistake
+ * @brief It executes SPAWN event
+ * 
+ * Player tps to entrance
+ * 
+ * @param game pointer to game struct
+ * @return OK if event happens, ERROR if not
  */
-STATUS game_command_turnon(Game *game, char *arg)
+STATUS game_event_spawn(Game *game){
+
+  /*Sets player to the initial room*/
+  player_set_location(game->player[0], SPACE_INITIAL);
+
+  dialogue_set_event(game->dialogue, DE_SPAWN);
+  return OK;
+}
+
+/*Function that gets the enemy id based on the position it is located in the enemy array located in the game structure */
+Id game_get_enemy_id(Game *game, int num)
 {
-  Object *obj = NULL;
-  Id player_loc = NO_ID;
 
-  printf("**\nEntrando en turnon\n");
-  if (!game || !arg)
+  /* Error control */
+  if (!game || num < 0 || num > MAX_ENEMYS - 1)
   {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    return ERROR;
+    return NO_ID;
   }
 
-  printf("Getting obj\n");
-  obj = game_get_object_byName(game, arg);
-  if (!obj)
-  {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    printf("ERROR Obj is NULL\n**\n");
-    return ERROR;
-  }
+  return (Id)enemy_get_id(game->enemy[num]);
+}
 
-  player_loc = player_get_location(game->player[0]);
-  if (player_loc == NO_ID)
-  {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    return ERROR;
-  }
-  
-  if (player_has_object(game->player[MAX_PLAYERS-1], obj_get_id(obj)) == FALSE)
-  {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    return ERROR;
-  }
-  printf("Checking obj properties\n");
-  if (object_get_illuminate(obj) == FALSE || object_get_turnedon(obj) == TRUE)
-  {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    /* Object has not iluminate attribute or object is already iluminated*/
-    printf("ERROR object properties\n**\n");
-    return ERROR;
-  }
-  else if (space_get_fire(game_get_space(game, player_loc)) == FALSE)
+Id game_get_player_id(Game *game)
+{
+
+  /* Error control */
+  if (!game)
   {
-    dialogue_set_error(game->dialogue, E_TON, NULL, NULL, NULL);
-    printf("There is no fire in space\n");
-    return ERROR;
+    return NO_ID;
   }
-  
-  dialogue_set_command(game->dialogue, DC_TON, NULL, obj, NULL);
-  printf("Calling object_set_turnon");
-  return object_set_turnedon(obj, TRUE);
+
+  return (Id)player_get_id(game->player[MAX_PLAYERS - 1]);
 }
 
-/**
- * @brief It executes TURN OFF command in game
- * @author Miguel Soto
- *
- * It turn off an object so it stop to iluminate.
- *
- * @param game pointer to game struct.
- * @param arg string with command argument.
- * @return OK if everything goes well or ERROR if there was any mistake .
+/** 
+ * Function that gets the object id based on the position it is located in 
+ * the object array located in the game structure 
  */
-STATUS game_command_turnoff(Game *game, char *arg)
+Id game_get_object_id(Game *game, int num)
 {
-  Object *obj = NULL;
 
-  printf("**\nEntrando en turnon\n");
-  if (!game || !arg)
+  /* Error control */
+  if (!game || num < 0 || num > MAX_ENEMYS - 1)
   {
-    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
-    return ERROR;
+    return NO_ID;
   }
 
-  printf("Getting obj\n");
-  obj = game_get_object_byName(game, arg);
-  if (!obj)
-  {
-    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
-    printf("ERROR Obj es NULL\n**\n");
-    return ERROR;
-  }
+  return (Id)obj_get_id(game->object[num]);
+}
 
-  if (player_has_object(game->player[MAX_PLAYERS-1], obj_get_id(obj)) == FALSE)
+Game *game_alloc2()
+{
+
+  Game *game = NULL;
+
+  game = (Game *)malloc(sizeof(Game));
+
+  /* Error control */
+  if (!game)
   {
-    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
-    return ERROR;
+    fprintf(stderr, "Error saving memory for game(game_create)");
+    return NULL;
   }
-  printf("Checking obj properties\n");
-  if (object_get_illuminate(obj) == FALSE || object_get_turnedon(obj) == FALSE)
+  game->inspection = "\0";
+  game->day_time = DAY;
+  game->lit_space = NULL;
+  game->lit_count = 0;
+  game->last_event = NOTHING;
+  game->epoch = 0;
+  game->realtime = FALSE;
+  game->dialogue = dialogue_create();
+  /* Different games created at the same time must not share their random sequence */
+  game->rng = rng_create((unsigned long)time(NULL) ^ (unsigned long)game);
+  game->events = game_rules_wheel_create(0);
+  /* Until a map is loaded */
+  game->table = game_rules_table_create();
+  game->triggers = trigger_create();
+  if (!game->rng || !game->events || !game->triggers || game_rules_table_add_default(game->table) == ERROR)
+  {
+    dialogue_destroy(game->dialogue);
+    rng_destroy(game->rng);
+    game_rules_wheel_destroy(game->events);
+    game_rules_table_destroy(game->table);
+    trigger_destroy(game->triggers);
+    free(game);
+    return NULL;
+  }
+
+  game_set_event(game);
+
+  return game;
+}
+
+/** Gets the change counter of the game
+ */
+unsigned long game_get_epoch(Game *game)
+{
+  /* Error control */
+  if (!game)
   {
-    dialogue_set_error(game->dialogue, E_TOFF, NULL, NULL, NULL);
-    /* Object has not iluminate attribute or object is already not iluminated*/
-    printf("ERROR object properties\n**\n");
-    return ERROR;
+    return 0;
   }
 
-  dialogue_set_command(game->dialogue, DC_TOFF, NULL, obj, NULL);
-  printf("Calling object_set_turnon FALSE object properties\n**\n");
-  return object_set_turnedon(obj, FALSE);
+  return game->epoch;
 }
 
-/**
- * @brief It executes OPEN command in game
- * @author Miguel Soto
- * 
- * It opens a link with an object.
- * 
- * @param game pointer to game struct.
- * @param link_name string with link name that is about to be open.
- * @param obj_name string with object name that opens link.
- * @return OK if everything goes well or ERROR if there was any mistake .
+/** Sets the seed of the random generator of the game
  */
-STATUS game_command_open(Game *game, char *link_name, char *obj_name)
+STATUS game_set_seed(Game *game, unsigned long seed)
 {
-  Link *l = NULL;
-  Object *obj = NULL;
-  Id obj_open_link = NO_ID;
-
-  if (!game || !link_name || !obj_name)
+  /* Error control */
+  if (!game)
   {
-    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
     return ERROR;
-  }  
+  }
 
-  l = game_get_link_byName(game, link_name);
-  obj = game_get_object_byName(game, obj_name);
-  if (!l || !obj)
+  if (rng_set_seed(game->rng, seed) == ERROR)
   {
-    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
     return ERROR;
   }
 
-  if (link_get_status(l) == OPEN_L || player_has_object(game->player[0], obj_get_id(obj)) == FALSE)
+  /* The events follow the new sequence too */
+  game_set_event(game);
+
+  return OK;
+}
+
+/** Sets the triggers of a game
+ */
+STATUS game_set_triggers(Game *game, Triggers *triggers)
+{
+  int i;
+
+  /* Error control */
+  if (!game || !triggers)
   {
-    /* Link is already open */
-    dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
     return ERROR;
   }
 
-  obj_open_link = object_get_open(obj);
+  trigger_destroy(game->triggers);
+  game->triggers = triggers;
 
-  if (link_get_id(l) == obj_open_link && player_get_location(game->player[0]) == link_get_start(l))
+  for (i = trigger_find(triggers, T_LIGHT, NO_ID, 0); i != -1; i = trigger_find(triggers, T_LIGHT, NO_ID, i + 1))
   {
-    dialogue_set_command(game->dialogue, DC_OPEN, game_get_space(game,player_get_location(game->player[MAX_PLAYERS - 1])), NULL, NULL) ;
-    inventory_remove_object(player_get_inventory(game->player[0]),obj_get_id(obj));
-    obj_set_location(obj, -1);
-    return link_set_status(l, OPEN_L);
+    space_set_light_fixed(game_get_space(game, trigger_get_subject(triggers, i)), TRUE);
   }
 
-  dialogue_set_error(game->dialogue, E_OPEN, NULL, NULL, NULL);
-  return ERROR;
+  return OK;
 }
 
-/**
- * @brief It executes USE command in game.
- *
- * Uses a given object
- *
- * @param game pointer to game struct
- * @param arg string with command argument
- * @return OK if everything goes well or ERROR if there was any mistake
+/** Sets whether the events come with game_tick
  */
-STATUS game_command_use(Game *game, char *arg)
+STATUS game_set_realtime(Game *game, BOOL realtime)
 {
-  Object *obj = NULL;
-  Id id = NO_ID;
-  Obj_type type = UNKNOWN_TYPE;
-  Player *player = NULL;
-  STATUS st = OK;
-
-  printf("**\nEntrando use\n");
-
-  if (!game || !arg)
+  /* Error control */
+  if (!game || (realtime != TRUE && realtime != FALSE))
   {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    st = ERROR;
-    return st;
+    return ERROR;
   }
 
-  obj = game_get_object_byName(game, arg);
-  printf("Getting obj\n");
+  game->realtime = realtime;
 
-  if (obj == NULL)
-  {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    printf("Obj es NULL\n**\n");
-    st = ERROR;
-    return st;
-  }
+  return OK;
+}
 
-  printf("Gettin id & player\n");
-  id = obj_get_id(obj);
-  player = game_get_player(game, 21);
-  
-  
-  if (id == NO_ID || !player)
+/** Sets the random events of a game
+ */
+STATUS game_set_events(Game *game, Event_table *table)
+{
+  /* Error control */
+  if (!game || !table)
   {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    printf("Id obj es NO_ID or player == NULL\n**\n");
-    st = ERROR;
-    return st;
+    return ERROR;
   }
 
-  printf("Viendo tipo object\n");
-  type = obj_get_type(id);
+  game_rules_table_destroy(game->table);
+  game->table = table;
+  game_set_event(game);
 
-  printf("Viendo si el player tiene el objeto\n");
-  if (type != BED)
-  {
-    if (inventory_has_id(player_get_inventory(player), id) == FALSE)
-    {
-      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-      printf("No tiene el objeto\n**\n");
-      st = ERROR;
-      return st;
-    }
-  }
-  else if (type == BED)
+  return OK;
+}
+
+/** Gets the seed of the random generator of the game
+ */
+unsigned long game_get_seed(Game *game)
+{
+  /* Error control */
+  if (!game)
   {
-    if (space_has_object(game_get_space(game, player_get_location(player)), id) == FALSE)
-    {
-      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-      printf("No tiene el objeto\n**\n");
-      st = ERROR;
-      return st;
-    }
+    return 0;
   }
 
+  return rng_get_seed(game->rng);
+}
 
-  if (type == APPLE && st == OK) /*Case apples*/
-  {
-    printf("Es manzana\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_health(player, player_get_health(player) + 1);
-
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
+/** Writes the state that changes while playing into a buffer
+ */
+long game_state_write(Game *game, unsigned char *buf, long max)
+{
+  long pos = 0;
+  unsigned long rng_state[RNG_STATE_SIZE];
+  Set *set = NULL;
+  Inventory *inv = NULL;
+  const char *name = NULL;
+  int i, j, n;
 
-    return st;
-  }
-  else if (type == ELIXIR && st == OK) /*Case elixir*/
+  /* Error control */
+  if (!game || max < 0)
   {
-    printf("Es elixir\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_health(player, player_get_health(player) + 2);
-
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
-
-    return st;
+    return -1;
   }
-  else if (type == ARMOR && st == OK) /*Case armour*/
-  {
-    printf("Es armadura\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_max_health(player, player_get_max_health(player) + 1);
 
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_ARMOR, NULL, NULL, NULL);
+  game_state_put(buf, max, &pos, GAME_STATE_VERSION);
 
-    return st;
-  }
-  else if (type == HOOK && st == OK) /*Case hook*/
+  /* Spaces: light and objects on the floor */
+  for (n = 0; n < MAX_SPACES && game->spaces[n] != NULL; n++)
+    ;
+  game_state_put(buf, max, &pos, n);
+  for (i = 0; i < n; i++)
   {
-    printf("Es hook\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    if (player_get_location(player) == 125)
+    set = space_get_objects(game->spaces[i]);
+    game_state_put(buf, max, &pos, space_get_id(game->spaces[i]));
+    game_state_put(buf, max, &pos, game_get_space_light(game, game->spaces[i]));
+    game_state_put(buf, max, &pos, set_get_nids(set));
+    for (j = 0; j < set_get_nids(set); j++)
     {
-      st = obj_set_location(game_get_object(game, 398), -1);
-      st = inventory_add_object(player_get_inventory(player), 398);
-
-      st = obj_set_location(game_get_object(game, id), -1);
-      dialogue_set_command(game->dialogue, DC_USE_HOOK, NULL, NULL, NULL);
-
-      return st;
+      game_state_put(buf, max, &pos, set_get_ids_by_number(set, j));
     }
   }
-  else if (type == BED && st == OK) /*Case bed*/
-  {
-    printf("Es cama\n");
-    /*st = set_del_id(space_get_objects(game_get_space(game, player_get_location(player))), id);*/
-    if (game_get_time(game) == DAY)
-    {
-      st = game_set_time(game, NIGHT);
-    }
-    else
-    {
-      st = game_set_time(game, DAY);
-    }
-
-    dialogue_set_command(game->dialogue, DC_USE_BED, NULL, NULL, NULL);
 
-    return st;
-  } else if (type == BREAD_CRUMBS)
-  {
-    if (player_get_location(player) == 11) 
-    {
-      dialogue_set_command(game->dialogue, DC_BREAD, NULL, NULL, NULL);
-      st = inventory_remove_object(player_get_inventory(player), id);
-      return st;
-    }
-    else 
+  /* Objects */
+  for (n = 0; n < MAX_OBJS && game->object[n] != NULL; n++)
+    ;
+  game_state_put(buf, max, &pos, n);
+  for (i = 0; i < n; i++)
+  {
+    game_state_put(buf, max, &pos, obj_get_id(game->object[i]));
+    game_state_put(buf, max, &pos, obj_get_location(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_movable(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_dependency(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_open(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_illuminate(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_turnedon(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_light_visible(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_crit(game->object[i]));
+    game_state_put(buf, max, &pos, object_get_durability(game->object[i]));
+  }
+
+  /* Players and their inventory */
+  for (n = 0; n < MAX_PLAYERS && game->player[n] != NULL; n++)
+    ;
+  game_state_put(buf, max, &pos, n);
+  for (i = 0; i < n; i++)
+  {
+    inv = player_get_inventory(game->player[i]);
+    set = inventory_get_objects(inv);
+    game_state_put(buf, max, &pos, player_get_id(game->player[i]));
+    game_state_put(buf, max, &pos, player_get_location(game->player[i]));
+    game_state_put(buf, max, &pos, player_get_max_health(game->player[i]));
+    game_state_put(buf, max, &pos, player_get_health(game->player[i]));
+    game_state_put(buf, max, &pos, player_get_crit(game->player[i]));
+    game_state_put(buf, max, &pos, player_get_baseDmg(game->player[i]));
+    game_state_put(buf, max, &pos, inventory_get_maxObjs(inv));
+    game_state_put(buf, max, &pos, set_get_nids(set));
+    for (j = 0; j < set_get_nids(set); j++)
     {
-      st = ERROR;
-      return st;
+      game_state_put(buf, max, &pos, set_get_ids_by_number(set, j));
     }
   }
 
-  dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-  printf("No es ninguno: %d", (int) type);
-  st = ERROR;
-  return st;  
-}
-/**
- * @brief It executes MOVE event
- * 
- * Apple or Elixir will appear on the player's room 
- * 
- * @param game pointer to game struct
- * @return OK if event happens, ERROR if not
- */
-STATUS game_event_move(Game *game){
-  
-  Object *elixir;
-  Id id, current_id, elixir_loc;
-  Space *current_location, *elixir_space;
-
-
-  if(game->day_time == DAY || game->last_cmd != MOVE){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
-    return ERROR;
-  }
-
-  elixir = game_get_object_byName(game, "Elixir4");
-
-  if(elixir == NULL || obj_get_location(elixir) == -1){
-    elixir = game_get_object_byName(game, "Elixir6");
-    if(elixir == NULL || obj_get_location(elixir) == -1){
-      dialogue_set_event(game->dialogue, DE_NOTHING);
-      return ERROR;
+  /* Enemies */
+  for (n = 0; n < MAX_ENEMYS && game->enemy[n] != NULL; n++)
+    ;
+  game_state_put(buf, max, &pos, n);
+  for (i = 0; i < n; i++)
+  {
+    name = enemy_get_name(game->enemy[i]);
+    game_state_put(buf, max, &pos, enemy_get_id(game->enemy[i]));
+    game_state_put(buf, max, &pos, enemy_get_location(game->enemy[i]));
+    game_state_put(buf, max, &pos, enemy_get_health(game->enemy[i]));
+    game_state_put(buf, max, &pos, enemy_get_crit(game->enemy[i]));
+    game_state_put(buf, max, &pos, enemy_get_baseDmg(game->enemy[i]));
+    game_state_put(buf, max, &pos, (long)strlen(name));
+    for (j = 0; name[j] != '\0'; j++)
+    {
+      if (buf && pos < max)
+      {
+        buf[pos] = (unsigned char)name[j];
+      }
+      pos++;
     }
   }
 
-  current_id = player_get_location(game->player[MAX_PLAYERS - 1]);
-  current_location = game_get_space(game, current_id);
-  elixir_loc = obj_get_location(elixir);
-  elixir_space = game_get_space(game, elixir_loc);
-
-  id = obj_get_id(elixir);
-
-  if(space_del_objectid(elixir_space, id) == ERROR){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
-    return ERROR; 
+  /* Links */
+  for (n = 0; n < MAX_LINKS && game->links[n] != NULL; n++)
+    ;
+  game_state_put(buf, max, &pos, n);
+  for (i = 0; i < n; i++)
+  {
+    game_state_put(buf, max, &pos, link_get_id(game->links[i]));
+    game_state_put(buf, max, &pos, link_get_status(game->links[i]));
   }
 
-  if(space_add_objectid(current_location, id)==ERROR){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
-    return ERROR; 
+  /* Game */
+  rng_get_state(game->rng, rng_state);
+  game_state_put(buf, max, &pos, game->day_time);
+  game_state_put(buf, max, &pos, game->last_cmd);
+  game_state_put(buf, max, &pos, game->last_event);
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+  {
+    game_state_put(buf, max, &pos, (long)rng_state[i]);
+  }
+  game_state_put(buf, max, &pos, game_rules_wheel_get_now(game->events));
+  for (i = 0; i < GAME_TIMERS; i++)
+  {
+    game_state_put(buf, max, &pos, game_rules_wheel_get_due(game->events, i));
   }
 
-  if(obj_set_location(elixir, current_id)){
-    dialogue_set_event(game->dialogue, DE_MOVEOBJ);
-    return ERROR; 
+  /* The buffer was not big enough */
+  if (buf && pos > max)
+  {
+    return -1;
   }
 
-  dialogue_set_event(game->dialogue, DE_MOVEOBJ);
-  return OK; 
+  return pos;
 }
 
-/**
- * @brief It executes TRAP event
- * 
- * Player losses 1 HP
- * 
- * @param game pointer to game struct
- * @return OK if event happens, ERROR if not
+/** Restores a state written by game_state_write
  */
-STATUS game_event_trap(Game *game){
+STATUS game_state_read(Game *game, const unsigned char *buf, long len)
+{
+  long pos = 0, n_ids, id, due;
+  unsigned long rng_state[RNG_STATE_SIZE];
+  char name[ENEMY_LEN_NAME];
+  BOOL ok = TRUE;
+  Set *set = NULL;
+  Inventory *inv = NULL;
+  int i, j, n;
 
-  /*Events only Occurs at Night*/
-  if(game->day_time == DAY|| game->last_cmd != MOVE){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
+  /* Error control */
+  if (!game || !buf || len <= 0)
+  {
     return ERROR;
   }
 
-  /*Player losses one of HP*/
-  player_set_health(game->player[MAX_PLAYERS - 1], (player_get_health(game->player[MAX_PLAYERS - 1]) - 1));
+  if (game_state_get(buf, len, &pos, &ok) != GAME_STATE_VERSION)
+  {
+    return ERROR;
+  }
 
-  dialogue_set_event(game->dialogue, DE_TRAP);
-  return OK;
-}
+  /* Spaces */
+  for (n = 0; n < MAX_SPACES && game->spaces[n] != NULL; n++)
+    ;
+  if (game_state_get(buf, len, &pos, &ok) != n)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < n && ok; i++)
+  {
+    if (game_state_get(buf, len, &pos, &ok) != space_get_id(game->spaces[i]))
+    {
+      return ERROR;
+    }
+    space_set_light_status(game->spaces[i], (Light)game_state_get(buf, len, &pos, &ok));
 
-/**
- * @brief It executes SLIME event
- * 
- * An slime appear on the players location 
- * 
- * @param game pointer to game struct
- * @return OK if event happens, ERROR if not
- */
-STATUS game_event_slime(Game *game){
-  
-  Enemy *slime = game_get_enemy_byName(game, "Rat1");
-  Id slime_loc = enemy_get_location(slime);
-  
-    if(slime == NULL){
-    slime = game_get_enemy_byName(game, "Rat2");
+    /* Objects are added again in the same order they had */
+    set = space_get_objects(game->spaces[i]);
+    while (set_get_nids(set) > 0)
+    {
+      set_del_pos(set, set_get_nids(set) - 1);
+    }
+    n_ids = game_state_get(buf, len, &pos, &ok);
+    for (j = 0; j < n_ids && ok; j++)
+    {
+      set_add(set, game_state_get(buf, len, &pos, &ok));
+    }
   }
-  /*Events only Occurs at Night*/
-  if(game->day_time == DAY|| game->last_cmd == ATTACK){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
+
+  /* Objects */
+  for (n = 0; n < MAX_OBJS && game->object[n] != NULL; n++)
+    ;
+  if (!ok || game_state_get(buf, len, &pos, &ok) != n)
+  {
     return ERROR;
   }
-
-  /*In case slime is already dead*/
-  if(slime_loc == -1){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
-    dialogue_set_event(game->dialogue, DE_NOTHING);
+  for (i = 0; i < n && ok; i++)
+  {
+    if (game_state_get(buf, len, &pos, &ok) != obj_get_id(game->object[i]))
+    {
+      return ERROR;
+    }
+    obj_set_location(game->object[i], game_state_get(buf, len, &pos, &ok));
+    object_set_movable(game->object[i], (BOOL)game_state_get(buf, len, &pos, &ok));
+    object_set_dependency(game->object[i], game_state_get(buf, len, &pos, &ok));
+    object_set_open(game->object[i], game_state_get(buf, len, &pos, &ok));
+    object_set_illuminate(game->object[i], (BOOL)game_state_get(buf, len, &pos, &ok));
+    object_set_turnedon(game->object[i], (BOOL)game_state_get(buf, len, &pos, &ok));
+    object_set_light_visible(game->object[i], (Light)game_state_get(buf, len, &pos, &ok));
+    object_set_crit(game->object[i], (int)game_state_get(buf, len, &pos, &ok));
+    object_set_durability(game->object[i], (int)game_state_get(buf, len, &pos, &ok));
+  }
+
+  /* Players */
+  for (n = 0; n < MAX_PLAYERS && game->player[n] != NULL; n++)
+    ;
+  if (!ok || game_state_get(buf, len, &pos, &ok) != n)
+  {
     return ERROR;
   }
+  for (i = 0; i < n && ok; i++)
+  {
+    if (game_state_get(buf, len, &pos, &ok) != player_get_id(game->player[i]))
+    {
+      return ERROR;
+    }
+    player_set_location(game->player[i], game_state_get(buf, len, &pos, &ok));
+    player_set_max_health(game->player[i], (int)game_state_get(buf, len, &pos, &ok));
+    player_set_health(game->player[i], (int)game_state_get(buf, len, &pos, &ok));
+    player_set_crit(game->player[i], (int)game_state_get(buf, len, &pos, &ok));
+    player_set_baseDmg(game->player[i], (int)game_state_get(buf, len, &pos, &ok));
+
+    inv = player_get_inventory(game->player[i]);
+    inventory_set_maxObjs(inv, (int)game_state_get(buf, len, &pos, &ok));
+    set = inventory_get_objects(inv);
+    while (set_get_nids(set) > 0)
+    {
+      set_del_pos(set, set_get_nids(set) - 1);
+    }
+    n_ids = game_state_get(buf, len, &pos, &ok);
+    for (j = 0; j < n_ids && ok; j++)
+    {
+      set_add(set, game_state_get(buf, len, &pos, &ok));
+    }
+  }
 
-  /*Sets the enemy on players location*/
-  enemy_set_location(slime, player_get_location(game->player[MAX_PLAYERS - 1]));
-
-  dialogue_set_event(game->dialogue, DE_SLIME);
-  return OK;
-}
+  /* Enemies */
+  for (n = 0; n < MAX_ENEMYS && game->enemy[n] != NULL; n++)
+    ;
+  if (!ok || game_state_get(buf, len, &pos, &ok) != n)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < n && ok; i++)
+  {
+    if (game_state_get(buf, len, &pos, &ok) != enemy_get_id(game->enemy[i]))
+    {
+      return ERROR;
+    }
+    enemy_set_location(game->enemy[i], game_state_get(buf, len, &pos, &ok));
+    enemy_set_health(game->enemy[i], (int)game_state_get(buf, len, &pos, &ok));
+    enemy_set_crit(game->enemy[i], (int)game_state_get(buf, len, &pos, &ok));
+    enemy_set_baseDmg(game->enemy[i], (int)game_state_get(buf, len, &pos, &ok));
 
-/**
- * @brief It executes DAYNIGHT event
- * 
- * Changes day to night and night to day 
- * 
- * @param game pointer to game struct
- * @return OK if event happens, ERROR if not
- */
-STATUS game_event_daynight(Game *game){
+    id = game_state_get(buf, len, &pos, &ok);
+    if (!ok || id < 0 || id >= ENEMY_LEN_NAME || pos + id > len)
+    {
+      return ERROR;
+    }
+    memcpy(name, buf + pos, id);
+    name[id] = '\0';
+    pos += id;
+    enemy_set_name(game->enemy[i], name);
+  }
 
-  if(game_get_time(game) == DAY){
-    dialogue_set_event(game->dialogue, DE_NIGHT);
-    game_set_time(game, NIGHT);
+  /* Links */
+  for (n = 0; n < MAX_LINKS && game->links[n] != NULL; n++)
+    ;
+  if (!ok || game_state_get(buf, len, &pos, &ok) != n)
+  {
+    return ERROR;
   }
-  else if(game_get_time(game) == NIGHT){
-    dialogue_set_event(game->dialogue, DE_DAY);
-    game_set_time(game, DAY);
+  for (i = 0; i < n && ok; i++)
+  {
+    if (game_state_get(buf, len, &pos, &ok) != link_get_id(game->links[i]))
+    {
+      return ERROR;
+    }
+    link_set_status(game->links[i], (LINK_STATUS)game_state_get(buf, len, &pos, &ok));
   }
 
-  return OK;
-}
+  /* Game */
+  game->day_time = (Time)game_state_get(buf, len, &pos, &ok);
+  game->last_cmd = (T_Command)game_state_get(buf, len, &pos, &ok);
+  game->last_event = (R_Event)game_state_get(buf, len, &pos, &ok);
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+  {
+    rng_state[i] = (unsigned long)game_state_get(buf, len, &pos, &ok);
+  }
 
-/**
- * @brief It executes SPAWN event
- * 
- * Player tps to entrance
- * 
- * @param game pointer to game struct
- * @return OK if event happens, ERROR if not
- */
-STATUS game_event_spawn(Game *game){
+  if (!ok || rng_set_state(game->rng, rng_state) == ERROR)
+  {
+    return ERROR;
+  }
 
-  /*Events only Occurs at Night*/
-  if(game->day_time == DAY || game->last_cmd != MOVE){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
+  if (game_rules_wheel_reset(game->events, game_state_get(buf, len, &pos, &ok)) == ERROR)
+  {
     return ERROR;
   }
-  
-  /*You cannot get lost while attacking*/
-  if(game->last_cmd == ATTACK){
-    dialogue_set_event(game->dialogue, DE_NOTHING);
+  for (i = 0; i < GAME_TIMERS && ok; i++)
+  {
+    due = game_state_get(buf, len, &pos, &ok);
+    if (due >= 0 && game_rules_wheel_set(game->events, i, due) == ERROR)
+    {
+      return ERROR;
+    }
+  }
+  if (!ok)
+  {
     return ERROR;
   }
 
-  /*Sets player to the initial room*/
-  player_set_location(game->player[0], SPACE_INITIAL);
+  /* The links may have changed under the light, so it is spread again */
+  game_set_lights(game);
+
+  /* The text shown belongs to the command that made the state */
+  game->inspection = " ";
+  dialogue_reset(game->dialogue);
 
-  dialogue_set_event(game->dialogue, DE_SPAWN);
   return OK;
 }
 
-/*Function that gets the enemy id based on the position it is located in the enemy array located in the game structure */
-Id game_get_enemy_id(Game *game, int num)
+/**
+ * @brief Appends a number to a state buffer
+ *
+ * Numbers are stored in 4 bytes, little endian. Nothing is written if
+ * buf is NULL or full, but pos always advances so the needed size is known.
+ */
+void game_state_put(unsigned char *buf, long max, long *pos, long value)
 {
+  unsigned long u = (unsigned long)value & 0xFFFFFFFFUL;
+  int i;
 
-  /* Error control */
-  if (!game || num < 0 || num > MAX_ENEMYS - 1)
+  for (i = 0; i < 4; i++)
   {
-    return NO_ID;
+    if (buf && *pos < max)
+    {
+      buf[*pos] = (unsigned char)((u >> (8 * i)) & 0xFF);
+    }
+    (*pos)++;
   }
-
-  return (Id)enemy_get_id(game->enemy[num]);
 }
 
-Id game_get_player_id(Game *game)
+/**
+ * @brief Reads a number written by game_state_put
+ *
+ * ok is set to FALSE if the buffer ends before the number.
+ */
+long game_state_get(const unsigned char *buf, long len, long *pos, BOOL *ok)
 {
+  unsigned long u = 0;
+  int i;
 
-  /* Error control */
-  if (!game)
+  if (*pos + 4 > len)
   {
-    return NO_ID;
+    *ok = FALSE;
+    return 0;
   }
 
-  return (Id)player_get_id(game->player[MAX_PLAYERS - 1]);
-}
-
-/** 
- * Function that gets the object id based on the position it is located in 
- * the object array located in the game structure 
- */
-Id game_get_object_id(Game *game, int num)
-{
-
-  /* Error control */
-  if (!game || num < 0 || num > MAX_ENEMYS - 1)
+  for (i = 0; i < 4; i++)
   {
-    return NO_ID;
+    u |= (unsigned long)buf[*pos + i] << (8 * i);
   }
+  *pos += 4;
 
-  return (Id)obj_get_id(game->object[num]);
-}
-
-Game *game_alloc2()
-{
-
-  Game *game = NULL;
-
-  game = (Game *)malloc(sizeof(Game));
-
-  /* Error control */
-  if (!game)
+  if (u & 0x80000000UL)
   {
-    fprintf(stderr, "Error saving memory for game(game_create)");
-    return NULL;
+    return -(long)((~u & 0xFFFFFFFFUL) + 1);
   }
-  game->inspection = "\0";
-  game->day_time = DAY;
-  game->last_event = NOTHING;
-  game->dialogue = dialogue_create();
 
-  return game;
+  return (long)u;
 }
+
 STATUS game_save(char *filename, Game* game)
 {
  int i = 0;
@@ -2294,6 +3392,12 @@ STATUS game_save(char *filename, Game* game)
 
   inventory_print_save("savedata.dat", player_inventory, 21);
 
+  /*Random events*/
+  game_rules_table_print_save("savedata.dat", game->table);
+
+  /*Triggers*/
+  trigger_print_save("savedata.dat", game->triggers);
+
   return OK;
 }
 
@@ -2309,140 +3413,30 @@ Dialogue *game_get_dialogue(Game *game)
 
 STATUS game_update_ls(Game *game)
 {
-  int i = 0;
-  Inventory *in = NULL;
-  Player *p = NULL;
-  Object *o = NULL;
+  int count = 0;
   Space *s = NULL;
 
-  if (!game)
+  if (!game || !game->player[MAX_PLAYERS - 1])
   {
     return ERROR;
   }
 
-  p = game_get_player(game, 21);
-  in = player_get_inventory(p);
-  s = game_get_space(game, player_get_location(p));
-
-  if (!p || !in || !s)
-  {
-    return ERROR;
-  }
+  count = game_count_lights(game);
+  s = game_get_space(game, player_get_location(game->player[MAX_PLAYERS - 1]));
+  game_move_lights(game, s, count);
 
-  if (space_get_light_status(s) == DARK)
+  /* Day and night do not change a fixed light, but a lantern lights it for good */
+  if (s && count > 0 && space_get_light_fixed(s) == TRUE && space_get_light_status(s) == DARK)
   {
-    for (i = 0; i < set_get_nids(inventory_get_objects(in)); i++)
+    if (space_set_light_status(s, BRIGHT) == ERROR)
     {
-      o = game_get_object(game,set_get_ids_by_number(inventory_get_objects(in), i));
-
-      if (o != NULL)
-      {
-        if (object_get_turnedon(o) == TRUE)
-        {
-          if (space_set_light_status(s, BRIGHT) == ERROR)
-          {
-            return ERROR;
-          }
-          break;
-        }
-      }
+      return ERROR;
     }
   }
 
   return OK;
 }
 
-STATUS game_update_time(Game *game)
-{
-  int i = 0;
-  Space *s = NULL;
-  Id id = NO_ID;
-  Time time;
-
-  if (!game)
-  {
-    return ERROR;
-  }
-
-  time = game_get_time(game);
-
-  for (i = 0; i < MAX_SPACES; i++)
-  {
-    if ((s = game->spaces[i]) != NULL && (id = space_get_id(s)) != NO_ID)
-    {
-      if (id != 121 && id != 125)
-      {
-        if (time == NIGHT)
-        {
-          if (space_set_light_status(s, DARK) == ERROR)
-          {
-            return ERROR;
-          }
-        } else 
-        {
-          if (space_set_light_status(s, BRIGHT) == ERROR)
-          {
-            return ERROR;
-          }          
-        }
-
-      } 
-    }
-  }   
-  return OK;
-}
-
-STATUS game_update_object(Game *game)
-{
-  Enemy *e1 = NULL, *e2 = NULL;
-  Object *key1 = NULL, *key2 = NULL;
-
-  if (!game)
-  {
-    return ERROR;
-  }
-
-  e1 = game_get_enemy(game, 42);
-  e2 = game_get_enemy(game, 43);
-  key1 = game_get_object(game, 399);
-  key2 = game_get_object(game, 385);
-
-  if (!e1 || !e2 || !key1 || !key2)
-  {
-    return ERROR;
-  }
-
-  if (enemy_get_health(e1) <= 0 && space_has_object(game_get_space(game, 127), obj_get_id(key1)) == FALSE && enemy_get_location(e1) != NO_ID)
-  {
-    obj_set_location(key1, 127);
-    space_add_objectid(game_get_space(game, 127), obj_get_id(key1));
-    enemy_set_health(e1, -1);
-    enemy_set_location(e1, -1);
-  }
-
-    if (enemy_get_health(e2) <= 0 && space_has_object(game_get_space(game, 126), obj_get_id(key2)) == FALSE && enemy_get_location(e2) != NO_ID)
-  {
-    obj_set_location(key2, 126);
-    space_add_objectid(game_get_space(game, 126), obj_get_id(key2));
-    enemy_set_health(e2, -1);
-    enemy_set_location(e2, -1);
-  }
-  
-  if (object_get_durability(game_get_object(game, 392)) <= 0)
-  {
-    inventory_remove_object(player_get_inventory(game_get_player(game, 21)), 392);
-    obj_set_location(game_get_object(game, 392), NO_ID);
-  }
-
-  if (object_get_durability(game_get_object(game, 393)) <= 0)
-  {
-    inventory_remove_object(player_get_inventory(game_get_player(game, 21)), 393);
-    obj_set_location(game_get_object(game, 393), NO_ID);
-  }
-
-  return OK;
-}
-
 STATUS game_update_enemy(Game *game)
 {
   int i = 0;
@@ -2478,6 +3472,8 @@ STATUS game_destroy_load(Game *game)
      return ERROR;
    } 
 
+  game->epoch++;
+
   for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
   {
     obj_destroy(game->object[i]);
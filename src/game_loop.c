@@ -8,18 +8,47 @@
  * @copyright GNU Public License
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <poll.h>
+#include <unistd.h>
 #include "../include/graphic_engine.h"
 #include "../include/game.h"
 #include "../include/command.h"
 #include "../include/game_managment.h"
+#include "../include/replay.h"
+#include "../include/render_stats.h"
+#include "../include/script.h"
+
+#define CLOCK_CATCHUP 5 /*!< Ticks played at most to catch up with the clock, the rest are skipped */
+
+/**
+ * @brief Clock of a real time game
+ *
+ * It keeps when the next tick is due and what has been typed of a line
+ * that has not been ended yet.
+ */
+typedef struct
+{
+  int tick_ms;          /*!< Milliseconds between two ticks */
+  struct timespec next; /*!< When the next tick is due (CLOCK_MONOTONIC) */
+  char line[WORD_SIZE]; /*!< Chars read of the next lines */
+  int len;              /*!< Number of chars in line */
+} Game_loop_clock;
 
 int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name);
-void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name);
+int game_loop_replay(Game *game, char *file_name, char *play_name, char *rec_name, int turn, Replay **rec);
+void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name, Replay *rec, int tick_ms);
+void game_loop_clock_start(Game_loop_clock *clk, int tick_ms);
+T_Command game_loop_clock_input(Game_loop_clock *clk, Game *game, Graphic_engine *gengine, int st, char *arg1, char *arg2);
+long game_loop_clock_wait(Game_loop_clock *clk);
+void game_loop_clock_next(Game_loop_clock *clk);
 void game_loop_cleanup(Game *game, Graphic_engine *gengine);
+void game_loop_stats(Render_stats *stats, char *stats_name);
 void print_syntaxinfo(char *argv[]);
 
 /**
@@ -37,11 +66,17 @@ int main(int argc, char *argv[])
   Graphic_engine *gengine;
   /* Used to able to save commands in log */
   char *wlog_name = NULL, *cmdf_name = NULL;
+  /* Used to record and replay games */
+  char *rec_name = NULL, *play_name = NULL;
+  Replay *rec = NULL;
+  int turn = -1;
+  /* Used to measure the renderer */
+  char *stats_name = NULL;
+  Render_stats *stats = NULL;
+  /* Used to play in real time */
+  int tick_ms = 0;
   int i; /* Used in loops */
 
-  /*Necessary for random features*/
-  srand(time(NULL));
-  
   /* Alloc game's struct in memory */
   game = game_alloc2();
   if (!game)
@@ -50,6 +85,9 @@ int main(int argc, char *argv[])
     return 1;
   }
 
+  /*Necessary for random features, "-s" may change it later*/
+  game_set_seed(game, (unsigned long)time(NULL));
+
   /* Check arguments in execution command */
   if (argc < 2) /* Incorrect syntax */
   {
@@ -61,7 +99,7 @@ int main(int argc, char *argv[])
     /*Loads game and waits for player interaction*/
     if (!game_loop_init(game, &gengine, argv[1]))
     {
-      game_loop_run(game, gengine, NULL, NULL);
+      game_loop_run(game, gengine, NULL, NULL, NULL, 0);
       game_loop_cleanup(game, gengine);
     }
   }
@@ -90,6 +128,36 @@ int main(int argc, char *argv[])
         i++;
         cmdf_name = argv[i];
       }
+      else if (strcmp(argv[i], "-s\0") == 0)
+      {
+        i++;
+        game_set_seed(game, strtoul(argv[i], NULL, 10));
+      }
+      else if (strcmp(argv[i], "-r\0") == 0)
+      {
+        i++;
+        rec_name = argv[i];
+      }
+      else if (strcmp(argv[i], "-p\0") == 0)
+      {
+        i++;
+        play_name = argv[i];
+      }
+      else if (strcmp(argv[i], "-t\0") == 0)
+      {
+        i++;
+        turn = atoi(argv[i]);
+      }
+      else if (strcmp(argv[i], "-f\0") == 0)
+      {
+        i++;
+        stats_name = argv[i];
+      }
+      else if (strcmp(argv[i], "-c\0") == 0)
+      {
+        i++;
+        tick_ms = atoi(argv[i]);
+      }
       else
       {
         fprintf(stderr, "\nWrong syntax. Argument %s unidentified.\n", argv[i]);
@@ -98,11 +166,36 @@ int main(int argc, char *argv[])
       }
     }
 
+    /*The ticks are not commands, so they can't be recorded*/
+    if (tick_ms > 0 && (rec_name || play_name))
+    {
+      fprintf(stderr, "\nA game in real time (\"-c\") can't be recorded or replayed.\n");
+      print_syntaxinfo(argv);
+      return 1;
+    }
+
+    if (stats_name)
+    {
+      stats = render_stats_create();
+    }
+
     if (!game_loop_init(game, &gengine, argv[1]))
     {
-      game_loop_run(game, gengine, wlog_name, cmdf_name);
+      graphic_engine_set_stats(gengine, stats);
+      if (!game_loop_replay(game, argv[1], play_name, rec_name, turn, &rec))
+      {
+        game_loop_run(game, gengine, wlog_name, cmdf_name, rec, tick_ms);
+      }
+      replay_destroy(rec);
       game_loop_cleanup(game, gengine);
     }
+
+    /*The render thread has finished, so every frame is in the statistics*/
+    if (stats)
+    {
+      game_loop_stats(stats, stats_name);
+      render_stats_destroy(stats);
+    }
   }
 
   return 0;
@@ -137,6 +230,60 @@ int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name)
   return 0;
 }
 
+/**
+ * @brief Moves the game to a turn of a replay and starts recording
+ * @author Ignacio Nunez
+ *
+ * @param game Pointer to the game, already loaded from file_name
+ * @param file_name name of the data file of the game
+ * @param play_name name of the replay to play. It has to be NULL if the game starts from the beginning.
+ * @param rec_name name of the replay to record. It has to be NULL if the game is not recorded.
+ * @param turn turn of play_name where the game continues, the last one if it is negative
+ * @param rec where the replay being recorded is returned, NULL if rec_name is NULL
+ * @return 0 if everything goes well 1 if there has been an error
+ */
+int game_loop_replay(Game *game, char *file_name, char *play_name, char *rec_name, int turn, Replay **rec)
+{
+  Replay *play = NULL;
+
+  *rec = NULL;
+
+  if (play_name)
+  {
+    play = replay_load(play_name);
+    if (!play)
+    {
+      fprintf(stderr, "Error while loading replay %s.\n", play_name);
+      return 1;
+    }
+
+    if (turn < 0 || turn > replay_get_turns(play))
+    {
+      turn = replay_get_turns(play);
+    }
+
+    if (replay_seek(play, game, turn) == ERROR)
+    {
+      fprintf(stderr, "Replay %s was not recorded with %s.\n", play_name, file_name);
+      replay_destroy(play);
+      return 1;
+    }
+    replay_destroy(play);
+  }
+
+  if (rec_name)
+  {
+    *rec = replay_record(rec_name, file_name, game, REPLAY_INTERVAL);
+    if (!*rec)
+    {
+      fprintf(stderr, "Error while creating replay %s.\n", rec_name);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
 /**
  * @brief Executes the game
  * @author Miguel Soto && Nicolas Victorino
@@ -146,15 +293,22 @@ int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name)
  * @param gengine pointer to the graphi engine
  * @param flog_name string name from file where to write every command executed. It has to be NULL if a log file is not wanted.
  * @param fcmd_name string name from file where to get every command to be executed. It has to be NULL if a command file is not used.
+ * @param rec replay where every command is recorded. It has to be NULL if the game is not recorded.
+ * @param tick_ms milliseconds between two ticks of a real time game, 0 (or a command file) to play turn by turn
  */
-void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name)
+void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name, Replay *rec, int tick_ms)
 {
   T_Command command = NO_CMD;
-  char arg1[MAX_ARG], arg2[MAX_ARG], input[MAX_ARG];
+  char arg1[MAX_ARG], arg2[MAX_ARG];
   int st = 5, wlog = 0, rcmd = 0;
-  FILE *flog = NULL, *fcmd = NULL;
+  FILE *flog = NULL;
+  Script *fcmd = NULL;
+  long next = 0;
   T_Command last_cmd;
-  extern char *cmd_to_str[N_CMD][N_CMDT];
+  Game_loop_clock clk;
+
+  arg1[0] = '\0';
+  arg2[0] = '\0';
 
   /*Cheks if the game has been initialized with the flag -l, that outputs a log with the commands used during the execution of the game*/
   if (flog_name)
@@ -173,7 +327,7 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
   if (fcmd_name)
   {
     rcmd = 1;
-    fcmd = fopen(fcmd_name, "r");
+    fcmd = script_load(fcmd_name);
     /*Error control*/
     if (!fcmd)
     {
@@ -182,22 +336,35 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
     }
   }
 
+  /*A command file is played as fast as it can, without a clock*/
+  if (tick_ms > 0 && rcmd == 0)
+  {
+    game_set_realtime(game, TRUE);
+    clk.len = 0;
+    game_loop_clock_start(&clk, tick_ms);
+  }
+
   for (; (command != EXIT) /*&& !game_is_over(game)*/;)
   {
     graphic_engine_paint_game(gengine, game, st);
 
     if (rcmd == 1)
     {
-      if (fgets(input, MAX_ARG, fcmd))
+      if (next < script_get_count(fcmd))
       {
-        command = command_get_file_input(input, arg1);
+        command = script_get(fcmd, next, arg1, arg2);
+        next++;
       }
       else
       {
-        /* If there  is an error at the beggining of the execution is here, so it exits the game*/
+        /*The script has ended, so the game ends too*/
         command = EXIT;
       }
     }
+    else if (tick_ms > 0)
+    {
+      command = game_loop_clock_input(&clk, game, gengine, st, arg1, arg2);
+    }
     else
     {
       command = command_get_user_input(arg1, arg2);
@@ -205,6 +372,12 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
 
     st = game_update(game, command, arg1, arg2);
 
+    /*Records the command, so the game can be played again*/
+    if (rec)
+    {
+      replay_add_command(rec, game, command, arg1, arg2);
+    }
+
     /*Cheks if the game is working in "log-mode" and if true it prints the commands in the output file*/
     if (wlog == 1)
     {
@@ -212,26 +385,28 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
       if (st == 0)
       {
         if ( last_cmd == 1 || last_cmd == 2 || last_cmd == 3 || last_cmd == 4 || last_cmd == 5 ) {
-          fprintf(flog, " %s (%s): ERROR\n", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+          fprintf(flog, " %s (%s): ERROR\n", command_get_name(last_cmd, CMDL), command_get_name(last_cmd, CMDS));
         } else {
-          fprintf(flog, " %s (%s) %s: ERROR\n", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS], arg1);
+          fprintf(flog, " %s (%s) %s: ERROR\n", command_get_name(last_cmd, CMDL), command_get_name(last_cmd, CMDS), arg1);
         }
       }
       else if (st == 1)
       {
         if ( last_cmd == 1 || last_cmd == 2 || last_cmd == 3 || last_cmd == 4 || last_cmd == 5 ) {
-          fprintf(flog, " %s (%s): OK\n", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+          fprintf(flog, " %s (%s): OK\n", command_get_name(last_cmd, CMDL), command_get_name(last_cmd, CMDS));
         } else {
-          fprintf(flog, " %s (%s) %s: OK\n", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS], arg1);
+          fprintf(flog, " %s (%s) %s: OK\n", command_get_name(last_cmd, CMDL), command_get_name(last_cmd, CMDS), arg1);
         }
       }
       else
       {
-        fprintf(flog, " %s (%s)\n", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+        fprintf(flog, " %s (%s)\n", command_get_name(last_cmd, CMDL), command_get_name(last_cmd, CMDS));
       }
     }
   }
 
+  /*The last frames may still be on their way to the terminal*/
+  graphic_engine_wait(gengine);
   fprintf(stdout, "\n");
 
   /*Closes flog (output of "log-mode")*/
@@ -244,7 +419,7 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
   /*Closes command file (input of "<-mode")*/
   if (fcmd)
   {
-    fclose(fcmd);
+    script_destroy(fcmd);
     fcmd = NULL;
   }
 
@@ -252,6 +427,134 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
 }
 
 
+/**
+ * @brief Starts the clock of a real time game
+ * @author Ignacio Nunez
+ *
+ * @param clk pointer to the clock
+ * @param tick_ms milliseconds between two ticks
+ */
+void game_loop_clock_start(Game_loop_clock *clk, int tick_ms)
+{
+  clk->tick_ms = tick_ms;
+  clock_gettime(CLOCK_MONOTONIC, &clk->next);
+  game_loop_clock_next(clk);
+}
+
+/**
+ * @brief Waits for the next command of a real time game
+ * @author Ignacio Nunez
+ *
+ * The standard input is polled until the next tick is due, so nothing is
+ * done between ticks and a line is played as soon as it is ended. Every
+ * tick that is due lets the time go on (game_tick) and paints the game.
+ *
+ * @param clk pointer to the clock
+ * @param game pointer to the game
+ * @param gengine pointer to the graphic engine
+ * @param st status of the last command, painted again with every tick
+ * @param arg1 string where the first argument is saved (MAX_ARG chars)
+ * @param arg2 string where the second argument is saved (MAX_ARG chars)
+ * @return the command typed, or EXIT if the input has ended
+ */
+T_Command game_loop_clock_input(Game_loop_clock *clk, Game *game, Graphic_engine *gengine, int st, char *arg1, char *arg2)
+{
+  struct pollfd pfd;
+  T_Command cmd = NO_CMD;
+  char *eol = NULL;
+  long wait_ms;
+  int n, ticks;
+
+  while (1)
+  {
+    /* A whole line may have been read with the last one */
+    clk->line[clk->len] = '\0';
+    eol = strchr(clk->line, '\n');
+    if (eol || clk->len == WORD_SIZE - 1)
+    {
+      n = eol ? (int)(eol - clk->line) + 1 : clk->len;
+      if (eol)
+      {
+        *eol = '\0';
+      }
+      cmd = command_get_line_input(clk->line, arg1, arg2);
+      clk->len -= n;
+      memmove(clk->line, clk->line + n, clk->len);
+      if (cmd != NO_CMD)
+      {
+        return cmd;
+      }
+      continue;
+    }
+
+    for (ticks = 0; (wait_ms = game_loop_clock_wait(clk)) == 0; ticks++)
+    {
+      if (ticks == CLOCK_CATCHUP)
+      {
+        /* Too far behind (the computer was suspended), start again from now */
+        clock_gettime(CLOCK_MONOTONIC, &clk->next);
+        game_loop_clock_next(clk);
+        break;
+      }
+      game_tick(game);
+      graphic_engine_paint_game(gengine, game, st);
+      game_loop_clock_next(clk);
+    }
+    if (ticks > 0)
+    {
+      continue;
+    }
+
+    pfd.fd = STDIN_FILENO;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, (int)wait_ms) > 0)
+    {
+      n = (int)read(STDIN_FILENO, clk->line + clk->len, WORD_SIZE - 1 - clk->len);
+      if (n <= 0)
+      {
+        return EXIT;
+      }
+      clk->len += n;
+    }
+  }
+}
+
+/**
+ * @brief Milliseconds until the next tick of a clock
+ * @author Ignacio Nunez
+ *
+ * @param clk pointer to the clock
+ * @return milliseconds (rounded up), 0 if the tick is due
+ */
+long game_loop_clock_wait(Game_loop_clock *clk)
+{
+  struct timespec now;
+  long ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ns = (long)(clk->next.tv_sec - now.tv_sec) * 1000000000L + (clk->next.tv_nsec - now.tv_nsec);
+
+  return ns <= 0 ? 0 : (ns + 999999L) / 1000000L;
+}
+
+/**
+ * @brief Moves a clock to its next tick
+ * @author Ignacio Nunez
+ *
+ * @param clk pointer to the clock
+ */
+void game_loop_clock_next(Game_loop_clock *clk)
+{
+  clk->next.tv_sec += clk->tick_ms / 1000;
+  clk->next.tv_nsec += (clk->tick_ms % 1000) * 1000000L;
+  if (clk->next.tv_nsec >= 1000000000L)
+  {
+    clk->next.tv_sec++;
+    clk->next.tv_nsec -= 1000000000L;
+  }
+}
+
 /**
  * @brief Ends and cleans the game
  * @author Profesores PPROG
@@ -266,6 +569,29 @@ void game_loop_cleanup(Game *game, Graphic_engine *gengine)
   graphic_engine_destroy(gengine);
 }
 
+/**
+ * @brief Writes the statistics of the renderer
+ * @author Ignacio Nunez
+ *
+ * @param stats pointer to the statistics
+ * @param stats_name name of the file where they are written
+ */
+void game_loop_stats(Render_stats *stats, char *stats_name)
+{
+  FILE *f = NULL;
+
+  f = fopen(stats_name, "w");
+  /*Error control*/
+  if (!f)
+  {
+    fprintf(stderr, "There was an error opening stats_file.\n");
+    return;
+  }
+
+  render_stats_print(stats, f);
+  fclose(f);
+}
+
 /**
  * @brief Prints syntax info when running the  program.
  * @author Miguel Soto
@@ -276,7 +602,12 @@ void print_syntaxinfo(char *argv[])
 {
   fprintf(stderr, "\nUse: %s <game_data_file>.\n", argv[0]);
   fprintf(stderr, "If you want to save inserted commands use the flag \"-l\" with the file name\n");
-  fprintf(stderr, "Also, if you want to execute commands from a file use \"<\" with the file name\n \n");
-  fprintf(stderr, "\tGlobal syntax: %s <game_data_file> [-l <log_file>] [< <command_file>]\n", argv[0]);
+  fprintf(stderr, "Also, if you want to execute commands from a file use \"<\" with the file name\n");
+  fprintf(stderr, "To repeat the same random events use the flag \"-s\" with a seed number\n");
+  fprintf(stderr, "To record the game use the flag \"-r\" with the replay file name\n");
+  fprintf(stderr, "To continue a recorded game use the flag \"-p\" with the replay file name and optionally \"-t\" with the turn\n");
+  fprintf(stderr, "To measure how long each frame takes to paint use the flag \"-f\" with the stats file name\n");
+  fprintf(stderr, "To let the time go on while you think use the flag \"-c\" with the milliseconds between two ticks\n \n");
+  fprintf(stderr, "\tGlobal syntax: %s <game_data_file> [-l <log_file>] [< <command_file>] [-s <seed>] [-r <replay_file>] [-p <replay_file> [-t <turn>]] [-f <stats_file>] [-c <tick_ms>]\n", argv[0]);
   fprintf(stderr, "\tArguments between [ ] are optional.\n \n");
 }
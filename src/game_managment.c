@@ -8,6 +8,8 @@
  * @copyright GNU Public License
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -33,6 +35,8 @@ STATUS game_load_players(Game *game, char *filename);
 STATUS game_load_enemy(Game *game, char *filename);
 STATUS game_load_link(Game *game, char *filename);
 STATUS game_load_inventory(Game *game, char *filename);
+STATUS game_load_events(Game *game, char *filename);
+STATUS game_load_triggers(Game *game, char *filename);
 STATUS game_managment_save(char *filename, Game* game);
 STATUS game_managment_load(char *filename, Game *game);
 
@@ -83,6 +87,22 @@ STATUS game_create_from_file(Game *game, char *filename)
   {
     return ERROR;
   }
+
+  if (game_load_events(game, filename) == ERROR)
+  {
+    return ERROR;
+  }
+
+  if (game_load_triggers(game, filename) == ERROR)
+  {
+    return ERROR;
+  }
+
+  /* Once the links are there the light can spread */
+  if (game_set_lights(game) == ERROR)
+  {
+    return ERROR;
+  }
   
   /* The player and the object are located in the first space */
 
@@ -121,7 +141,7 @@ STATUS game_load_spaces(Game *game, char *filename)
   char name[WORD_SIZE] = "";
   char brief_description[WORD_SIZE] = "";
   char long_description[WORD_SIZE] = "";
-  char *toks = NULL, *aux;
+  char *toks = NULL, *aux, *save = NULL;
   char **gdesc = NULL;
   Id id = NO_ID;
   Floor floor;
@@ -146,15 +166,15 @@ STATUS game_load_spaces(Game *game, char *filename)
   {
     if (strncmp("#s:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(name, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(brief_description, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(long_description, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       ls = atol(toks);
 
       gdesc = space_create_gdesc();
@@ -165,17 +185,17 @@ STATUS game_load_spaces(Game *game, char *filename)
 
       for (i = 0; i < TAM_GDESC_Y; i++)
       {
-        aux = strtok(NULL, "|");
+        aux = strtok_r(NULL, "|", &save);
         for (j = 0; j < strlen(aux) && j < TAM_GDESC_X; j++)
         {
           gdesc[i][j] = aux[j];
         }
       }
 
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       floor = atoi(toks);
 
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       if (atoi(toks) == 1)
       {
         fire = TRUE;
@@ -228,7 +248,7 @@ STATUS game_load_objs(Game *game, char *filename)
   char line[WORD_SIZE] = "";
   char name[WORD_SIZE] = "";
   char description[WORD_SIZE] = "";
-  char *toks = NULL;
+  char *toks = NULL, *save = NULL;
   Id id = NO_ID, pos = NO_ID;
   Object *obj = NULL;
   BOOL movable, illuminate, turnedon;
@@ -254,29 +274,29 @@ STATUS game_load_objs(Game *game, char *filename)
   {
     if (strncmp("#o:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(name, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(description, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       pos = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       movable = atoi(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       dependency = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       open = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       illuminate = atoi(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       turnedon = atoi(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       light_visible = atoi(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       crit = atoi(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       durability = atoi(toks);
 
 
@@ -335,7 +355,7 @@ STATUS game_load_players(Game *game, char *filename)
   FILE *file = NULL;
   char line[WORD_SIZE] = "";
   char name[WORD_SIZE] = "";
-  char *toks = NULL;
+  char *toks = NULL, *save = NULL;
   Id id = NO_ID, location = NO_ID;
   int objects, health;
   Player *player = NULL;
@@ -367,19 +387,19 @@ STATUS game_load_players(Game *game, char *filename)
   {
     if (strncmp("#p:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(name, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       location = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       health = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       objects = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       crit = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       base_dmg = atol(toks);
       
       gdesc = player_create_gdesc();
@@ -390,7 +410,7 @@ STATUS game_load_players(Game *game, char *filename)
 
       for (i = 0; i < PLAYER_GDESC_Y; i++)
       {
-        aux = strtok(NULL, "|");
+        aux = strtok_r(NULL, "|", &save);
         for (j = 0; j < strlen(aux) && j < PLAYER_GDESC_X; j++)
         {
           gdesc[i][j] = aux[j];
@@ -449,7 +469,7 @@ STATUS game_load_enemy(Game *game, char *filename)
   FILE *file = NULL;
   char line[WORD_SIZE] = "";
   char name[WORD_SIZE] = "";
-  char *toks = NULL;
+  char *toks = NULL, *save = NULL;
   Id id = NO_ID, location = NO_ID;
   int health;
   Enemy *enemy = NULL;
@@ -481,17 +501,17 @@ STATUS game_load_enemy(Game *game, char *filename)
   {
     if (strncmp("#e:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(name, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       location = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       health = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       crit = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       base_dmg = atol(toks);
 
       gdesc = enemy_create_gdesc();
@@ -502,7 +522,7 @@ STATUS game_load_enemy(Game *game, char *filename)
 
       for (i = 0; i < ENEMY_GDESC_Y; i++)
       {
-        aux = strtok(NULL, "|");
+        aux = strtok_r(NULL, "|", &save);
         for (j = 0; j < strlen(aux) && j < ENEMY_GDESC_X; j++)
         {
           gdesc[i][j] = aux[j];
@@ -560,7 +580,7 @@ STATUS game_load_link(Game *game, char *filename)
   FILE *file = NULL;
   char line[WORD_SIZE] = "";
   char name[WORD_SIZE] = "";
-  char *toks = NULL;
+  char *toks = NULL, *save = NULL;
   Id id = NO_ID, id_start = NO_ID, id_dest = NO_ID;
   DIRECTION dir = ND;
   LINK_STATUS status = CLOSE;
@@ -590,16 +610,16 @@ STATUS game_load_link(Game *game, char *filename)
   {
     if (strncmp("#l:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       strcpy(name, toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       id_start = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       id_dest = atol(toks);
 
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       switch (atoi(toks))
       {
       case 0:
@@ -631,7 +651,7 @@ STATUS game_load_link(Game *game, char *filename)
         break;
       }
 
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       switch (atoi(toks))
       {
       case 1:
@@ -686,7 +706,7 @@ STATUS game_load_inventory(Game *game, char *filename)
 {
  FILE *file = NULL;
   char line[WORD_SIZE] = "";
-  char *toks = NULL;
+  char *toks = NULL, *save = NULL;
   Id id = NO_ID, id_player = NO_ID;
   STATUS status = OK;
 
@@ -712,9 +732,9 @@ STATUS game_load_inventory(Game *game, char *filename)
   {
     if (strncmp("#i:", line, 3) == 0)
     {
-      toks = strtok(line + 3, "|");
+      toks = strtok_r(line + 3, "|", &save);
       id = atol(toks);
-      toks = strtok(NULL, "|");
+      toks = strtok_r(NULL, "|", &save);
       id_player = atol(toks);
 
       /*If debug is being used, it will print all the information
@@ -786,3 +806,181 @@ GAME_IS_ELEMENT id_type(Id id)
     return '\0';
   }
 }
+
+/**
+ * @brief Loads the random events of the game
+ * @author Ignacio Nunez
+ *
+ * Each line is the name of the event, its chance each turn in percent and
+ * the names of its conditions separated by commas (none if it has none).
+ * A map without random events gets the usual ones.
+ *
+ * @param game pointer to game
+ * @param filename pointer to the file from where it is going to load the events
+ * @return OK if everything is right ERROR if something went wrong
+ */
+STATUS game_load_events(Game *game, char *filename)
+{
+  FILE *file = NULL;
+  char line[WORD_SIZE] = "";
+  char *toks = NULL, *save = NULL, *conds = NULL, *cond_save = NULL;
+  Event_table *table = NULL;
+  R_Event event = NOTHING;
+  int chance = 0, cond = COND_NONE, aux;
+  STATUS status = OK;
+
+  /*Error control*/
+  if (!filename)
+  {
+    return ERROR;
+  }
+
+  /*Error control*/
+  file = fopen(filename, "r");
+  if (file == NULL)
+  {
+    return ERROR;
+  }
+
+  table = game_rules_table_create();
+  if (!table)
+  {
+    fclose(file);
+    return ERROR;
+  }
+
+  while (status == OK && fgets(line, WORD_SIZE, file))
+  {
+    if (strncmp("#r:", line, 3) == 0)
+    {
+      toks = strtok_r(line + 3, "|", &save);
+      event = game_rules_event_get_byName(toks);
+      toks = strtok_r(NULL, "|", &save);
+      chance = toks ? atoi(toks) : 0;
+      conds = strtok_r(NULL, "|", &save);
+
+      cond = COND_NONE;
+      for (toks = conds ? strtok_r(conds, ",", &cond_save) : NULL; toks; toks = strtok_r(NULL, ",", &cond_save))
+      {
+        aux = game_rules_cond_get_byName(toks);
+        if (aux == -1)
+        {
+          status = ERROR;
+        }
+        cond |= aux;
+      }
+
+#ifdef DEBUG
+      printf("Leido: %d|%d|%d\n", event, chance, cond);
+#endif
+
+      /*Unknown events or chances adding up to more than 100 are mistakes of the map*/
+      if (!conds || status == ERROR || game_rules_table_add(table, event, chance, cond) == ERROR)
+      {
+        status = ERROR;
+      }
+    }
+  }
+
+  if (ferror(file))
+  {
+    status = ERROR;
+  }
+  fclose(file);
+
+  if (status == OK && game_rules_table_get_count(table) == 0)
+  {
+    status = game_rules_table_add_default(table);
+  }
+
+  if (status == ERROR)
+  {
+    game_rules_table_destroy(table);
+    return ERROR;
+  }
+
+  return game_set_events(game, table);
+}
+
+/**
+ * @brief Loads the triggers of the game
+ * @author Ignacio Nunez
+ *
+ * Each line is the type of the trigger and the id it is run for; a death
+ * also has the object dropped and its space. It goes after the spaces, as
+ * the light triggers are set in them.
+ *
+ * @param game pointer to game
+ * @param filename pointer to the file from where it is going to load the triggers
+ * @return OK if everything is right ERROR if something went wrong
+ */
+STATUS game_load_triggers(Game *game, char *filename)
+{
+  FILE *file = NULL;
+  char line[WORD_SIZE] = "";
+  char *toks = NULL, *save = NULL;
+  Triggers *triggers = NULL;
+  T_Trigger type = T_NONE;
+  Id subject = NO_ID, object = NO_ID, space = NO_ID;
+  STATUS status = OK;
+
+  /*Error control*/
+  if (!filename)
+  {
+    return ERROR;
+  }
+
+  /*Error control*/
+  file = fopen(filename, "r");
+  if (file == NULL)
+  {
+    return ERROR;
+  }
+
+  triggers = trigger_create();
+  if (!triggers)
+  {
+    fclose(file);
+    return ERROR;
+  }
+
+  while (status == OK && fgets(line, WORD_SIZE, file))
+  {
+    if (strncmp("#t:", line, 3) == 0)
+    {
+      toks = strtok_r(line + 3, "|", &save);
+      type = trigger_get_type_byName(toks);
+      toks = strtok_r(NULL, "|", &save);
+      subject = toks ? atol(toks) : NO_ID;
+      object = NO_ID;
+      space = NO_ID;
+      if (type == T_DEATH)
+      {
+        toks = strtok_r(NULL, "|", &save);
+        object = toks ? atol(toks) : NO_ID;
+        toks = strtok_r(NULL, "|", &save);
+        space = toks ? atol(toks) : NO_ID;
+      }
+
+#ifdef DEBUG
+      printf("Leido: %d|%ld|%ld|%ld\n", type, subject, object, space);
+#endif
+
+      status = trigger_add(triggers, type, subject, object, space);
+    }
+  }
+
+  if (ferror(file))
+  {
+    status = ERROR;
+  }
+  fclose(file);
+
+  if (status == ERROR)
+  {
+    trigger_destroy(triggers);
+    return ERROR;
+  }
+
+  return game_set_triggers(game, triggers);
+}
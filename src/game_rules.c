@@ -13,44 +13,529 @@
 #include <string.h>
 #include <strings.h>
 #include <time.h>
+#include <math.h>
 #include "../include/game_rules.h"
 #include "../include/types.h"
 
+#define WHEEL_LEVEL2 (WHEEL_SLOTS * WHEEL_SLOTS) /*!< Turns covered by the two levels of the wheel */
+#define WHEEL_NONE -1                            /*!< No timer, end of a list */
+#define DELAY_SCALE 1000000                      /*!< Steps of the random number used to get a delay */
+#define N_EVENT_NAMES 5                          /*!< Number of events with a name */
+#define N_COND_NAMES 5                           /*!< Number of conditions with a name */
+
+/**
+ * @brief Events by their name in the map file
+ */
+static const struct
+{
+    R_Event event;  /*!< Event */
+    char *name;     /*!< Name */
+} event_names[N_EVENT_NAMES] = {
+    {MOVE_OBJ, "move_obj"},
+    {TRAP, "trap"},
+    {SLIME, "slime"},
+    {DAYNIGHT, "daynight"},
+    {SPAWN, "spawn"}};
+
+/**
+ * @brief Conditions by their name in the map file
+ */
+static const struct
+{
+    int cond;   /*!< COND_ flag */
+    char *name; /*!< Name */
+} cond_names[N_COND_NAMES] = {
+    {COND_NONE, "none"},
+    {COND_NIGHT, "night"},
+    {COND_DAY, "day"},
+    {COND_MOVE, "move"},
+    {COND_NOATTACK, "noattack"}};
+
+/**
+ * @brief Wheel
+ *
+ * Each timer is in one list: a slot of the first level, a slot of the
+ * second level or the list of the timers further away. The lists are
+ * linked by the indexes of the timers.
+ */
+struct _Wheel
+{
+    long now;                      /*!< Current turn */
+    long due[WHEEL_TIMERS];        /*!< Turn each timer is due, -1 if it is not set */
+    int next[WHEEL_TIMERS];        /*!< Next timer in its list */
+    int prev[WHEEL_TIMERS];        /*!< Previous timer in its list */
+    int *list[WHEEL_TIMERS];       /*!< First of the list each timer is in, NULL if it is not set */
+    int level1[WHEEL_SLOTS];       /*!< Timers due in the next WHEEL_SLOTS turns, by turn % WHEEL_SLOTS */
+    int level2[WHEEL_SLOTS];       /*!< Timers due in the next WHEEL_LEVEL2 turns, by (turn / WHEEL_SLOTS) % WHEEL_SLOTS */
+    int far;                       /*!< Timers due after that */
+};
+
+/**
+ * @brief Event_table
+ *
+ * Besides the entries, it keeps their alias table: slot i of the table
+ * is entry i with prob[i] out of count * chance in a draw, and entry
+ * alias[i] otherwise. It is built again every time an entry is added.
+ */
+struct _Event_table
+{
+    int count;                       /*!< Number of entries */
+    int chance;                      /*!< Sum of the chances of the entries */
+    R_Event event[EVENT_TABLE_SIZE]; /*!< Event of each entry */
+    int weight[EVENT_TABLE_SIZE];    /*!< Chance of each entry */
+    int cond[EVENT_TABLE_SIZE];      /*!< Conditions of each entry */
+    int prob[EVENT_TABLE_SIZE];      /*!< Part of each slot that goes to its own entry */
+    int alias[EVENT_TABLE_SIZE];     /*!< Entry the rest of each slot goes to */
+};
+
 /*Private functions*/
-int random();
+void game_rules_wheel_link(Wheel *w, int timer);
+void game_rules_wheel_unlink(Wheel *w, int timer);
+void game_rules_wheel_cascade(Wheel *w, int *list);
+void game_rules_table_build(Event_table *t);
+
+/*Gets in how many turns something happens again*/
+long game_rules_get_delay(Rng *rng, int percent){
+    double u;
+
+    /*Error control*/
+    if(!rng || percent < 1 || percent > 100){
+        return -1;
+    }
+    if(percent == 100){
+        return 1;
+    }
+
+    /*Turns until the first success of a chance of percent% each turn*/
+    u = (rng_range(rng, DELAY_SCALE) + 1) / (double)DELAY_SCALE;
+
+    return 1 + (long)floor(log(u) / log(1 - percent / 100.0));
+}
+
+/*Allocates a timer wheel*/
+Wheel *game_rules_wheel_create(long now){
+    Wheel *w = NULL;
+
+    w = (Wheel *)malloc(sizeof(Wheel));
+    if(!w){
+        return NULL;
+    }
+
+    game_rules_wheel_reset(w, now);
+
+    return w;
+}
+
+/*Frees a timer wheel*/
+STATUS game_rules_wheel_destroy(Wheel *w){
+    /*Error control*/
+    if(!w){
+        return ERROR;
+    }
+
+    free(w);
+
+    return OK;
+}
+
+/*Sets a timer*/
+STATUS game_rules_wheel_set(Wheel *w, int timer, long due){
+    /*Error control*/
+    if(!w || timer < 0 || timer >= WHEEL_TIMERS || due <= w->now){
+        return ERROR;
+    }
+
+    game_rules_wheel_unlink(w, timer);
+    w->due[timer] = due;
+    game_rules_wheel_link(w, timer);
+
+    return OK;
+}
+
+/*Stops a timer*/
+STATUS game_rules_wheel_stop(Wheel *w, int timer){
+    /*Error control*/
+    if(!w || timer < 0 || timer >= WHEEL_TIMERS){
+        return ERROR;
+    }
+
+    game_rules_wheel_unlink(w, timer);
+
+    return OK;
+}
+
+/*Gets the turn a timer is due*/
+long game_rules_wheel_get_due(Wheel *w, int timer){
+    /*Error control*/
+    if(!w || timer < 0 || timer >= WHEEL_TIMERS){
+        return -1;
+    }
+
+    return w->due[timer];
+}
+
+/*Moves a wheel to the next turn*/
+int game_rules_wheel_next(Wheel *w, int *due){
+    int timer, n = 0, i, aux;
+
+    /*Error control*/
+    if(!w || !due){
+        return -1;
+    }
+
+    w->now++;
+
+    /*A new group of turns: its timers go down to the first level*/
+    if(w->now % WHEEL_SLOTS == 0){
+        if(w->now % WHEEL_LEVEL2 == 0){
+            game_rules_wheel_cascade(w, &w->far);
+        }
+        game_rules_wheel_cascade(w, &w->level2[(w->now / WHEEL_SLOTS) % WHEEL_SLOTS]);
+    }
+
+    for(timer = w->level1[w->now % WHEEL_SLOTS]; timer != WHEEL_NONE; timer = aux){
+        aux = w->next[timer];
+        if(w->due[timer] == w->now){
+            game_rules_wheel_unlink(w, timer);
+            /*From the lowest timer*/
+            for(i = n; i > 0 && due[i - 1] > timer; i--){
+                due[i] = due[i - 1];
+            }
+            due[i] = timer;
+            n++;
+        }
+    }
+
+    return n;
+}
+
+/*Gets the current turn of a wheel*/
+long game_rules_wheel_get_now(Wheel *w){
+    /*Error control*/
+    if(!w){
+        return -1;
+    }
+
+    return w->now;
+}
+
+/*Moves a wheel to a turn, stopping every timer*/
+STATUS game_rules_wheel_reset(Wheel *w, long now){
+    int i;
+
+    /*Error control*/
+    if(!w || now < 0){
+        return ERROR;
+    }
+
+    w->now = now;
+    for(i = 0; i < WHEEL_TIMERS; i++){
+        w->due[i] = -1;
+        w->next[i] = WHEEL_NONE;
+        w->prev[i] = WHEEL_NONE;
+        w->list[i] = NULL;
+    }
+    for(i = 0; i < WHEEL_SLOTS; i++){
+        w->level1[i] = WHEEL_NONE;
+        w->level2[i] = WHEEL_NONE;
+    }
+    w->far = WHEEL_NONE;
+
+    return OK;
+}
+
+/**
+ * @brief Puts a timer in the list of its due turn
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param timer timer, not in any list
+ */
+void game_rules_wheel_link(Wheel *w, int timer){
+    long turns = w->due[timer] - w->now;
+    int *list;
+
+    if(turns < WHEEL_SLOTS){
+        list = &w->level1[w->due[timer] % WHEEL_SLOTS];
+    }
+    else if(turns < WHEEL_LEVEL2){
+        list = &w->level2[(w->due[timer] / WHEEL_SLOTS) % WHEEL_SLOTS];
+    }
+    else{
+        list = &w->far;
+    }
+
+    w->list[timer] = list;
+    w->prev[timer] = WHEEL_NONE;
+    w->next[timer] = *list;
+    if(*list != WHEEL_NONE){
+        w->prev[*list] = timer;
+    }
+    *list = timer;
+}
+
+/**
+ * @brief Takes a timer out of its list, stopping it
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param timer timer, it may be stopped already
+ */
+void game_rules_wheel_unlink(Wheel *w, int timer){
+    if(w->list[timer] == NULL){
+        return;
+    }
+
+    if(w->prev[timer] != WHEEL_NONE){
+        w->next[w->prev[timer]] = w->next[timer];
+    }
+    else{
+        *w->list[timer] = w->next[timer];
+    }
+    if(w->next[timer] != WHEEL_NONE){
+        w->prev[w->next[timer]] = w->prev[timer];
+    }
+
+    w->list[timer] = NULL;
+    w->next[timer] = WHEEL_NONE;
+    w->prev[timer] = WHEEL_NONE;
+    w->due[timer] = -1;
+}
+
+/**
+ * @brief Puts every timer of a list in the list of its due turn again
+ * @author Ignacio Nunez
+ *
+ * @param w a pointer to the wheel
+ * @param list first of the list
+ */
+void game_rules_wheel_cascade(Wheel *w, int *list){
+    int timer, aux;
+
+    timer = *list;
+    *list = WHEEL_NONE;
+    for(; timer != WHEEL_NONE; timer = aux){
+        aux = w->next[timer];
+        game_rules_wheel_link(w, timer);
+    }
+}
+
+/*Allocates an event table*/
+Event_table *game_rules_table_create(){
+    Event_table *t = NULL;
+
+    t = (Event_table *)malloc(sizeof(Event_table));
+    if(!t){
+        return NULL;
+    }
+
+    t->count = 0;
+    t->chance = 0;
+
+    return t;
+}
+
+/*Frees an event table*/
+STATUS game_rules_table_destroy(Event_table *t){
+    /*Error control*/
+    if(!t){
+        return ERROR;
+    }
+
+    free(t);
+
+    return OK;
+}
+
+/*Adds an entry to an event table*/
+STATUS game_rules_table_add(Event_table *t, R_Event event, int chance, int cond){
+    /*Error control*/
+    if(!t || event == NOTHING || chance < 1 || t->chance + chance > 100 || t->count == EVENT_TABLE_SIZE){
+        return ERROR;
+    }
+
+    t->event[t->count] = event;
+    t->weight[t->count] = chance;
+    t->cond[t->count] = cond;
+    t->count++;
+    t->chance += chance;
+
+    game_rules_table_build(t);
+
+    return OK;
+}
+
+/*Adds the entries used when a map has no events*/
+STATUS game_rules_table_add_default(Event_table *t){
+    if(game_rules_table_add(t, MOVE_OBJ, EVENT_TWO - EVENT_ONE, COND_NIGHT | COND_MOVE) == ERROR ||
+       game_rules_table_add(t, TRAP, EVENT_THREE - EVENT_TWO, COND_NIGHT | COND_MOVE) == ERROR ||
+       game_rules_table_add(t, SLIME, EVENT_FOUR - EVENT_THREE, COND_NIGHT | COND_NOATTACK) == ERROR ||
+       game_rules_table_add(t, DAYNIGHT, EVENT_FIVE - EVENT_FOUR, COND_NONE) == ERROR ||
+       game_rules_table_add(t, SPAWN, 100 - EVENT_FIVE, COND_NIGHT | COND_MOVE | COND_NOATTACK) == ERROR){
+        return ERROR;
+    }
 
-/*Generates a random event by 
-    percentages and returns it*/
-R_Event game_rules_get_event(){
-    int magic;
+    return OK;
+}
+
+/*Gets the number of entries of an event table*/
+int game_rules_table_get_count(Event_table *t){
+    /*Error control*/
+    if(!t){
+        return -1;
+    }
+
+    return t->count;
+}
 
-    magic = random();
+/*Gets the chance each turn that any event of a table happens*/
+int game_rules_table_get_chance(Event_table *t){
+    /*Error control*/
+    if(!t){
+        return -1;
+    }
+
+    return t->chance;
+}
 
-    if(magic >= EVENT_FIVE){
-        return SPAWN;
+/*Draws the entry of an event table that happens*/
+R_Event game_rules_table_get(Event_table *t, Rng *rng, int *cond){
+    int r, i;
+
+    /*Error control*/
+    if(!t || !rng || !cond || t->count == 0){
+        return NOTHING;
     }
-    if(magic >= EVENT_FOUR){
-        return DAYNIGHT;
+
+    /*One number for both the slot and the part of it*/
+    r = rng_range(rng, t->count * t->chance);
+    i = r / t->chance;
+    if(r % t->chance >= t->prob[i]){
+        i = t->alias[i];
     }
-    if(magic >= EVENT_THREE){
-        return SLIME;
+
+    *cond = t->cond[i];
+    return t->event[i];
+}
+
+/*Prints the entries of an event table in the save file*/
+STATUS game_rules_table_print_save(char *filename, Event_table *t){
+    FILE *file = NULL;
+    int i, j, k, first;
+
+    /*Error control*/
+    if(!t || !filename){
+        return ERROR;
     }
-    if(magic >= EVENT_TWO){
-        return TRAP;
+
+    file = fopen(filename, "a");
+    if(!file){
+        return ERROR;
     }
-    if(magic >= EVENT_ONE){
-        return MOVE_OBJ;
+
+    for(i = 0; i < t->count; i++){
+        for(j = 0; j < N_EVENT_NAMES && event_names[j].event != t->event[i]; j++);
+        if(j == N_EVENT_NAMES){
+            continue;
+        }
+        fprintf(file, "#r:%s|%d|", event_names[j].name, t->weight[i]);
+        if(t->cond[i] == COND_NONE){
+            fprintf(file, "%s", cond_names[0].name);
+        }
+        for(k = 1, first = 1; k < N_COND_NAMES; k++){
+            if(t->cond[i] & cond_names[k].cond){
+                fprintf(file, "%s%s", first ? "" : ",", cond_names[k].name);
+                first = 0;
+            }
+        }
+        fprintf(file, "|\n");
+    }
+
+    fclose(file);
+
+    return OK;
+}
+
+/*Gets an event by its name in the map file*/
+R_Event game_rules_event_get_byName(char *name){
+    int i;
+
+    /*Error control*/
+    if(!name){
+        return NOTHING;
+    }
+
+    for(i = 0; i < N_EVENT_NAMES; i++){
+        if(strcasecmp(name, event_names[i].name) == 0){
+            return event_names[i].event;
+        }
     }
 
     return NOTHING;
 }
 
-/*Returns TRUE in porcentage of num*/
-int random(){
+/*Gets a condition by its name in the map file*/
+int game_rules_cond_get_byName(char *name){
+    int i;
+
+    /*Error control*/
+    if(!name){
+        return -1;
+    }
 
-    int rand_num;
+    for(i = 0; i < N_COND_NAMES; i++){
+        if(strcasecmp(name, cond_names[i].name) == 0){
+            return cond_names[i].cond;
+        }
+    }
 
-    rand_num = rand() % 100;
+    return -1;
+}
 
-    return rand_num;
+/**
+ * @brief Builds the alias table of an event table
+ * @author Ignacio Nunez
+ *
+ * Vose's method in whole numbers: each slot holds count * chance, and an
+ * entry holds count times its chance. Entries that do not fill their own
+ * slot take the rest of it from one that has too much.
+ *
+ * @param t a pointer to the table
+ */
+void game_rules_table_build(Event_table *t){
+    int left[EVENT_TABLE_SIZE], small[EVENT_TABLE_SIZE], large[EVENT_TABLE_SIZE];
+    int n_small = 0, n_large = 0, i, s, l;
+
+    for(i = 0; i < t->count; i++){
+        left[i] = t->weight[i] * t->count;
+        t->alias[i] = i;
+        if(left[i] < t->chance){
+            small[n_small++] = i;
+        }
+        else{
+            large[n_large++] = i;
+        }
+    }
+
+    while(n_small > 0 && n_large > 0){
+        s = small[--n_small];
+        l = large[--n_large];
+        t->prob[s] = left[s];
+        t->alias[s] = l;
+        left[l] -= t->chance - left[s];
+        if(left[l] < t->chance){
+            small[n_small++] = l;
+        }
+        else{
+            large[n_large++] = l;
+        }
+    }
+
+    /*What is left fills its own slot*/
+    while(n_large > 0){
+        t->prob[large[--n_large]] = t->chance;
+    }
+    while(n_small > 0){
+        t->prob[small[--n_small]] = t->chance;
+    }
 }
@@ -8,9 +8,14 @@
  * @copyright GNU Public License
  */
 
+#define _XOPEN_SOURCE 600
+
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "../include/graphic_engine.h"
 #include "../include/libscreen.h"
 #include "../include/command.h"
@@ -21,10 +26,16 @@
 #include "../include/object.h"
 #include "../include/inventory.h"
 #include "../include/set.h"
+#include "../include/view_model.h"
+#include "../include/tile.h"
+#include "../include/minimap.h"
+#include "../include/render_queue.h"
+#include "../include/layout.h"
+#include "../include/render_stats.h"
 
-#define ROWS 44       /*!< Establish screen size in y dimension */
-#define COLUMNS 120   /*!< Establish screen size in x dimension */
 #define TAMCELL_X 19  /*!< Establish cell size per line */
+#define MAP_ROWS 24   /*!< Rows of the map area that are painted */
+#define MAP_COLS 80   /*!< Width of the map area */
 
 /**
  * @brief Graphic engine
@@ -40,30 +51,86 @@ struct _Graphic_engine
   Area *feedback;   /*!< graphic engine area of feedback */
   Area *dialogue; /*!< graphic engine area of dialoge */
   Area *events; /*!< graphic engine area of events */
+  View view;      /*!< view of the last turn, built by the game loop */
+  BOOL built;     /*!< FALSE until the first view is built */
+  unsigned long epoch;                    /*!< epoch of the game when the view was fully built */
+  Render_queue *queue;                    /*!< views waiting for the render thread */
+  pthread_t thread;                       /*!< render thread, the only one that paints */
+  View shown;     /*!< view of the last paint */
+  BOOL painted;   /*!< FALSE until the first paint */
+  Tile_cache *tiles;                      /*!< boxes of the spaces already rendered */
+  Minimap *minimap;                       /*!< layouts of the floors already worked out */
+  BOOL show_minimap;                      /*!< TRUE if the map area shows the whole floor */
+  char frame[MAP_ROWS][MAP_COLS + 1];     /*!< map area, composed from the tiles */
+  Layout layout;                          /*!< where the areas are, for the size of the terminal */
+  Render_stats *stats;                    /*!< where the times of each frame go, NULL if they are not measured */
 };
 
+static volatile sig_atomic_t graphic_engine_resized = 0; /*!< 1 if the terminal has changed its size since the last paint */
+
+/*Private functions*/
+void graphic_engine_on_resize(int sig);
+void graphic_engine_open_screen(Graphic_engine *ge);
+void graphic_engine_close_areas(Graphic_engine *ge);
+void graphic_engine_paint_frame(Area *area, const Layout_rect *rect, const char **rows, int n_rows, int n_cols);
+void *graphic_engine_run(void *arg);
+void graphic_engine_paint_view(Graphic_engine *ge, const View *view);
+BOOL graphic_engine_has_info(const View *view);
+void graphic_engine_paint_help(Graphic_engine *ge);
+void graphic_engine_paint_map(Graphic_engine *ge, const View *view);
+void graphic_engine_paint_minimap(Graphic_engine *ge, const View *view);
+void graphic_engine_blit_tile(Graphic_engine *ge, const View *view, View_slot slot, int row, int col);
+void graphic_engine_paint_descript(Graphic_engine *ge, const View *view);
+void graphic_engine_paint_over(Graphic_engine *ge);
+void graphic_engine_paint_feedback(Graphic_engine *ge, const View *view);
+void graphic_engine_paint_dialogue(Graphic_engine *ge, const View *view);
+void graphic_engine_paint_log(Area *area, const Layout_rect *rect, char *title, const char lines[][VIEW_LOG_LEN + 1], int n);
+
 /**
  * graphic_engine_create initializes game's members
  */
 Graphic_engine *graphic_engine_create()
 {
-  static Graphic_engine *ge = NULL;
-
-  if (ge)
-    return ge;
+  Graphic_engine *ge = NULL;
+  struct sigaction sa;
 
-  screen_init(ROWS, COLUMNS);
   ge = (Graphic_engine *)malloc(sizeof(Graphic_engine));
   if (ge == NULL)
     return NULL;
 
-  ge->map = screen_area_init(1, 1, 80, 25);
-  ge->descript = screen_area_init(82, 1, 35, 34);
-  ge->banner = screen_area_init(30, 27, 19, 1);
-  ge->help = screen_area_init(1, 28, 80, 3);
-  ge->feedback = screen_area_init(1, 32, 80, 3);
-  ge->dialogue = screen_area_init(1, 36, 80, 7);
-  ge->events = screen_area_init(82, 36, 35, 7);
+  ge->map = NULL;
+  ge->descript = NULL;
+  ge->banner = NULL;
+  ge->help = NULL;
+  ge->feedback = NULL;
+  ge->dialogue = NULL;
+  ge->events = NULL;
+  graphic_engine_open_screen(ge);
+
+  /* The layout is worked out again before the next paint */
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = graphic_engine_on_resize;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_flags = SA_RESTART;
+  sigaction(SIGWINCH, &sa, NULL);
+
+  ge->tiles = tile_cache_create();
+  ge->minimap = minimap_create();
+  ge->show_minimap = FALSE;
+  ge->built = FALSE;
+  ge->painted = FALSE;
+  ge->epoch = 0;
+  ge->stats = NULL;
+
+  /* From now on only the render thread touches the screen */
+  ge->queue = render_queue_create(RENDER_QUEUE_SIZE);
+  if (!ge->queue || pthread_create(&ge->thread, NULL, graphic_engine_run, ge) != 0)
+  {
+    render_queue_destroy(ge->queue);
+    ge->queue = NULL;
+    graphic_engine_destroy(ge);
+    return NULL;
+  }
 
   return ge;
 }
@@ -78,844 +145,592 @@ void graphic_engine_destroy(Graphic_engine *ge)
   if (!ge)
     return;
 
-  screen_area_destroy(ge->map);
-  screen_area_destroy(ge->descript);
-  screen_area_destroy(ge->banner);
-  screen_area_destroy(ge->help);
-  screen_area_destroy(ge->feedback);
-  screen_area_destroy(ge->dialogue);
-  screen_area_destroy(ge->events);
+  /* The views still in the queue are painted before the thread ends */
+  if (ge->queue)
+  {
+    render_queue_close(ge->queue);
+    pthread_join(ge->thread, NULL);
+    render_queue_destroy(ge->queue);
+  }
+
+  graphic_engine_close_areas(ge);
+  tile_cache_destroy(ge->tiles);
+  minimap_destroy(ge->minimap);
 
   screen_destroy();
   free(ge);
 }
 
 /**
-  * Prints the game on the screen, with all its components on the 
-  * right position for the user to see the info needed to interact with it
+  * Builds the view of the game and hands it to the render thread, which
+  * prints it on the screen while the game goes on
   */
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st)
 {
-  /* Variables declaration */
-  Id id_act = NO_ID, id_up = NO_ID, id_down = NO_ID, id_left= NO_ID, id_right= NO_ID, aux_obj_id = NO_ID;
-  Id player_loc = NO_ID, en_loc[MAX_ENEMYS] = {NO_ID};
-  Inventory *player_inventory = NULL;
-  int en_health[MAX_ENEMYS] = {0}, player_health = 0;
-  Space *space_act = NULL;
-  char obj = '\0', obj_l = '\0', obj_r = '\0';
-  char str[255];
-  T_Command last_cmd = UNKNOWN;
-  extern char *cmd_to_str[N_CMD][N_CMDT];
-  int i;
-  char **gdesc = NULL, **gdesc_right = NULL, **gdesc_left = NULL, aux_gdesc[10][10];
-  char **enemy_gdesc = NULL;
-  char *description;
-  char *en_name[MAX_ENEMYS];
-  char *inspection, *dialogue, *events;
-  char link_up = '\0', link_down = '\0', link_right = '\0', link_left = '\0';
-  char *space_name, *space_name2, *space_name3, aux_name1[20] = "", aux_name2[20] = "", blank20[] = "                   ";
-  Set *object_set = NULL, *object_set_r = NULL, *object_set_l = NULL;
-  Enemy *enemy = NULL;
-
-  /* setting all proper values for each variable */
-  player_loc = game_get_player_location(game, 21);
-  id_act = player_loc;
-  player_inventory = player_get_inventory(game_get_player(game, game_get_player_id(game)));
-  player_health = player_get_health(game_get_player(game, game_get_player_id(game)));
-  description = (char*) space_get_brief_description(game_get_space(game, player_loc));
-  inspection = game_get_inspection(game);
-
-  for(i=0;i<MAX_ENEMYS;i++)
-  { 
-    /* Error Control */
-    if (game_get_enemy(game, game_get_enemy_id(game, i))==NULL)
+  long start;
+
+  /* Error control */
+  if (!ge || !game)
+  {
+    return;
+  }
+
+  start = render_stats_start(ge->stats);
+
+  /* Only the command, dialogue and event change while the epoch does not */
+  if (ge->built == FALSE || game_get_epoch(game) != ge->epoch || game_get_last_command(game) == LOAD)
+  {
+    if (view_model_build(&ge->view, game, st) == ERROR)
     {
-      break;
+      return;
     }
-    en_health[i] = enemy_get_health(game_get_enemy(game, game_get_enemy_id(game, i)));
-    en_name[i] = (char *)enemy_get_name(game_get_enemy(game, game_get_enemy_id(game, i)));
-    en_loc[i] = game_get_enemy_location(game, game_get_enemy_id(game, i));
+    ge->epoch = game_get_epoch(game);
+    ge->built = TRUE;
   }
+  else if (view_model_build_turn(&ge->view, game, st) == ERROR)
+  {
+    return;
+  }
+  render_stats_stop(ge->stats, RS_BUILD, start);
 
-  /* Paint the in the map area */
-  screen_area_clear(ge->map);
-  
-  if (id_act != NO_ID)
+  render_queue_push(ge->queue, &ge->view);
+}
+
+/**
+  * graphic_engine_set_stats sets where the times of each frame are kept
+  */
+void graphic_engine_set_stats(Graphic_engine *ge, Render_stats *stats)
+{
+  if (!ge)
+    return;
+
+  ge->stats = stats;
+}
+
+/**
+  * graphic_engine_wait waits until every view has been painted
+  */
+void graphic_engine_wait(Graphic_engine *ge)
+{
+  if (!ge)
+    return;
+
+  render_queue_wait(ge->queue);
+}
+
+/**
+  * graphic_engine_run is the render thread, it paints the views of the queue
+  * until it is closed
+  */
+void *graphic_engine_run(void *arg)
+{
+  Graphic_engine *ge = (Graphic_engine *)arg;
+  const View *view = NULL;
+
+  while ((view = render_queue_front(ge->queue)) != NULL)
   {
-    space_act = game_get_space(game, id_act);
-    id_up = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, N)));
-    id_down = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, S)));
-    id_left = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, W)));
-    id_right = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, E)));
+    graphic_engine_paint_view(ge, view);
+    render_queue_pop(ge->queue);
+  }
 
-    object_set = space_get_objects(game_get_space(game, id_act));
-    object_set_r = space_get_objects(game_get_space(game, id_right));
-    object_set_l = space_get_objects(game_get_space(game, id_left));
+  return NULL;
+}
 
-    /* Space to the north of the current space */
-    if (id_up != NO_ID)
-    {
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
-      {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-        
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          i = set_get_nids(object_set) + 1;
-        }
-      }
+/**
+  * graphic_engine_paint_view prints a view on the screen, with all its components on the
+  * right position for the user to see the info needed to interact with it
+  */
+void graphic_engine_paint_view(Graphic_engine *ge, const View *view)
+{
+  BOOL over, full;
+  long start, t;
 
-      space_name = (char *)space_get_name(game_get_space(game, id_up));
-      strncat(space_name, blank20, 15 - strlen(space_name));
-      sprintf(str, "  %.19s   | %s |", blank20, space_name);
-      screen_area_puts(ge->map, str);
-
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   +-----------------+", blank20);
-      screen_area_puts(ge->map, str);
-      
-      if (game_get_connection_status(game, id_act, N) == OPEN_L)
-      {
-        link_up = '^';
-      }
-      else
-      {
-        link_up = ' ';
-      }
+  start = render_stats_start(ge->stats);
 
-      if (game_get_connection_status(game, id_act, E) == OPEN_L)
-      {
-        link_right = '>';
-      }
-      else
-      {
-        link_right = ' ';
-      }
+  /* A new screen is empty, everything is painted again */
+  if (graphic_engine_resized)
+  {
+    graphic_engine_resized = 0;
+    graphic_engine_open_screen(ge);
+    ge->painted = FALSE;
+  }
 
-      if (game_get_connection_status(game, id_act, W) == OPEN_L)
-      {
-        link_left = '<';
-      }
-      else
-      {
-        link_left = ' ';
-      }
+  /* The spaces of a loaded game may not be the ones in the tiles */
+  if (view->last_cmd == LOAD)
+  {
+    tile_cache_clear(ge->tiles);
+    minimap_clear(ge->minimap);
+  }
 
-      sprintf(str, "  %.19s            %c", blank20, link_up);
-      screen_area_puts(ge->map, str);
-    }
+  if (view->last_cmd == MAP)
+  {
+    ge->show_minimap = ge->show_minimap == TRUE ? FALSE : TRUE;
+  }
 
-    /* Current space */
-    if (id_act != NO_ID)
+  over = (graphic_engine_has_info(view) == TRUE && view->game_over == TRUE) ? TRUE : FALSE;
+  full = (ge->painted == FALSE || view->last_cmd == LOAD ||
+          over != ((graphic_engine_has_info(&ge->shown) == TRUE && ge->shown.game_over == TRUE) ? TRUE : FALSE)) ? TRUE : FALSE;
+
+  if (over == TRUE)
+  {
+    if (full == TRUE)
     {
-      if (id_up == NO_ID)
+      t = render_stats_start(ge->stats);
+      graphic_engine_paint_over(ge);
+      render_stats_stop(ge->stats, RS_MAP, t);
+    }
+  }
+  else
+  {
+    if (full == TRUE || view->last_cmd == MAP ||
+        view_model_changed(&ge->shown, view, VA_MAP) == TRUE)
+    {
+      t = render_stats_start(ge->stats);
+      if (ge->show_minimap == TRUE)
       {
-        for (i = 0; i < 6; i++)
-        {
-          sprintf(str, " ");
-          screen_area_puts(ge->map, str);
-        }
+        graphic_engine_paint_minimap(ge, view);
       }
-      
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
+      else
       {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          i = set_get_nids(object_set) + 1;
-        }
+        graphic_engine_paint_map(ge, view);
       }
-      
+      render_stats_stop(ge->stats, RS_MAP, t);
+    }
+    if (full == TRUE || view_model_changed(&ge->shown, view, VA_DESCRIPT) == TRUE)
+    {
+      t = render_stats_start(ge->stats);
+      graphic_engine_paint_descript(ge, view);
+      render_stats_stop(ge->stats, RS_DESCRIPT, t);
+    }
+  }
 
-       /* Checks that there are no other spaces to the left or right */    
-      if(id_left==NO_ID && id_right==NO_ID)  
-      {
-        sprintf(str, "  %.19s   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        sprintf(str, "  %.19s   | %s |", blank20, space_name);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |           gpp0^ | ", blank20);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act));
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  %.19s   | %s %s|", blank20, enemy_gdesc[i], gdesc[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str, "  %.19s   |        %s|", blank20, gdesc[i]);
-          }
-          else
-          {
-            sprintf(str, "  %.19s   |    %s    |", blank20, gdesc[i]);
-          }
-          
-          screen_area_puts(ge->map, str);
-        }
-        
-        sprintf(str, "  %.19s   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-      } 
-      
-      /* Checks that there is no space to the left but there is one to the right */    
-      if (id_right != NO_ID && id_left == NO_ID)
-      {  
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-
-        obj_r = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_right))) ==  FALSE) 
-          {
-            obj_r = ' ';
-          } else {
-            obj_r = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-
-        sprintf(str, "  %.19s   +-----------------+   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strcpy(aux_name1, space_name);
-        strncat(aux_name1, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_right));
-        strcpy(aux_name2, space_name2);
-        strncat(aux_name2, blank20, 15 - strlen(space_name2));
-        if (id_right == 16 && game_get_time(game) == DAY)
-        {
-          strcpy(aux_name2, "¬¬¬¬¬¬¬ ");
-        }
-        sprintf(str, "  %.19s   | %s |   | %s |", blank20, space_name, aux_name2);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |           gpp0^ |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_right));
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          strcpy(aux_gdesc[i], gdesc_right[i]);
-          if (id_right == 16 && game_get_time(game) == DAY)
-          {
-            strcpy(aux_gdesc[i], "¬¬¬¬ ");
-          }
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  %.19s   | %s %s|   |    %s    |", blank20, enemy_gdesc[i], gdesc[i], aux_gdesc[i]);
-          }
-          else if (enemy && i != 3)
-          {
-            sprintf(str, "  %.19s   |        %s|   |    %s    |", blank20, gdesc[i], aux_gdesc[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str, "  %.19s   |        %s| %c |    %s    |", blank20, gdesc[i], link_right, aux_gdesc[i]);
-          }
-          else if (i != 3) {
-            sprintf(str, "  %.19s   |    %s    |   |    %s    |", blank20, gdesc[i], aux_gdesc[i]);
-          } else {
-            sprintf(str, "  %.19s   |    %s    | %c |    %s    |", blank20, gdesc[i], link_right, aux_gdesc[i]);
-          }
-          screen_area_puts(ge->map, str);
-        }
-        
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   |        %c        |   |        %c        |", blank20, obj, obj_r);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   +-----------------+   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);  
-      }
-      
+  if (ge->painted == FALSE)
+  {
+    t = render_stats_start(ge->stats);
+    graphic_engine_paint_help(ge);
+    render_stats_stop(ge->stats, RS_HELP, t);
+  }
 
+  /* The feedback area keeps the last commands, so it is written every turn */
+  t = render_stats_start(ge->stats);
+  graphic_engine_paint_feedback(ge, view);
+  render_stats_stop(ge->stats, RS_FEEDBACK, t);
+  if (full == TRUE || view_model_changed(&ge->shown, view, VA_DIALOGUE) == TRUE)
+  {
+    t = render_stats_start(ge->stats);
+    graphic_engine_paint_dialogue(ge, view);
+    render_stats_stop(ge->stats, RS_DIALOGUE, t);
+  }
 
-      if (id_left != NO_ID && id_right == NO_ID)
-      {
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-        obj_l = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_left))) ==  FALSE) 
-          {
-            obj_l = ' ';
-          } else {
-            obj_l = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-
-        sprintf(str, "  +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_left));
-        strncat(space_name2, blank20, 15 - strlen(space_name2));
-        /*
-        if (id_right == 16 && game_get_time(game) == DAY)
-        {
-          strcpy(space_name2, "¬¬¬¬¬¬¬ ");
-        }
-        */
-        sprintf(str, "  | %s |   | %s |", space_name2, space_name);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |           gpp0^ |");
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_left));
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (id_right == 16 && game_get_time(game) == DAY)
-          {
-            strcpy(gdesc_right[i], "¬¬¬¬ ");
-          } 
-          if (i != 3) {
-            sprintf(str, "  |    %s    |   |    %s    |", gdesc_right[i], gdesc[i]);
-            screen_area_puts(ge->map, str);
-          } else {
-            sprintf(str, "  |    %s    | %c |    %s    |", gdesc_right[i], link_right, gdesc[i]);
-            screen_area_puts(ge->map, str);
-          }
-        }
-        
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  |        %c        |   |        %c        |", obj_l, obj);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);  
-      }
+  memcpy(&ge->shown, view, sizeof(View));
+  ge->painted = TRUE;
 
-      /* Checks that there are both spaces to the left and right */    
-      if (id_left != NO_ID && id_right != NO_ID)
-      {
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-        obj_r = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_right))) ==  FALSE) 
-          {
-            obj_r = ' ';
-          } else {
-            obj_r = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        obj_l = ' ';
-        for(i = 0; i < set_get_nids(object_set_l); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_l, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_left))) ==  FALSE) 
-          {
-            obj_l = ' ';
-          } else {
-            obj_l = '*';              
-            i = set_get_nids(object_set_l) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-        
-        sprintf(str, "  +-----------------+   +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_left));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name2, blank20, 15 - strlen(space_name2));
-        space_name3 = (char *)space_get_name(game_get_space(game, id_right));
-        strncat(space_name3, blank20, 15 - strlen(space_name3));
-        sprintf(str, "  | %s |   | %s |   | %s |", space_name, space_name2, space_name3);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |           gpp0^ |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_right)); 
-        gdesc_left = space_get_gdesc(game_get_space(game, id_left)); 
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  |    %s    |   | %s %s|   |    %s    |", gdesc_left[i], enemy_gdesc[i], gdesc[i], gdesc_right[i]);
-          }
-          else if (enemy && i != 3)
-          {
-            sprintf(str, "  |    %s    |   |        %s|   |    %s    |", gdesc_left[i], gdesc[i], gdesc_right[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str,  "  |    %s    | %c |        %s| %c |    %s    |", gdesc_left[i], link_left, gdesc[i], link_right, gdesc_right[i]);
-          }
-          else if (i != 3) {
-            sprintf(str, "  |    %s    |   |    %s    |   |    %s    |", gdesc_left[i], gdesc[i], gdesc_right[i]);
-          } else {
-            sprintf(str, "  |    %s    | %c |    %s    | %c |    %s    |", gdesc_left[i], link_left, gdesc[i], link_right, gdesc_right[i]);
-          }
-          screen_area_puts(ge->map, str);
-        }
-
-        
-        sprintf(str, "  |                 |   |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |         %c       |   |         %c       |   |         %c       |", obj_l, obj, obj_r);
-        screen_area_puts(ge->map, str);  
-        sprintf(str, "  +-----------------+   +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
-      }
-    }
+  /* Dump to the terminal, the game loop may be waiting for input already */
+  t = render_stats_start(ge->stats);
+  screen_paint();
+  render_stats_stop(ge->stats, RS_SCREEN, t);
+  render_stats_add(ge->stats, RS_BYTES, screen_get_bytes());
+  printf("prompt:> ");
+  fflush(stdout);
+  render_stats_stop(ge->stats, RS_PAINT, start);
+}
 
-    /* Space to the south of the current space */
-    if (id_down != NO_ID)
-    {
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
-      {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          break;
-        }
-      }
+/**
+  * graphic_engine_on_resize is the handler of SIGWINCH, it only takes note
+  */
+void graphic_engine_on_resize(int sig)
+{
+  graphic_engine_resized = 1;
+}
 
-      if (game_get_connection_status(game, id_act, S) == OPEN_L)
-      {
-        link_down = 'v';
-      }
-      else
-      {
-        link_down = ' ';
-      }
+/**
+  * graphic_engine_open_screen creates the screen and its areas for the size of the terminal,
+  * the usual one if the output is not a terminal
+  */
+void graphic_engine_open_screen(Graphic_engine *ge)
+{
+  Layout_rect *r = ge->layout.area;
+  int rows, columns;
 
-      sprintf(str, "  %.19s            %c", blank20, link_down);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   +-----------------+", blank20);
-      screen_area_puts(ge->map, str);
+  if (layout_get_terminal(STDOUT_FILENO, &rows, &columns) == ERROR)
+  {
+    rows = LAYOUT_ROWS + 1;
+    columns = LAYOUT_COLUMNS;
+  }
+  layout_compute(&ge->layout, rows, columns);
+
+  graphic_engine_close_areas(ge);
+  screen_init(ge->layout.rows, ge->layout.columns);
+
+  /* Areas the layout leaves out stay NULL, and painting them does nothing */
+  if (r[L_MAP].width > 0)
+    ge->map = screen_area_init(r[L_MAP].x, r[L_MAP].y, r[L_MAP].width, r[L_MAP].height);
+  if (r[L_DESCRIPT].width > 0)
+    ge->descript = screen_area_init(r[L_DESCRIPT].x, r[L_DESCRIPT].y, r[L_DESCRIPT].width, r[L_DESCRIPT].height);
+  if (r[L_BANNER].width > 0)
+    ge->banner = screen_area_init(r[L_BANNER].x, r[L_BANNER].y, r[L_BANNER].width, r[L_BANNER].height);
+  if (r[L_HELP].width > 0)
+    ge->help = screen_area_init(r[L_HELP].x, r[L_HELP].y, r[L_HELP].width, r[L_HELP].height);
+  if (r[L_FEEDBACK].width > 0)
+    ge->feedback = screen_area_init(r[L_FEEDBACK].x, r[L_FEEDBACK].y, r[L_FEEDBACK].width, r[L_FEEDBACK].height);
+  if (r[L_DIALOGUE].width > 0)
+    ge->dialogue = screen_area_init(r[L_DIALOGUE].x, r[L_DIALOGUE].y, r[L_DIALOGUE].width, r[L_DIALOGUE].height);
+  if (r[L_EVENTS].width > 0)
+    ge->events = screen_area_init(r[L_EVENTS].x, r[L_EVENTS].y, r[L_EVENTS].width, r[L_EVENTS].height);
+}
 
-      space_name = (char *)space_get_name(game_get_space(game, id_down));
-      strncat(space_name, blank20, 15 - strlen(space_name));
-      sprintf(str, "  %.19s   | %s |", blank20, space_name);
-      screen_area_puts(ge->map, str);
+/**
+  * graphic_engine_close_areas destroys the areas of the screen
+  */
+void graphic_engine_close_areas(Graphic_engine *ge)
+{
+  screen_area_destroy(ge->map);
+  screen_area_destroy(ge->descript);
+  screen_area_destroy(ge->banner);
+  screen_area_destroy(ge->help);
+  screen_area_destroy(ge->feedback);
+  screen_area_destroy(ge->dialogue);
+  screen_area_destroy(ge->events);
+  ge->map = NULL;
+  ge->descript = NULL;
+  ge->banner = NULL;
+  ge->help = NULL;
+  ge->feedback = NULL;
+  ge->dialogue = NULL;
+  ge->events = NULL;
+}
 
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
+/**
+  * graphic_engine_paint_frame writes the rows of a frame in an area, keeping
+  * its centre if the area is smaller than the frame
+  */
+void graphic_engine_paint_frame(Area *area, const Layout_rect *rect, const char **rows, int n_rows, int n_cols)
+{
+  char str[MAP_COLS + 1];
+  int i, first, shown, left, width;
+
+  shown = n_rows < rect->height ? n_rows : rect->height;
+  first = (n_rows - shown) / 2;
+  width = n_cols < rect->width ? n_cols : rect->width;
+  left = (n_cols - width) / 2;
+  if (width > MAP_COLS)
+  {
+    width = MAP_COLS;
+  }
 
-      sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-      screen_area_puts(ge->map, str);
+  for (i = first; i < first + shown; i++)
+  {
+    memcpy(str, rows[i] + left, width);
+    str[width] = '\0';
+    screen_area_puts(area, str);
+  }
+}
 
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-    }
+/**
+  * graphic_engine_has_info checks if the description area has something to show
+  */
+BOOL graphic_engine_has_info(const View *view)
+{
+  if (view->player_location == NO_ID || view->n_enemies == 0 || view->enemies[0].location == NO_ID)
+  {
+    return FALSE;
   }
-  
-  /* Paint in the description area */
-  screen_area_clear(ge->descript);
-  
-  if ((player_loc != NO_ID) && (en_loc[0] != NO_ID))
+
+  return TRUE;
+}
+
+/**
+  * graphic_engine_paint_help paints the banner and the list of commands, which never change
+  */
+void graphic_engine_paint_help(Graphic_engine *ge)
+{
+  char str[255];
+
+  /* Paint in the banner area */
+  screen_area_puts(ge->banner, " Day-Night Dungeon ");
+
+  /* Paint in the help area */
+  screen_area_clear(ge->help);
+  sprintf(str, "                         The commands you can use are:");
+  screen_area_puts(ge->help, str);
+  sprintf(str, " m(MOVE), t(TAKE), d(DROP), a(ATTACK), i(INSPECT), e(EXIT), s(SAVE), l(LOAD)");
+  screen_area_puts(ge->help, str);
+  sprintf(str, "          o (OPEN), ton (TURNON), toff (TURNOFF), u(USE), mp(MAP)");
+  screen_area_puts(ge->help, str);
+}
+
+/**
+  * graphic_engine_paint_map paints the current space and its neighbours
+  * by copying their tiles into the map frame
+  */
+void graphic_engine_paint_map(Graphic_engine *ge, const View *view)
+{
+  const char *rows[MAP_ROWS];
+  int i;
+
+  screen_area_clear(ge->map);
+
+  if (view->space[V_ACT].id == NO_ID)
   {
-    sprintf(str, "  Objects in space:");
-    screen_area_puts(ge->descript, str);
-    
-    for(i=0;i< set_get_nids(space_get_objects(game_get_space(game, id_act)));i++)
-    { 
-      if (game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i)) == NULL)
-      {
-        break;                     
-      }
+    return;
+  }
 
-      if (obj_is_visible(game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i)), space_get_light_status(game_get_space(game, id_act)))== TRUE) {
-        sprintf(str, "  %s ", obj_get_name(game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i))));
-        screen_area_puts(ge->descript, str);
-      }
-    }
+  for (i = 0; i < MAP_ROWS; i++)
+  {
+    memset(ge->frame[i], ' ', MAP_COLS);
+    ge->frame[i][MAP_COLS] = '\0';
+  }
 
-    sprintf(str, "   ") ;
-    screen_area_puts(ge->descript, str);
+  graphic_engine_blit_tile(ge, view, V_NORTH, 0, 24);
+  graphic_engine_blit_tile(ge, view, V_WEST, 6, 2);
+  graphic_engine_blit_tile(ge, view, V_ACT, 6, 24);
+  graphic_engine_blit_tile(ge, view, V_EAST, 6, 46);
+  graphic_engine_blit_tile(ge, view, V_SOUTH, 19, 24);
 
-    sprintf(str, "  PLAYER (gpp0^):");
-    screen_area_puts(ge->descript, str);
-    gdesc = player_get_gdesc(game_get_player(game, 21));
-    sprintf(str, "  +--------+");
-    screen_area_puts(ge->descript, str);
-    for (i = 0; i < PLAYER_GDESC_Y; i++)
-    {
-      sprintf(str, "  |  %s  |", gdesc[i]);
-      screen_area_puts(ge->descript, str);
-    }
-    sprintf(str, "  +--------+");
-    screen_area_puts(ge->descript, str);
+  /* Open links are drawn between the boxes, in the fourth row of the gdesc */
+  if (view->space[V_NORTH].id != NO_ID && view->open[N] == TRUE)
+  {
+    ge->frame[5][33] = '^';
+  }
+  if (view->space[V_WEST].id != NO_ID && view->open[W] == TRUE)
+  {
+    ge->frame[13][22] = '<';
+  }
+  if (view->space[V_EAST].id != NO_ID && view->open[E] == TRUE)
+  {
+    ge->frame[13][44] = '>';
+  }
+  if (view->space[V_SOUTH].id != NO_ID && view->open[S] == TRUE)
+  {
+    ge->frame[18][33] = 'v';
+  }
 
-    sprintf(str, "  Player location:%d", (int)player_loc);
-    screen_area_puts(ge->descript, str);
-  
-    if(player_inventory==NULL || set_get_nids(inventory_get_objects(player_inventory)) == 0)
-    {
-      sprintf(str, "  Player object: No object" );
-      screen_area_puts(ge->descript, str);
-    }
-    else
-    {
-      sprintf(str, "  Player objects:"); 
-      screen_area_puts(ge->descript, str);
+  for (i = 0; i < MAP_ROWS; i++)
+  {
+    rows[i] = ge->frame[i];
+  }
+  graphic_engine_paint_frame(ge->map, &ge->layout.area[L_MAP], rows, MAP_ROWS, MAP_COLS);
+}
 
-    
-      for (i = 0; i < set_get_nids(inventory_get_objects(player_inventory)); i++)
-      {
-        sprintf(str, "    %s", obj_get_name(game_get_object(game, set_get_ids_by_number(inventory_get_objects(player_inventory),i)))); 
-        screen_area_puts(ge->descript, str);
-      }
-    }
-    
-    sprintf(str, "  Player health:%d", (int)player_health);
-    screen_area_puts(ge->descript, str);
+/**
+  * graphic_engine_paint_minimap paints every space of the floor of the player
+  */
+void graphic_engine_paint_minimap(Graphic_engine *ge, const View *view)
+{
+  const char *rows[MINIMAP_ROWS];
+  int i;
 
-    
-    sprintf(str, "   ") ;
-    screen_area_puts(ge->descript, str);
+  screen_area_clear(ge->map);
 
-    sprintf(str, "  Enemies in space:") ;
-    screen_area_puts(ge->descript, str);
-    for (i = 0; i < MAX_ENEMYS; i++) {
-      if (en_loc[i] == id_act) {
-        sprintf(str, "    Enemy name:%s", en_name[i]);
-        screen_area_puts(ge->descript, str);
-        sprintf(str, "    Enemy health:%d", (int)en_health[i]);
-        screen_area_puts(ge->descript, str);
-        sprintf(str, "   ") ;
-        screen_area_puts(ge->descript, str);
-      }
+  if (view->space[V_ACT].id == NO_ID || minimap_render(ge->minimap, view) == ERROR)
+  {
+    return;
+  }
+
+  for (i = 0; i < MINIMAP_ROWS; i++)
+  {
+    rows[i] = minimap_get_row(ge->minimap, i);
+  }
+  graphic_engine_paint_frame(ge->map, &ge->layout.area[L_MAP], rows, MINIMAP_ROWS, MINIMAP_COLS);
+}
+
+/**
+  * graphic_engine_blit_tile copies the tile of a space into the map frame
+  */
+void graphic_engine_blit_tile(Graphic_engine *ge, const View *view, View_slot slot, int row, int col)
+{
+  const Tile *tile = NULL;
+  const char *text = NULL;
+  int i, len;
+
+  tile = tile_cache_get(ge->tiles, view, slot);
+  for (i = 0; i < tile_get_rows(tile) && row + i < MAP_ROWS; i++)
+  {
+    text = tile_get_row(tile, i);
+    len = strlen(text);
+    if (len > MAP_COLS - col)
+    {
+      len = MAP_COLS - col;
     }
+    memcpy(ge->frame[row + i] + col, text, len);
+  }
+}
 
-    sprintf(str, "   ");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  Info:");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  %s", description);
-    screen_area_puts(ge->descript, str);
+/**
+  * graphic_engine_paint_descript paints the objects, player, enemies and texts of the current space
+  */
+void graphic_engine_paint_descript(Graphic_engine *ge, const View *view)
+{
+  const char *dir_name[VIEW_MAX_LINKS] = {"NORTH", " SOUTH ", "EAST", "WEST", "UP", "DOWN"};
+  char str[255];
+  int i;
 
-    sprintf(str, "   ");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  Descriptions:");
+  screen_area_clear(ge->descript);
+
+  if (graphic_engine_has_info(view) == FALSE)
+  {
+    return;
+  }
+
+  screen_area_puts(ge->descript, "  Objects in space:");
+  for (i = 0; i < view->n_objects; i++)
+  {
+    sprintf(str, "  %s ", view->objects[i]);
     screen_area_puts(ge->descript, str);
-    if(inspection){
-      sprintf(str, "  %s", inspection);
-      screen_area_puts(ge->descript, str);
-    }
+  }
+  screen_area_puts(ge->descript, "   ");
 
-    sprintf(str, "   ");
+  screen_area_puts(ge->descript, "  PLAYER (gpp0^):");
+  screen_area_puts(ge->descript, "  +--------+");
+  for (i = 0; i < PLAYER_GDESC_Y; i++)
+  {
+    sprintf(str, "  |  %s  |", view->player_gdesc[i]);
     screen_area_puts(ge->descript, str);
-    for (i = 0; i < 6; i++)
-    {
-      if (link_get_status(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == CLOSE )
-      {
-        if (link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) != NULL)
-        {
-          sprintf(str, "  Closed links(for keys): ");
-          screen_area_puts(ge->descript, str);
+  }
+  screen_area_puts(ge->descript, "  +--------+");
 
-          break;
-        }
-      }
-    }
-    for (i = 0; i < 6; i++)
-    {
-      if (link_get_status(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == CLOSE )
-      {
-        if (link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) != NULL)
-        {
-          if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 0)
-          {
-            sprintf(str, "    %s: NORTH", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          } 
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 1)
-          {
-            sprintf(str, "    %s:  SOUTH ", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 2)
-          {
-            sprintf(str, "    %s: EAST", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 3)
-          {
-            sprintf(str, "    %s: WEST", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 4)
-          {
-            sprintf(str, "    %s: UP", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 5)
-          {
-            sprintf(str, "    %s: DOWN", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-        }
-      }
-    }
-    
-  if (game_get_time(game) == DAY)
+  sprintf(str, "  Player location:%d", (int)view->player_location);
+  screen_area_puts(ge->descript, str);
+  if (view->n_inventory == 0)
   {
-    sprintf(str, "  Time: DAY");
-  } 
+    screen_area_puts(ge->descript, "  Player object: No object");
+  }
   else
   {
-    sprintf(str, "  Time: NIGHT");
+    screen_area_puts(ge->descript, "  Player objects:");
+    for (i = 0; i < view->n_inventory; i++)
+    {
+      sprintf(str, "    %s", view->inventory[i]); 
+      screen_area_puts(ge->descript, str);
+    }
   }
+  sprintf(str, "  Player health:%d", view->player_health);
   screen_area_puts(ge->descript, str);
-    
-  if (player_get_health(game_get_player(game, 21)) <= 0 || enemy_get_health(game_get_enemy(game, 45)) <= 0)
+  screen_area_puts(ge->descript, "   ");
+
+  screen_area_puts(ge->descript, "  Enemies in space:");
+  for (i = 0; i < view->n_enemies; i++)
   {
-    screen_area_clear(ge->descript);
-    screen_area_clear(ge->map);
-    for (i = 0; i < 12; i++)
+    if (view->enemies[i].location == view->space[V_ACT].id)
     {
-      sprintf(str, "             ");
-      screen_area_puts(ge->map, str);
+      sprintf(str, "    Enemy name:%s", view->enemies[i].name);
+      screen_area_puts(ge->descript, str);
+      sprintf(str, "    Enemy health:%d", view->enemies[i].health);
+      screen_area_puts(ge->descript, str);
+      screen_area_puts(ge->descript, "   ");
     }
-    sprintf(str, "                                 GAME IS OVER");
-    screen_area_puts(ge->map, str);
-    sprintf(str, "                           Press e to exit the game");
-    screen_area_puts(ge->map, str);
   }
-    
-    sprintf(str, "  ");
+
+  screen_area_puts(ge->descript, "   ");
+  screen_area_puts(ge->descript, "  Info:");
+  sprintf(str, "  %.250s", view->description);
+  screen_area_puts(ge->descript, str);
+
+  screen_area_puts(ge->descript, "   ");
+  screen_area_puts(ge->descript, "  Descriptions:");
+  if (view->has_inspection == TRUE)
+  {
+    sprintf(str, "  %.250s", view->inspection);
     screen_area_puts(ge->descript, str);
   }
 
-  /* Paint in the banner area */
-  screen_area_puts(ge->banner, " Day-Night Dungeon "); 
+  screen_area_puts(ge->descript, "   ");
+  if (view->n_closed > 0)
+  {
+    screen_area_puts(ge->descript, "  Closed links(for keys): ");
+  }
+  for (i = 0; i < view->n_closed; i++)
+  {
+    if (view->closed[i].direction >= N && view->closed[i].direction <= D)
+    {
+      sprintf(str, "    %s: %s", view->closed[i].name, dir_name[view->closed[i].direction]);
+      screen_area_puts(ge->descript, str);
+    }
+  }
 
-  /* Paint in the help area */
-  screen_area_clear(ge->help);
-  sprintf(str, "                         The commands you can use are:");
-  screen_area_puts(ge->help, str);
-  sprintf(str, " m(MOVE), t(TAKE), d(DROP), a(ATTACK), i(INSPECT), e(EXIT), s(SAVE), l(LOAD)");
-  screen_area_puts(ge->help, str);
-  sprintf(str, "               o (OPEN), ton (TURNON), toff (TURNOFF), u(USE)");
-  screen_area_puts(ge->help, str);
-  /*
-  sprintf(str, " Player object will be -1 as long as it doesn't carry one");
-  screen_area_puts(ge->help, str);
+  screen_area_puts(ge->descript, view->time == DAY ? "  Time: DAY" : "  Time: NIGHT");
+  screen_area_puts(ge->descript, "  ");
+}
+
+/**
+  * graphic_engine_paint_over paints the end of the game
   */
+void graphic_engine_paint_over(Graphic_engine *ge)
+{
+  int i;
 
-  /* Paint in the feedback area */
-  last_cmd = game_get_last_command(game);
-  if (st == 0)
+  screen_area_clear(ge->descript);
+  screen_area_clear(ge->map);
+  for (i = 0; i < 12; i++)
   {
-    sprintf(str, " %s (%s): ERROR", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    screen_area_puts(ge->map, "             ");
   }
-  else if (st == 1)
+  screen_area_puts(ge->map, "                                 GAME IS OVER");
+  screen_area_puts(ge->map, "                           Press e to exit the game");
+  screen_area_puts(ge->descript, "  ");
+}
+
+/**
+  * graphic_engine_paint_feedback paints the last command and its result
+  */
+void graphic_engine_paint_feedback(Graphic_engine *ge, const View *view)
+{
+  char str[255];
+
+  if (view->st == 0)
   {
-    sprintf(str, " %s (%s): OK", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    sprintf(str, " %s (%s): ERROR", command_get_name(view->last_cmd, CMDL), command_get_name(view->last_cmd, CMDS));
+  }
+  else if (view->st == 1)
+  {
+    sprintf(str, " %s (%s): OK", command_get_name(view->last_cmd, CMDL), command_get_name(view->last_cmd, CMDS));
   }
   else
   {
-    sprintf(str, " %s (%s)", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    sprintf(str, " %s (%s)", command_get_name(view->last_cmd, CMDL), command_get_name(view->last_cmd, CMDS));
   }
-  
   screen_area_puts(ge->feedback, str);
-
-/* prints the dialoge area */
-screen_area_clear(ge->dialogue);
-
-screen_area_puts(ge->dialogue, " Dialogue:");
-dialogue = dialogue_get_error(game_get_dialogue(game));
-
-if(dialogue == NULL){}
-else if(strcmp(dialogue, " ") == 0){
-  dialogue = dialogue_get_command(game_get_dialogue(game));
 }
 
-if (dialogue)
+/**
+  * graphic_engine_paint_dialogue paints the dialogue and events areas
+  */
+void graphic_engine_paint_dialogue(Graphic_engine *ge, const View *view)
 {
-  sprintf(str, "  %s", dialogue);
-  screen_area_puts(ge->dialogue, str);
+  graphic_engine_paint_log(ge->dialogue, &ge->layout.area[L_DIALOGUE], " Dialogue:", view->dialogue, view->n_dialogue);
+  graphic_engine_paint_log(ge->events, &ge->layout.area[L_EVENTS], " Events:", view->events, view->n_events);
 }
 
-/* prints the events area */
-screen_area_clear(ge->events);
-
-screen_area_puts(ge->events, " Events:");
-events = dialogue_get_event(game_get_dialogue(game));
-if (events)
+/**
+  * graphic_engine_paint_log paints the newest lines of a scrollback that fit
+  * in an area under its title, the oldest first
+  */
+void graphic_engine_paint_log(Area *area, const Layout_rect *rect, char *title, const char lines[][VIEW_LOG_LEN + 1], int n)
 {
-  sprintf(str, "  %s", events);
-  screen_area_puts(ge->events, str);
-}
+  char str[VIEW_LOG_LEN + 3];
+  int first, rows, used = 0;
 
+  screen_area_clear(area);
+  screen_area_puts(area, title);
+  if (rect->width <= 0)
+  {
+    return;
+  }
 
-  /* Dump to the terminal */
-  screen_paint();
-  printf("prompt:> ");
+  /* A line wider than the area takes more than one row */
+  for (first = n; first > 0; first--)
+  {
+    rows = ((int)strlen(lines[first - 1]) + 2 + rect->width - 1) / rect->width;
+    if (first < n && used + rows > rect->height - 1)
+    {
+      break;
+    }
+    used += rows;
+  }
 
+  for (; first < n; first++)
+  {
+    sprintf(str, "  %s", lines[first]);
+    screen_area_puts(area, str);
+  }
 }
@@ -23,8 +23,12 @@
 struct _Inventory {
   Set* objects;	/*!< Set of objects included in invetory */
   int max_objs; /*!< Defines the maximun objects of the inventory */
+  unsigned long *epoch; /*!< Change counter of the game it belongs to, NULL if none */
 };
 
+/*Private functions*/
+void inventory_touch(Inventory *inventory);
+
 /** inventory_create allocates memory for a new inventory
   *  and initializes its members
   */
@@ -40,6 +44,8 @@ Inventory* inventory_create() {
   newInventory->objects = set_create();
   newInventory->max_objs = 0;
 
+  newInventory->epoch = NULL;
+
   return newInventory;
 }
 
@@ -84,6 +90,7 @@ STATUS inventory_set_objects(Inventory* inventory, Set* set) {
   set_destroy(inventory->objects);
 
 	inventory->objects = set;
+	inventory_touch(inventory);
 	return OK;
 }
 
@@ -97,6 +104,7 @@ STATUS inventory_set_maxObjs(Inventory* inventory, int num)
   }
 
   inventory->max_objs = num;
+  inventory_touch(inventory);
   return OK;
 }
 
@@ -127,6 +135,7 @@ STATUS inventory_add_object(Inventory* inventory, Id object) {
 
 	set_add(inventory->objects, object);
 
+	inventory_touch(inventory);
 	return OK;
 	
 }
@@ -156,6 +165,7 @@ STATUS inventory_remove_object(Inventory* inventory, Id object) {
 	}
 
 	if(set_del_id(inventory->objects, object) == OK){
+		inventory_touch(inventory);
 		return OK;
 	}
 
@@ -209,3 +219,32 @@ STATUS inventory_print_save(char *filename, Inventory* inventory, Id player) {
   fclose(file);
   return OK;
 }
+
+/** inventory_set_epoch sets the change counter the inventory bumps when it is modified
+ */
+STATUS inventory_set_epoch(Inventory *inventory, unsigned long *epoch)
+{
+  /* Error control */
+  if (!inventory)
+  {
+    return ERROR;
+  }
+
+  inventory->epoch = epoch;
+
+  return OK;
+}
+
+/**
+ * @brief Tells the game that an inventory changed
+ * @author Ignacio Nunez
+ *
+ * @param inventory pointer to the inventory
+ */
+void inventory_touch(Inventory *inventory)
+{
+  if (inventory->epoch)
+  {
+    (*inventory->epoch)++;
+  }
+}
@@ -0,0 +1,136 @@
+/**
+ * @brief It implements the layout of the screen
+ *
+ * @file layout.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include "../include/layout.h"
+
+#define LAYOUT_MAP_COLUMNS 80  /*!< Widest map */
+#define LAYOUT_MAP_ROWS 25     /*!< Highest map */
+#define LAYOUT_DESCRIPT_MIN 24 /*!< Narrowest description shown next to the map */
+#define LAYOUT_TEXT_ROWS 3     /*!< Rows of the dialogue and events in the compact layout */
+
+/**
+ * @brief Areas of the usual screen
+ */
+static const Layout_rect layout_wide[L_AREAS] = {
+    {1, 1, 80, 25},   /*!< Map */
+    {82, 1, 35, 34},  /*!< Description */
+    {30, 27, 19, 1},  /*!< Banner */
+    {1, 28, 80, 3},   /*!< Help */
+    {1, 32, 80, 3},   /*!< Feedback */
+    {1, 36, 80, 7},   /*!< Dialogue */
+    {82, 36, 35, 7}}; /*!< Events */
+
+/*Private functions*/
+void layout_set(Layout_rect *rect, int x, int y, int width, int height);
+
+/**
+ * layout_compute Works out the layout for a terminal
+ */
+STATUS layout_compute(Layout *layout, int rows, int columns)
+{
+  int map_w, map_h, side_w, events_w;
+
+  /*Error control*/
+  if (!layout)
+  {
+    return ERROR;
+  }
+
+  /* The row under the screen is the one of the prompt */
+  rows--;
+  if (rows >= LAYOUT_ROWS && columns >= LAYOUT_COLUMNS)
+  {
+    layout->rows = LAYOUT_ROWS;
+    layout->columns = LAYOUT_COLUMNS;
+    layout->compact = FALSE;
+    memcpy(layout->area, layout_wide, sizeof(layout_wide));
+    return OK;
+  }
+
+  layout->rows = rows < LAYOUT_MIN_ROWS ? LAYOUT_MIN_ROWS : rows;
+  layout->columns = columns < LAYOUT_MIN_COLUMNS ? LAYOUT_MIN_COLUMNS : columns;
+  layout->compact = TRUE;
+  memset(layout->area, 0, sizeof(layout->area));
+
+  /* The description goes next to the map only if it fits there */
+  map_w = layout->columns - 2 < LAYOUT_MAP_COLUMNS ? layout->columns - 2 : LAYOUT_MAP_COLUMNS;
+  side_w = layout->columns - map_w - 3;
+  if (side_w < LAYOUT_DESCRIPT_MIN)
+  {
+    side_w = 0;
+    map_w = layout->columns - 2;
+  }
+
+  /* Under the map: feedback, then dialogue and events, each with a border */
+  map_h = layout->rows - LAYOUT_TEXT_ROWS - 5;
+  map_h = map_h > LAYOUT_MAP_ROWS ? LAYOUT_MAP_ROWS : map_h;
+
+  layout_set(&layout->area[L_MAP], 1, 1, map_w, map_h);
+  layout_set(&layout->area[L_FEEDBACK], 1, map_h + 2, layout->columns - 2, 1);
+  if (side_w > 0)
+  {
+    layout_set(&layout->area[L_DESCRIPT], map_w + 2, 1, side_w, map_h);
+    layout_set(&layout->area[L_DIALOGUE], 1, map_h + 4, map_w, LAYOUT_TEXT_ROWS);
+    layout_set(&layout->area[L_EVENTS], map_w + 2, map_h + 4, side_w, LAYOUT_TEXT_ROWS);
+  }
+  else
+  {
+    events_w = (layout->columns - 3) / 3;
+    layout_set(&layout->area[L_DIALOGUE], 1, map_h + 4, layout->columns - events_w - 3, LAYOUT_TEXT_ROWS);
+    layout_set(&layout->area[L_EVENTS], layout->columns - events_w - 1, map_h + 4, events_w, LAYOUT_TEXT_ROWS);
+  }
+
+  return OK;
+}
+
+/**
+ * layout_get_terminal Gets the size of a terminal
+ */
+STATUS layout_get_terminal(int fd, int *rows, int *columns)
+{
+  struct winsize ws;
+
+  /*Error control*/
+  if (!rows || !columns)
+  {
+    return ERROR;
+  }
+
+  if (ioctl(fd, TIOCGWINSZ, &ws) != 0 || ws.ws_row == 0 || ws.ws_col == 0)
+  {
+    return ERROR;
+  }
+
+  *rows = ws.ws_row;
+  *columns = ws.ws_col;
+
+  return OK;
+}
+
+/**
+ * @brief Sets the fields of a rectangle
+ * @author Ignacio Nunez
+ *
+ * @param rect pointer to the rectangle
+ * @param x column of the up-left corner
+ * @param y row of the up-left corner
+ * @param width width
+ * @param height height
+ */
+void layout_set(Layout_rect *rect, int x, int y, int width, int height)
+{
+  rect->x = x;
+  rect->y = y;
+  rect->width = width;
+  rect->height = height;
+}
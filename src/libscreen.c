@@ -0,0 +1,398 @@
+/**
+ * @brief It implements the screen interface
+ *
+ * The screen keeps two frames: the back frame, where the areas write, and
+ * the front frame, a copy of what the terminal is showing. screen_paint
+ * compares both and only sends the cells that changed, placing the cursor
+ * with escape sequences, in a single write.
+ *
+ * @file libscreen.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers and Ignacio Nunez
+ * @version 3.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "../include/libscreen.h"
+
+#define BG_CHAR '~'    /*!< Char of the background, outside any area */
+#define FG_CHAR ' '    /*!< Char of an empty area */
+#define BG_COLOR "\033[0;34;44m" /*!< Color of the background */
+#define FG_COLOR "\033[0;30;47m" /*!< Color of the areas */
+#define NO_COLOR "\033[0m"       /*!< Default color of the terminal */
+#define MAX_GAP 8      /*!< Unchanged cells sent again instead of moving the cursor */
+#define CELL_BYTES 24  /*!< Worst number of bytes sent for a cell */
+
+#define ACCESS(d, x, y) ((d) + ((y) * screen_columns) + (x)) /*!< Position of a cell in a frame */
+
+/**
+ * @brief Area
+ *
+ * This struct stores the rectangle of an area and the 
+ * position of the next line written in the back frame.
+ */
+struct _Area
+{
+  int x;        /*!< Column of the up-left corner */
+  int y;        /*!< Row of the up-left corner */
+  int width;    /*!< Width of the area */
+  int height;   /*!< Height of the area */
+  char *cursor; /*!< Next line of the area in the back frame */
+};
+
+static char *screen_back = NULL;  /*!< Frame where the areas write */
+static char *screen_front = NULL; /*!< Frame the terminal is showing */
+static char *screen_out = NULL;   /*!< Bytes sent to the terminal in a paint */
+static int screen_rows = 0;       /*!< Rows of the screen */
+static int screen_columns = 0;    /*!< Columns of the screen */
+static int screen_full = 1;       /*!< 1 if the next paint must send every cell */
+static long screen_bytes = 0;     /*!< Bytes sent to the terminal in the last paint */
+
+/**
+ * Private functions
+ */
+int screen_area_cursor_is_out_of_bounds(Area *area);
+void screen_area_scroll_up(Area *area);
+long screen_out_move(char *out, int row, int column);
+long screen_out_cells(char *out, const char *cells, int n, const char **color);
+void screen_write(const char *buf, long len);
+
+/**
+ * screen_init allocates both frames filled with the background
+ */
+void screen_init(int rows, int columns)
+{
+  screen_destroy();
+
+  if (rows <= 0 || columns <= 0)
+  {
+    return;
+  }
+
+  screen_rows = rows;
+  screen_columns = columns;
+  screen_back = (char *)malloc(rows * columns + 1);
+  screen_front = (char *)malloc(rows * columns + 1);
+  screen_out = (char *)malloc((long)rows * columns * CELL_BYTES + 64);
+  if (!screen_back || !screen_front || !screen_out)
+  {
+    screen_destroy();
+    return;
+  }
+
+  memset(screen_back, BG_CHAR, rows * columns);
+  screen_back[rows * columns] = '\0';
+  memset(screen_front, BG_CHAR, rows * columns);
+  screen_front[rows * columns] = '\0';
+  screen_full = 1;
+}
+
+/**
+ * screen_destroy frees both frames
+ */
+void screen_destroy()
+{
+  free(screen_back);
+  free(screen_front);
+  free(screen_out);
+  screen_back = NULL;
+  screen_front = NULL;
+  screen_out = NULL;
+  screen_rows = 0;
+  screen_columns = 0;
+}
+
+/**
+ * screen_paint sends the changed cells of the back frame and 
+ * leaves the cursor in the line after the screen
+ */
+void screen_paint()
+{
+  const char *color = NULL;
+  long len = 0;
+  int row, col, end, last, next;
+  int cur_row = -1, cur_col = -1;
+
+  if (!screen_back)
+  {
+    return;
+  }
+
+  if (screen_full)
+  {
+    /* Cursor home and clear: the terminal shows nothing we know of */
+    memcpy(screen_out, "\033[H\033[2J", 7);
+    len = 7;
+  }
+
+  for (row = 0; row < screen_rows; row++)
+  {
+    const char *back = ACCESS(screen_back, 0, row);
+    char *front = ACCESS(screen_front, 0, row);
+
+    if (!screen_full && memcmp(back, front, screen_columns) == 0)
+    {
+      continue;
+    }
+
+    if (screen_full)
+    {
+      len += screen_out_move(screen_out + len, row, 0);
+      len += screen_out_cells(screen_out + len, back, screen_columns, &color);
+      cur_row = -1;
+      memcpy(front, back, screen_columns);
+      continue;
+    }
+
+    for (col = 0; col < screen_columns; col = end)
+    {
+      if (back[col] == front[col])
+      {
+        end = col + 1;
+        continue;
+      }
+
+      /* Joins changes separated by a few unchanged cells */
+      last = col;
+      for (next = col + 1; next < screen_columns && next - last <= MAX_GAP; next++)
+      {
+        if (back[next] != front[next])
+        {
+          last = next;
+        }
+      }
+      end = last + 1;
+
+      if (cur_row != row || cur_col != col)
+      {
+        len += screen_out_move(screen_out + len, row, col);
+      }
+      len += screen_out_cells(screen_out + len, back + col, end - col, &color);
+      memcpy(front + col, back + col, end - col);
+      cur_row = row;
+      cur_col = end;
+    }
+  }
+
+  /* The prompt is written after the screen, erasing the last command */
+  len += screen_out_move(screen_out + len, screen_rows, 0);
+  memcpy(screen_out + len, NO_COLOR "\033[J", 7);
+  len += 7;
+
+  screen_full = 0;
+  screen_bytes = len;
+  screen_write(screen_out, len);
+}
+
+/**
+ * screen_get_bytes gets the number of bytes sent by the last paint
+ */
+long screen_get_bytes()
+{
+  return screen_bytes;
+}
+
+/**
+ * screen_area_init creates an area and clears its rectangle
+ */
+Area *screen_area_init(int x, int y, int width, int height)
+{
+  Area *area = NULL;
+
+  if (!screen_back || x < 0 || y < 0 || width <= 0 || height <= 0 ||
+      x + width > screen_columns || y + height > screen_rows)
+  {
+    return NULL;
+  }
+
+  area = (Area *)malloc(sizeof(Area));
+  if (!area)
+  {
+    return NULL;
+  }
+
+  area->x = x;
+  area->y = y;
+  area->width = width;
+  area->height = height;
+  screen_area_clear(area);
+
+  return area;
+}
+
+/**
+ * screen_area_destroy frees an area
+ */
+void screen_area_destroy(Area *area)
+{
+  free(area);
+}
+
+/**
+ * screen_area_clear fills the area with blanks and resets its cursor
+ */
+void screen_area_clear(Area *area)
+{
+  int i;
+
+  if (!area || !screen_back)
+  {
+    return;
+  }
+
+  screen_area_reset_cursor(area);
+  for (i = 0; i < area->height; i++)
+  {
+    memset(ACCESS(area->cursor, 0, i), FG_CHAR, area->width);
+  }
+}
+
+/**
+ * screen_area_reset_cursor moves the cursor to the first line of the area
+ */
+void screen_area_reset_cursor(Area *area)
+{
+  if (!area || !screen_back)
+  {
+    return;
+  }
+
+  area->cursor = ACCESS(screen_back, area->x, area->y);
+}
+
+/**
+ * screen_area_puts writes a string in the next line of the area, using 
+ * more lines if it is wider than the area. When the area is full its 
+ * lines scroll up.
+ */
+void screen_area_puts(Area *area, char *str)
+{
+  int len, i;
+  const char *ptr = NULL;
+
+  if (!area || !str || !screen_back)
+  {
+    return;
+  }
+
+  len = strlen(str);
+  for (ptr = str; ptr < str + len; ptr += area->width)
+  {
+    if (screen_area_cursor_is_out_of_bounds(area))
+    {
+      screen_area_scroll_up(area);
+    }
+
+    memset(area->cursor, FG_CHAR, area->width);
+    /* Every byte of a multibyte char (accents, tildes...) is shown as
+       '?', so every cell of the frame is one column of the terminal */
+    for (i = 0; i < area->width && ptr[i] != '\0'; i++)
+    {
+      area->cursor[i] = ((unsigned char)ptr[i] >= 0x80) ? '?' : ptr[i];
+    }
+    area->cursor += screen_columns;
+  }
+}
+
+/**
+ * Private functions
+ */
+
+/**
+ * @brief Tells if the cursor of an area is below its last line
+ */
+int screen_area_cursor_is_out_of_bounds(Area *area)
+{
+  return area->cursor > ACCESS(screen_back, area->x + area->width - 1, area->y + area->height - 1);
+}
+
+/**
+ * @brief Moves every line of the area one line up and leaves 
+ * the cursor in the last line
+ */
+void screen_area_scroll_up(Area *area)
+{
+  int i;
+
+  for (i = 0; i < area->height - 1; i++)
+  {
+    memcpy(ACCESS(screen_back, area->x, area->y + i), ACCESS(screen_back, area->x, area->y + i + 1), area->width);
+  }
+  area->cursor = ACCESS(screen_back, area->x, area->y + area->height - 1);
+}
+
+/**
+ * @brief Writes the escape sequence that moves the cursor
+ *
+ * @return number of bytes written
+ */
+long screen_out_move(char *out, int row, int column)
+{
+  return sprintf(out, "\033[%d;%dH", row + 1, column + 1);
+}
+
+/**
+ * @brief Writes some cells, changing the color only when it is needed
+ *
+ * @param out where the bytes are written
+ * @param cells cells to write
+ * @param n number of cells
+ * @param color last color written, it is updated
+ * @return number of bytes written
+ */
+long screen_out_cells(char *out, const char *cells, int n, const char **color)
+{
+  const char *c = NULL;
+  long len = 0;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    c = (cells[i] == BG_CHAR) ? BG_COLOR : FG_COLOR;
+    if (c != *color)
+    {
+      memcpy(out + len, c, 10);
+      len += 10;
+      *color = c;
+    }
+    out[len++] = cells[i];
+  }
+
+  return len;
+}
+
+/**
+ * @brief Sends the bytes of a paint to the terminal
+ *
+ * Anything printed before with stdio is sent first, so it is not mixed.
+ * The front frame already holds the new frame, so if the terminal does
+ * not get all of it the next paint sends every cell again.
+ */
+void screen_write(const char *buf, long len)
+{
+  ssize_t n;
+
+  fflush(stdout);
+  while (len > 0)
+  {
+    n = write(STDOUT_FILENO, buf, len);
+    if (n < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (n <= 0)
+    {
+      screen_full = 1;
+      return;
+    }
+    buf += n;
+    len -= n;
+  }
+}
@@ -26,8 +26,12 @@ struct _Link
     Id destination;      /*!< Id to space destination */
     DIRECTION direction; /*!< Defines link's direction */
     LINK_STATUS status;  /*!< Wether link is OPEN or CLOSE */
+    unsigned long *epoch; /*!< Change counter of the game it belongs to, NULL if none */
 };
 
+/*Private functions*/
+void link_touch(Link *link);
+
 /**
  * It allocs memory for a new link struct and initialize its members.
  */
@@ -59,6 +63,8 @@ Link *link_create(Id id)
     l->direction = ND;
     l->status = CLOSE;
 
+    l->epoch = NULL;
+
     /* Return initialize link */
     return l;
 }
@@ -115,6 +121,7 @@ STATUS link_set_name(Link *link, char *name)
         strcpy(link->name, name);
     }
 
+    link_touch(link);
     return OK;
 }
 
@@ -143,6 +150,7 @@ STATUS link_set_start(Link *link, Id id_space_start)
     }
 
     link->start = id_space_start;
+    link_touch(link);
     return OK;
 }
 
@@ -170,6 +178,7 @@ STATUS link_set_destination(Link *link, Id id_space_dest)
     }
 
     link->destination = id_space_dest;
+    link_touch(link);
     return OK;
 }
 
@@ -198,6 +207,7 @@ STATUS link_set_direction(Link *link, DIRECTION dir)
     }
 
     link->direction = dir;
+    link_touch(link);
     return OK;
 }
 
@@ -224,6 +234,7 @@ STATUS link_set_status(Link *link, LINK_STATUS st)
     }
 
     link->status = st;
+    link_touch(link);
     return OK;
 }
 
@@ -326,3 +337,31 @@ STATUS link_print_save(char *filename, Link *link)
     return OK;
 }
 
+/** link_set_epoch sets the change counter the link bumps when it is modified
+ */
+STATUS link_set_epoch(Link *link, unsigned long *epoch)
+{
+    /* Error control */
+    if (!link)
+    {
+        return ERROR;
+    }
+
+    link->epoch = epoch;
+
+    return OK;
+}
+
+/**
+ * @brief Tells the game that a link changed
+ * @author Ignacio Nunez
+ *
+ * @param link pointer to the link
+ */
+void link_touch(Link *link)
+{
+    if (link->epoch)
+    {
+        (*link->epoch)++;
+    }
+}
@@ -0,0 +1,525 @@
+/**
+ * @brief It implements the minimap, a view of the whole floor of the player
+ *
+ * There is a layout per floor. It places every space of the floor in a
+ * grid following its north, south, east and west links, and keeps the
+ * boxes and the lines between them already drawn.
+ *
+ * @file minimap.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/minimap.h"
+
+#define MINIMAP_FLOORS 4                                          /*!< UNKNOWN_FLOOR, DUNGEON, FLOOR_0 and ALCOVE */
+#define MINIMAP_GRID_X (MINIMAP_COLS / MINIMAP_CELL_X)            /*!< Spaces shown in a row */
+#define MINIMAP_GRID_Y ((MINIMAP_ROWS - 1) / MINIMAP_CELL_Y)      /*!< Spaces shown in a column, below the title */
+#define MINIMAP_PLAYER '@'                                        /*!< Marker of the space of the player */
+#define MINIMAP_DARK ':'                                          /*!< Fill of a dark space */
+#define MINIMAP_HIDDEN '#'                                        /*!< Fill of a space that can not be seen */
+
+/**
+ * @brief Layout of a floor
+ *
+ * Positions are kept in the order of the spaces in the view.
+ */
+typedef struct
+{
+  BOOL valid;                                   /*!< FALSE if it has not been worked out */
+  int n;                                        /*!< Number of spaces */
+  Id id[MAX_SPACES];                            /*!< Their ids */
+  int x[MAX_SPACES];                            /*!< Column of each one in the grid */
+  int y[MAX_SPACES];                            /*!< Row of each one in the grid */
+  int width;                                    /*!< Columns of the grid */
+  int height;                                   /*!< Rows of the grid */
+  BOOL drawn;                                   /*!< FALSE if frame has not been drawn */
+  int ox;                                       /*!< First column of the grid in frame */
+  int oy;                                       /*!< First row of the grid in frame */
+  int left;                                     /*!< Column of frame where the boxes start */
+  int top;                                      /*!< Row of frame where the boxes start */
+  char frame[MINIMAP_ROWS][MINIMAP_COLS + 1];   /*!< Boxes and links, without the player or the light */
+} Minimap_layout;
+
+/**
+ * @brief Minimap
+ *
+ * This struct stores the layouts of the floors and the last drawing.
+ */
+struct _Minimap
+{
+  Minimap_layout floors[MINIMAP_FLOORS];        /*!< Layout of each floor */
+  Minimap_layout *shown;                        /*!< Layout of the last drawing */
+  char rows[MINIMAP_ROWS][MINIMAP_COLS + 1];    /*!< Last drawing */
+  long layouts;                                 /*!< Layouts worked out */
+};
+
+/*Private functions*/
+int minimap_find(const Minimap_layout *lay, Id id);
+BOOL minimap_same_spaces(const Minimap_layout *lay, const View *view);
+void minimap_layout(Minimap_layout *lay, const View *view);
+int minimap_origin(int size, int shown, int pos);
+void minimap_draw(Minimap_layout *lay, const View *view, int ox, int oy);
+BOOL minimap_cell(const Minimap_layout *lay, int i, int *row, int *col);
+
+/**
+ * minimap_create Allocates memory for a new minimap, without any layout
+ */
+Minimap *minimap_create()
+{
+  Minimap *mm = NULL;
+
+  mm = (Minimap *) malloc(sizeof(Minimap));
+  if (!mm)
+  {
+    return NULL;
+  }
+
+  minimap_clear(mm);
+  mm->layouts = 0;
+
+  return mm;
+}
+
+/**
+ * minimap_destroy Frees the previously allocated memory for a minimap
+ */
+STATUS minimap_destroy(Minimap *mm)
+{
+  /*Error control*/
+  if (!mm)
+  {
+    return ERROR;
+  }
+
+  free(mm);
+
+  return OK;
+}
+
+/**
+ * minimap_clear Drops the layouts of every floor
+ */
+STATUS minimap_clear(Minimap *mm)
+{
+  int i;
+
+  /*Error control*/
+  if (!mm)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < MINIMAP_FLOORS; i++)
+  {
+    mm->floors[i].valid = FALSE;
+    mm->floors[i].drawn = FALSE;
+  }
+  mm->shown = NULL;
+
+  for (i = 0; i < MINIMAP_ROWS; i++)
+  {
+    memset(mm->rows[i], ' ', MINIMAP_COLS);
+    mm->rows[i][MINIMAP_COLS] = '\0';
+  }
+
+  return OK;
+}
+
+/**
+ * minimap_render Draws the floor of a view
+ */
+STATUS minimap_render(Minimap *mm, const View *view)
+{
+  Minimap_layout *lay = NULL;
+  const View_cell *cell = NULL;
+  int i, p, row, col, ox, oy;
+
+  /*Error control*/
+  if (!mm || !view || view->floor < UNKNOWN_FLOOR || view->floor >= UNKNOWN_FLOOR + MINIMAP_FLOORS)
+  {
+    return ERROR;
+  }
+
+  lay = &mm->floors[view->floor - UNKNOWN_FLOOR];
+  if (lay->valid == FALSE || minimap_same_spaces(lay, view) == FALSE)
+  {
+    minimap_layout(lay, view);
+    mm->layouts++;
+  }
+
+  /* The part of the grid shown follows the player */
+  p = minimap_find(lay, view->player_location);
+  ox = minimap_origin(lay->width, MINIMAP_GRID_X, p < 0 ? 0 : lay->x[p]);
+  oy = minimap_origin(lay->height, MINIMAP_GRID_Y, p < 0 ? 0 : lay->y[p]);
+  if (lay->drawn == FALSE || ox != lay->ox || oy != lay->oy)
+  {
+    minimap_draw(lay, view, ox, oy);
+  }
+
+  memcpy(mm->rows, lay->frame, sizeof(mm->rows));
+  mm->shown = lay;
+
+  /* Only the light, the hidden spaces and the player change every turn */
+  for (i = 0; i < lay->n; i++)
+  {
+    if (minimap_cell(lay, i, &row, &col) == FALSE)
+    {
+      continue;
+    }
+
+    cell = &view->cells[i];
+    if (cell->hidden == TRUE)
+    {
+      memset(mm->rows[row + 1] + col + 1, MINIMAP_HIDDEN, VIEW_CELL_NAME);
+      memset(mm->rows[row + 2] + col + 1, MINIMAP_HIDDEN, VIEW_CELL_NAME);
+    }
+    else if (cell->light == DARK)
+    {
+      memset(mm->rows[row + 2] + col + 1, MINIMAP_DARK, VIEW_CELL_NAME);
+    }
+
+    if (i == p)
+    {
+      mm->rows[row + 2][col + 1 + VIEW_CELL_NAME / 2] = MINIMAP_PLAYER;
+    }
+  }
+
+  return OK;
+}
+
+/**
+ * minimap_get_row Gets a row of the last drawing of a minimap
+ */
+const char *minimap_get_row(const Minimap *mm, int row)
+{
+  /*Error control*/
+  if (!mm || row < 0 || row >= MINIMAP_ROWS)
+  {
+    return NULL;
+  }
+
+  return mm->rows[row];
+}
+
+/**
+ * minimap_get_layouts Gets how many layouts a minimap has worked out
+ */
+long minimap_get_layouts(const Minimap *mm)
+{
+  /*Error control*/
+  if (!mm)
+  {
+    return -1;
+  }
+
+  return mm->layouts;
+}
+
+/**
+ * minimap_get_position Gets where a space is in the last drawing of a minimap
+ */
+STATUS minimap_get_position(const Minimap *mm, Id id, int *row, int *col)
+{
+  int i;
+
+  /*Error control*/
+  if (!mm || !row || !col || !mm->shown)
+  {
+    return ERROR;
+  }
+
+  i = minimap_find(mm->shown, id);
+  if (i < 0 || minimap_cell(mm->shown, i, row, col) == FALSE)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Finds a space in a layout
+ * @author Ignacio Nunez
+ *
+ * @param lay pointer to the layout
+ * @param id id of the space
+ * @return its position in the layout, -1 if it is not there
+ */
+int minimap_find(const Minimap_layout *lay, Id id)
+{
+  int i;
+
+  if (id == NO_ID)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < lay->n; i++)
+  {
+    if (lay->id[i] == id)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Checks if a layout was worked out from the spaces of a view
+ * @author Ignacio Nunez
+ *
+ * @param lay pointer to the layout
+ * @param view pointer to the view
+ * @return TRUE if the spaces are the same and in the same order, FALSE otherwise
+ */
+BOOL minimap_same_spaces(const Minimap_layout *lay, const View *view)
+{
+  int i;
+
+  if (lay->n != view->n_cells)
+  {
+    return FALSE;
+  }
+
+  for (i = 0; i < lay->n; i++)
+  {
+    if (lay->id[i] != view->cells[i].id)
+    {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Works out the grid position of every space of the floor of a view
+ * @author Ignacio Nunez
+ *
+ * Each group of spaces joined by north, south, east or west links is laid
+ * out with a breadth first search from its first space, and the groups
+ * are put one next to the other. A space whose place is already taken is
+ * left for a later group.
+ * @param lay pointer to the layout to fill
+ * @param view pointer to the view
+ */
+void minimap_layout(Minimap_layout *lay, const View *view)
+{
+  const int dx[VIEW_CELL_LINKS] = {0, 0, 1, -1}, dy[VIEW_CELL_LINKS] = {-1, 1, 0, 0};
+  BOOL placed[MAX_SPACES];
+  int queue[MAX_SPACES];
+  int i, j, k, d, c, x, y, head, tail, min_x, max_x, min_y, max_y;
+  BOOL taken;
+
+  lay->valid = TRUE;
+  lay->drawn = FALSE;
+  lay->n = view->n_cells;
+  lay->width = 0;
+  lay->height = 0;
+  for (i = 0; i < lay->n; i++)
+  {
+    lay->id[i] = view->cells[i].id;
+    placed[i] = FALSE;
+  }
+
+  for (i = 0; i < lay->n; i++)
+  {
+    if (placed[i] == TRUE)
+    {
+      continue;
+    }
+
+    lay->x[i] = 0;
+    lay->y[i] = 0;
+    placed[i] = TRUE;
+    queue[0] = i;
+    head = 0;
+    tail = 1;
+    min_x = max_x = min_y = max_y = 0;
+
+    while (head < tail)
+    {
+      c = queue[head++];
+      for (d = 0; d < VIEW_CELL_LINKS; d++)
+      {
+        j = minimap_find(lay, view->cells[c].next[d]);
+        if (j < 0 || placed[j] == TRUE)
+        {
+          continue;
+        }
+
+        x = lay->x[c] + dx[d];
+        y = lay->y[c] + dy[d];
+        for (k = 0, taken = FALSE; k < tail && taken == FALSE; k++)
+        {
+          taken = (lay->x[queue[k]] == x && lay->y[queue[k]] == y) ? TRUE : FALSE;
+        }
+        if (taken == TRUE)
+        {
+          continue;
+        }
+
+        lay->x[j] = x;
+        lay->y[j] = y;
+        placed[j] = TRUE;
+        queue[tail++] = j;
+        min_x = x < min_x ? x : min_x;
+        max_x = x > max_x ? x : max_x;
+        min_y = y < min_y ? y : min_y;
+        max_y = y > max_y ? y : max_y;
+      }
+    }
+
+    /* The group goes to the right of the previous ones, one column apart */
+    if (lay->width > 0)
+    {
+      lay->width++;
+    }
+    for (k = 0; k < tail; k++)
+    {
+      lay->x[queue[k]] += lay->width - min_x;
+      lay->y[queue[k]] -= min_y;
+    }
+    lay->width += max_x - min_x + 1;
+    if (max_y - min_y + 1 > lay->height)
+    {
+      lay->height = max_y - min_y + 1;
+    }
+  }
+}
+
+/**
+ * @brief Gets the first row or column of a grid to show so a position is seen
+ * @author Ignacio Nunez
+ *
+ * @param size rows or columns of the grid
+ * @param shown rows or columns that fit in the minimap
+ * @param pos row or column that has to be seen
+ * @return first row or column to show
+ */
+int minimap_origin(int size, int shown, int pos)
+{
+  int origin;
+
+  if (size <= shown)
+  {
+    return 0;
+  }
+
+  origin = pos - shown / 2;
+  if (origin > size - shown)
+  {
+    origin = size - shown;
+  }
+
+  return origin < 0 ? 0 : origin;
+}
+
+/**
+ * @brief Draws the boxes of a layout and the links between them
+ * @author Ignacio Nunez
+ *
+ * @param lay pointer to the layout
+ * @param view pointer to the view the layout was worked out from
+ * @param ox first column of the grid to show
+ * @param oy first row of the grid to show
+ */
+void minimap_draw(Minimap_layout *lay, const View *view, int ox, int oy)
+{
+  const char *floor_name[MINIMAP_FLOORS] = {"UNKNOWN", "DUNGEON", "FLOOR_0", "ALCOVE"};
+  int i, j, w, h, row, col;
+  char str[MINIMAP_COLS + 1];
+
+  lay->drawn = TRUE;
+  lay->ox = ox;
+  lay->oy = oy;
+
+  /* The boxes are centred, the last one has no gap after it */
+  w = lay->width < MINIMAP_GRID_X ? lay->width : MINIMAP_GRID_X;
+  h = lay->height < MINIMAP_GRID_Y ? lay->height : MINIMAP_GRID_Y;
+  lay->left = (MINIMAP_COLS - (w * MINIMAP_CELL_X - 2)) / 2;
+  lay->top = 1 + (MINIMAP_ROWS - 1 - (h * MINIMAP_CELL_Y - 1)) / 2;
+
+  for (i = 0; i < MINIMAP_ROWS; i++)
+  {
+    memset(lay->frame[i], ' ', MINIMAP_COLS);
+    lay->frame[i][MINIMAP_COLS] = '\0';
+  }
+  sprintf(str, " Floor: %s", floor_name[view->floor - UNKNOWN_FLOOR]);
+  memcpy(lay->frame[0], str, strlen(str));
+
+  for (i = 0; i < lay->n; i++)
+  {
+    if (minimap_cell(lay, i, &row, &col) == FALSE)
+    {
+      continue;
+    }
+
+    memcpy(lay->frame[row] + col, "+------+", 8);
+    sprintf(str, "|%-*s|", VIEW_CELL_NAME, view->cells[i].name);
+    memcpy(lay->frame[row + 1] + col, str, 8);
+    memcpy(lay->frame[row + 2] + col, "|      |", 8);
+    memcpy(lay->frame[row + 3] + col, "+------+", 8);
+
+    /* Links to the east and south, the ones to the west and north are
+       drawn from the other space */
+    for (j = 0; j < lay->n; j++)
+    {
+      if (minimap_cell(lay, j, NULL, NULL) == FALSE)
+      {
+        continue;
+      }
+
+      if (((view->cells[i].next[E] == lay->id[j] || view->cells[j].next[W] == lay->id[i]) &&
+           lay->x[j] == lay->x[i] + 1 && lay->y[j] == lay->y[i]))
+      {
+        memcpy(lay->frame[row + 2] + col + 8, "--", 2);
+      }
+      if (((view->cells[i].next[S] == lay->id[j] || view->cells[j].next[N] == lay->id[i]) &&
+           lay->y[j] == lay->y[i] + 1 && lay->x[j] == lay->x[i]))
+      {
+        lay->frame[row + 4][col + 4] = '|';
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gets where the box of a space of a layout is drawn
+ * @author Ignacio Nunez
+ *
+ * @param lay pointer to the layout, already drawn
+ * @param i position of the space in the layout
+ * @param row where the row of the top left corner is returned, it may be NULL
+ * @param col where the column of that corner is returned, it may be NULL
+ * @return TRUE if the space is in the part of the grid shown, FALSE otherwise
+ */
+BOOL minimap_cell(const Minimap_layout *lay, int i, int *row, int *col)
+{
+  int x, y;
+
+  x = lay->x[i] - lay->ox;
+  y = lay->y[i] - lay->oy;
+  if (x < 0 || x >= MINIMAP_GRID_X || y < 0 || y >= MINIMAP_GRID_Y)
+  {
+    return FALSE;
+  }
+
+  if (row)
+  {
+    *row = lay->top + y * MINIMAP_CELL_Y;
+  }
+  if (col)
+  {
+    *col = lay->left + x * MINIMAP_CELL_X;
+  }
+
+  return TRUE;
+}
@@ -33,8 +33,12 @@ struct _Object
   Light light_visible;          /*!< Tells the light conditions when the object is visible*/
   int Crit_dmg;                 /*!< Critical chance that the object adds to the one who carries it*/
   int Durability;               /*!< Durability points left(-1 if it is not breakable)*/
+  unsigned long *epoch;         /*!< Change counter of the game it belongs to, NULL if none */
 } ;
 
+/*Private functions*/
+void object_touch(Object *obj);
+
 /** obj_create saves memory for a new object and initializes its parameters
  */
 Object *obj_create(Id id)
@@ -63,6 +67,8 @@ Object *obj_create(Id id)
   new_obj->illuminate = FALSE;
   new_obj->turnedon = FALSE;
 
+  new_obj->epoch = NULL;
+
   return new_obj;
 }
 
@@ -155,6 +161,7 @@ STATUS obj_set_name(Object *obj, char *name)
     strcpy(obj->name, name);
   }
 
+  object_touch(obj);
   return OK;
 }
 
@@ -187,6 +194,7 @@ STATUS obj_set_description(Object *obj, char *description)
     return ERROR;
   }
 
+  object_touch(obj);
   return OK;
 }
 
@@ -210,6 +218,7 @@ STATUS obj_set_location(Object *obj, Id id)
   }
 
   obj->location = id;
+  object_touch(obj);
   return OK;
 }
 
@@ -285,6 +294,7 @@ STATUS object_set_movable(Object *obj, BOOL cond)
     obj->movable = TRUE;
   }
 
+  object_touch(obj);
   return OK;
 }
 
@@ -299,6 +309,7 @@ STATUS object_set_dependency(Object *obj, Id id)
 
   obj->dependency = id;
 
+  object_touch(obj);
   return OK;
 }
 
@@ -313,6 +324,7 @@ STATUS object_set_open(Object *obj, Id id)
 
   obj->open = id;
 
+  object_touch(obj);
   return OK;
 }
 
@@ -327,6 +339,7 @@ STATUS object_set_illuminate(Object *obj, BOOL cond)
 
   obj->illuminate = cond;
 
+  object_touch(obj);
   return OK;
 }
 
@@ -341,6 +354,7 @@ STATUS object_set_turnedon(Object *obj, BOOL cond)
 
   obj->turnedon = cond;
 
+  object_touch(obj);
   return OK;
 }
 
@@ -414,6 +428,7 @@ STATUS object_set_light_visible(Object *obj, Light light)
   }
 
   obj->light_visible = light;
+  object_touch(obj);
   return OK;
 }
 
@@ -521,6 +536,7 @@ STATUS object_set_crit(Object *obj, int crit){
   }
  obj->Crit_dmg = crit;
  
+ object_touch(obj);
  return OK;
 }
 
@@ -541,6 +557,7 @@ STATUS object_set_durability(Object *obj, int dur){
   }
  obj->Durability = dur;
  
+ object_touch(obj);
  return OK;
 }
 
@@ -555,3 +572,32 @@ BOOL object_isBroken(Object *obj){
   }
   return FALSE;
 }
+
+/** object_set_epoch sets the change counter the obj bumps when it is modified
+ */
+STATUS object_set_epoch(Object *obj, unsigned long *epoch)
+{
+  /* Error control */
+  if (!obj)
+  {
+    return ERROR;
+  }
+
+  obj->epoch = epoch;
+
+  return OK;
+}
+
+/**
+ * @brief Tells the game that a obj changed
+ * @author Ignacio Nunez
+ *
+ * @param obj pointer to the obj
+ */
+void object_touch(Object *obj)
+{
+  if (obj->epoch)
+  {
+    (*obj->epoch)++;
+  }
+}
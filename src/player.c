@@ -31,8 +31,12 @@ struct _Player
   int Crit_dmg;               /*!< Player's crit chance (scale 0 to 10) */
   int base_dmg;               /*!< Player's base damage */
   char **gdesc;   /*!< Graphic visualization player */
+  unsigned long *epoch; /*!< Change counter of the game it belongs to, NULL if none */
 } ;
 
+/*Private functions*/
+void player_touch(Player *player);
+
 /** player_create allocates memory for a new player
  * and initializes all its members
  */
@@ -62,6 +66,8 @@ Player *player_create(Id id)
   new_player->inventory = inventory_create();
   new_player->gdesc = NULL;
 
+  new_player->epoch = NULL;
+
   return new_player;
 }
 
@@ -183,6 +189,7 @@ STATUS player_set_health(Player *player, int health)
   }
   
   player->health = health;
+  player_touch(player);
   return OK;
 }
 
@@ -200,6 +207,7 @@ STATUS player_set_location(Player *player, Id location)
 
   player->location = location;
   
+  player_touch(player);
   return OK;
 }
 
@@ -216,6 +224,7 @@ STATUS player_add_object(Player *player, Object *object)
   }
   
   inventory_add_object(player->inventory, obj_get_id(object));
+  player_touch(player);
   return OK;
 }
 
@@ -229,6 +238,7 @@ STATUS player_del_object(Player *player, Id id_obj){
   }
   
   inventory_remove_object(player->inventory, id_obj);
+  player_touch(player);
   return OK;
 }
 
@@ -280,6 +290,7 @@ STATUS player_set_name(Player *player, char *name)
     strcpy(player->name, name);
   }
   
+  player_touch(player);
   return OK;
 }
 
@@ -307,6 +318,7 @@ STATUS player_set_max_inventory(Player* player, int num)
   }
 
   inventory_set_maxObjs(player->inventory, num);
+  player_touch(player);
   return OK;
 }
 
@@ -317,6 +329,7 @@ STATUS player_set_max_health(Player *player, int health)
 
   player->max_health = health;
 
+  player_touch(player);
   return OK;
 }
 
@@ -372,6 +385,7 @@ STATUS player_set_crit(Player *player, int crit){
   }
  player->Crit_dmg = crit;
 
+ player_touch(player);
  return OK;
 }
 
@@ -388,6 +402,7 @@ STATUS player_set_baseDmg(Player *player, int base_dmg){
   }
  player->base_dmg = base_dmg;
 
+ player_touch(player);
  return OK;
 }
 
@@ -460,6 +475,7 @@ STATUS player_set_gdesc(Player *p, char **newgdesc)
 
   p->gdesc = newgdesc;
 
+  player_touch(p);
   return OK;
 }
 
@@ -473,3 +489,33 @@ char **player_get_gdesc(Player *p)
 
   return p->gdesc;
 }
+
+/** player_set_epoch sets the change counter the player bumps when it is modified
+ */
+STATUS player_set_epoch(Player *player, unsigned long *epoch)
+{
+  /* Error control */
+  if (!player)
+  {
+    return ERROR;
+  }
+
+  player->epoch = epoch;
+  inventory_set_epoch(player->inventory, epoch);
+
+  return OK;
+}
+
+/**
+ * @brief Tells the game that a player changed
+ * @author Ignacio Nunez
+ *
+ * @param player pointer to the player
+ */
+void player_touch(Player *player)
+{
+  if (player->epoch)
+  {
+    (*player->epoch)++;
+  }
+}
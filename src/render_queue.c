@@ -0,0 +1,241 @@
+/**
+ * @brief It implements the queue of views waiting to be painted
+ *
+ * A ring of views with a lock that only guards the indexes. Copying a
+ * view in or painting it is done outside the lock, as nobody else uses
+ * that slot at the time.
+ *
+ * @file render_queue.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../include/render_queue.h"
+
+/**
+ * @brief Render_queue
+ *
+ * This struct stores the views of a queue and who is waiting for it.
+ */
+struct _Render_queue
+{
+  View *views;              /*!< Ring of views */
+  int size;                 /*!< Number of slots */
+  long head;                /*!< Views taken out so far, the front is head % size */
+  long tail;                /*!< Views put in so far, the back is tail % size */
+  BOOL closed;              /*!< TRUE once no more views will be put in */
+  pthread_mutex_t lock;     /*!< Guards head, tail and closed */
+  pthread_cond_t not_empty; /*!< Signaled when a view is put in or the queue is closed */
+  pthread_cond_t not_full;  /*!< Signaled when a view is taken out */
+};
+
+/**
+ * render_queue_create Allocates memory for a new, empty queue
+ */
+Render_queue *render_queue_create(int size)
+{
+  Render_queue *q = NULL;
+
+  /*Error control*/
+  if (size < 1)
+  {
+    return NULL;
+  }
+
+  q = (Render_queue *) malloc(sizeof(Render_queue));
+  if (!q)
+  {
+    return NULL;
+  }
+
+  q->views = (View *) malloc(size * sizeof(View));
+  if (!q->views)
+  {
+    free(q);
+    return NULL;
+  }
+
+  q->size = size;
+  q->head = 0;
+  q->tail = 0;
+  q->closed = FALSE;
+  pthread_mutex_init(&q->lock, NULL);
+  pthread_cond_init(&q->not_empty, NULL);
+  pthread_cond_init(&q->not_full, NULL);
+
+  return q;
+}
+
+/**
+ * render_queue_destroy Frees the previously allocated memory for a queue
+ */
+STATUS render_queue_destroy(Render_queue *q)
+{
+  /*Error control*/
+  if (!q)
+  {
+    return ERROR;
+  }
+
+  pthread_cond_destroy(&q->not_full);
+  pthread_cond_destroy(&q->not_empty);
+  pthread_mutex_destroy(&q->lock);
+  free(q->views);
+  free(q);
+
+  return OK;
+}
+
+/**
+ * render_queue_push Puts a copy of a view at the back of a queue
+ */
+STATUS render_queue_push(Render_queue *q, const View *view)
+{
+  long slot;
+
+  /*Error control*/
+  if (!q || !view)
+  {
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  while (q->tail - q->head == q->size && q->closed == FALSE)
+  {
+    pthread_cond_wait(&q->not_full, &q->lock);
+  }
+  if (q->closed == TRUE)
+  {
+    pthread_mutex_unlock(&q->lock);
+    return ERROR;
+  }
+  slot = q->tail % q->size;
+  pthread_mutex_unlock(&q->lock);
+
+  /* The consumer does not read this slot until tail moves */
+  memcpy(&q->views[slot], view, sizeof(View));
+
+  pthread_mutex_lock(&q->lock);
+  q->tail++;
+  pthread_cond_signal(&q->not_empty);
+  pthread_mutex_unlock(&q->lock);
+
+  return OK;
+}
+
+/**
+ * render_queue_front Gets the view at the front of a queue, leaving it there
+ */
+const View *render_queue_front(Render_queue *q)
+{
+  const View *view = NULL;
+
+  /*Error control*/
+  if (!q)
+  {
+    return NULL;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  while (q->head == q->tail && q->closed == FALSE)
+  {
+    pthread_cond_wait(&q->not_empty, &q->lock);
+  }
+  if (q->head != q->tail)
+  {
+    view = &q->views[q->head % q->size];
+  }
+  pthread_mutex_unlock(&q->lock);
+
+  return view;
+}
+
+/**
+ * render_queue_pop Takes out the view at the front of a queue
+ */
+STATUS render_queue_pop(Render_queue *q)
+{
+  /*Error control*/
+  if (!q)
+  {
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  if (q->head == q->tail)
+  {
+    pthread_mutex_unlock(&q->lock);
+    return ERROR;
+  }
+  q->head++;
+  pthread_cond_broadcast(&q->not_full);
+  pthread_mutex_unlock(&q->lock);
+
+  return OK;
+}
+
+/**
+ * render_queue_wait Waits until every view of a queue has been taken out
+ */
+STATUS render_queue_wait(Render_queue *q)
+{
+  /*Error control*/
+  if (!q)
+  {
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  while (q->head != q->tail)
+  {
+    pthread_cond_wait(&q->not_full, &q->lock);
+  }
+  pthread_mutex_unlock(&q->lock);
+
+  return OK;
+}
+
+/**
+ * render_queue_close Closes a queue, no more views will be put in it
+ */
+STATUS render_queue_close(Render_queue *q)
+{
+  /*Error control*/
+  if (!q)
+  {
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  q->closed = TRUE;
+  pthread_cond_broadcast(&q->not_empty);
+  pthread_cond_broadcast(&q->not_full);
+  pthread_mutex_unlock(&q->lock);
+
+  return OK;
+}
+
+/**
+ * render_queue_get_count Gets the number of views in a queue
+ */
+int render_queue_get_count(Render_queue *q)
+{
+  int count;
+
+  /*Error control*/
+  if (!q)
+  {
+    return -1;
+  }
+
+  pthread_mutex_lock(&q->lock);
+  count = (int)(q->tail - q->head);
+  pthread_mutex_unlock(&q->lock);
+
+  return count;
+}
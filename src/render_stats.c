@@ -0,0 +1,306 @@
+/**
+ * @brief It implements the statistics of the renderer
+ *
+ * @file render_stats.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "../include/render_stats.h"
+
+#define BAR_WIDTH 40 /*!< Width of the bar of the biggest bucket */
+
+/**
+ * @brief Histogram of one thing measured
+ */
+typedef struct
+{
+  long count;                          /*!< Values added */
+  long sum;                            /*!< Sum of the values */
+  long max;                            /*!< Biggest value */
+  long bucket[RENDER_STATS_BUCKETS];   /*!< Values in each bucket */
+} Histogram;
+
+/**
+ * @brief Render_stats
+ *
+ * This struct stores a histogram for each thing measured.
+ */
+struct _Render_stats
+{
+  Histogram hist[RS_STATS]; /*!< Histograms */
+  pthread_mutex_t lock;     /*!< Guards the histograms */
+};
+
+/**
+ * @brief Names of the things measured, in the order of Render_stat
+ */
+static const char *render_stats_names[RS_STATS] = {
+    "build (us)", "map (us)", "descript (us)", "help (us)", "feedback (us)",
+    "dialogue (us)", "screen (us)", "paint (us)", "bytes"};
+
+/*Private functions*/
+int render_stats_bucket(long value);
+long render_stats_percentile(const Histogram *h, int percent);
+
+/**
+ * render_stats_create Allocates memory for new, empty statistics
+ */
+Render_stats *render_stats_create()
+{
+  Render_stats *rs = NULL;
+
+  rs = (Render_stats *) malloc(sizeof(Render_stats));
+  if (!rs)
+  {
+    return NULL;
+  }
+
+  memset(rs->hist, 0, sizeof(rs->hist));
+  pthread_mutex_init(&rs->lock, NULL);
+
+  return rs;
+}
+
+/**
+ * render_stats_destroy Frees the previously allocated memory for some statistics
+ */
+STATUS render_stats_destroy(Render_stats *rs)
+{
+  /*Error control*/
+  if (!rs)
+  {
+    return ERROR;
+  }
+
+  pthread_mutex_destroy(&rs->lock);
+  free(rs);
+
+  return OK;
+}
+
+/**
+ * render_stats_add Adds a value to a histogram
+ */
+STATUS render_stats_add(Render_stats *rs, Render_stat stat, long value)
+{
+  Histogram *h = NULL;
+
+  /*Error control*/
+  if (!rs || stat < 0 || stat >= RS_STATS)
+  {
+    return ERROR;
+  }
+
+  if (value < 0)
+  {
+    value = 0;
+  }
+
+  pthread_mutex_lock(&rs->lock);
+  h = &rs->hist[stat];
+  h->count++;
+  h->sum += value;
+  if (value > h->max)
+  {
+    h->max = value;
+  }
+  h->bucket[render_stats_bucket(value)]++;
+  pthread_mutex_unlock(&rs->lock);
+
+  return OK;
+}
+
+/**
+ * render_stats_start Starts measuring a time
+ */
+long render_stats_start(Render_stats *rs)
+{
+  struct timespec ts;
+
+  if (!rs || clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+  {
+    return 0;
+  }
+
+  return (long)ts.tv_sec * 1000000L + ts.tv_nsec / 1000;
+}
+
+/**
+ * render_stats_stop Adds the time since render_stats_start to a histogram
+ */
+STATUS render_stats_stop(Render_stats *rs, Render_stat stat, long start)
+{
+  /*Error control*/
+  if (!rs)
+  {
+    return ERROR;
+  }
+
+  return render_stats_add(rs, stat, render_stats_start(rs) - start);
+}
+
+/**
+ * render_stats_get_count Gets the number of values added to a histogram
+ */
+long render_stats_get_count(Render_stats *rs, Render_stat stat)
+{
+  long count;
+
+  /*Error control*/
+  if (!rs || stat < 0 || stat >= RS_STATS)
+  {
+    return -1;
+  }
+
+  pthread_mutex_lock(&rs->lock);
+  count = rs->hist[stat].count;
+  pthread_mutex_unlock(&rs->lock);
+
+  return count;
+}
+
+/**
+ * render_stats_get_bucket Gets the number of values in a bucket of a histogram
+ */
+long render_stats_get_bucket(Render_stats *rs, Render_stat stat, int bucket)
+{
+  long count;
+
+  /*Error control*/
+  if (!rs || stat < 0 || stat >= RS_STATS || bucket < 0 || bucket >= RENDER_STATS_BUCKETS)
+  {
+    return -1;
+  }
+
+  pthread_mutex_lock(&rs->lock);
+  count = rs->hist[stat].bucket[bucket];
+  pthread_mutex_unlock(&rs->lock);
+
+  return count;
+}
+
+/**
+ * render_stats_get_max Gets the biggest value added to a histogram
+ */
+long render_stats_get_max(Render_stats *rs, Render_stat stat)
+{
+  long max;
+
+  /*Error control*/
+  if (!rs || stat < 0 || stat >= RS_STATS)
+  {
+    return -1;
+  }
+
+  pthread_mutex_lock(&rs->lock);
+  max = rs->hist[stat].count > 0 ? rs->hist[stat].max : -1;
+  pthread_mutex_unlock(&rs->lock);
+
+  return max;
+}
+
+/**
+ * render_stats_print Prints every histogram with values
+ */
+STATUS render_stats_print(Render_stats *rs, FILE *f)
+{
+  Histogram h;
+  long most;
+  int i, b, bar;
+
+  /*Error control*/
+  if (!rs || !f)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < RS_STATS; i++)
+  {
+    pthread_mutex_lock(&rs->lock);
+    h = rs->hist[i];
+    pthread_mutex_unlock(&rs->lock);
+
+    if (h.count == 0)
+    {
+      continue;
+    }
+
+    fprintf(f, "%s: count %ld, mean %ld, p50 < %ld, p99 < %ld, max %ld\n", render_stats_names[i],
+            h.count, h.sum / h.count, render_stats_percentile(&h, 50), render_stats_percentile(&h, 99), h.max);
+
+    most = 0;
+    for (b = 0; b < RENDER_STATS_BUCKETS; b++)
+    {
+      most = h.bucket[b] > most ? h.bucket[b] : most;
+    }
+    for (b = 0; b < RENDER_STATS_BUCKETS; b++)
+    {
+      if (h.bucket[b] == 0)
+      {
+        continue;
+      }
+      fprintf(f, "  %10ld - %-10ld %8ld ", b == 0 ? 0L : 1L << (b - 1), (1L << b) - 1, h.bucket[b]);
+      for (bar = (int)((h.bucket[b] * BAR_WIDTH + most - 1) / most); bar > 0; bar--)
+      {
+        fputc('#', f);
+      }
+      fputc('\n', f);
+    }
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Gets the bucket of a value
+ * @author Ignacio Nunez
+ *
+ * @param value the value, not negative
+ * @return the bucket
+ */
+int render_stats_bucket(long value)
+{
+  int b = 0;
+
+  while (value > 0 && b < RENDER_STATS_BUCKETS - 1)
+  {
+    value >>= 1;
+    b++;
+  }
+
+  return b;
+}
+
+/**
+ * @brief Gets the end of the bucket where a percentile falls
+ * @author Ignacio Nunez
+ *
+ * @param h pointer to the histogram, with values
+ * @param percent the percentile
+ * @return the first value after that bucket
+ */
+long render_stats_percentile(const Histogram *h, int percent)
+{
+  long seen = 0;
+  int b;
+
+  for (b = 0; b < RENDER_STATS_BUCKETS - 1; b++)
+  {
+    seen += h->bucket[b];
+    if (seen * 100 >= h->count * percent)
+    {
+      break;
+    }
+  }
+
+  return 1L << b;
+}
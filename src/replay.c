@@ -0,0 +1,589 @@
+/** 
+ * @brief It implements the record and replay of games
+ * 
+ * File format, every number is 4 bytes little endian:
+ *   header: "JRPL", version, seed, interval, map length, map
+ *   records: tag (1 byte), length of the data, data
+ *     'C' command: command, arg1 length, arg1, arg2 length, arg2
+ *     'K' keyframe: turn, state written by game_state_write
+ * 
+ * @file replay.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/replay.h"
+
+#define REPLAY_MAGIC "JRPL"  /*!< First bytes of a replay file */
+#define REPLAY_VERSION 1     /*!< Version of the format */
+#define REPLAY_CMD 'C'       /*!< Tag of a command record */
+#define REPLAY_KEY 'K'       /*!< Tag of a keyframe record */
+
+/**
+ * @brief Replay
+ * 
+ * This struct stores a replay being recorded (file) or 
+ * a replay loaded to be played (data and indexes).
+ */
+struct _Replay
+{
+    FILE *file;             /*!< File being recorded, NULL when playing */
+    char map[WORD_SIZE];    /*!< Data file of the game */
+    unsigned long seed;     /*!< Seed of the game */
+    int interval;           /*!< Turns between two keyframes */
+    int turns;              /*!< Number of commands */
+    unsigned char *state;   /*!< Buffer for keyframes when recording */
+    long state_size;        /*!< Size of state */
+    unsigned char *data;    /*!< Whole file when playing */
+    long len;               /*!< Size of data */
+    long *cmd_pos;          /*!< Position in data of every command, by turn - 1 */
+    int *key_turn;          /*!< Turn of every keyframe */
+    long *key_pos;          /*!< Position in data of every keyframe state */
+    long *key_len;          /*!< Size of every keyframe state */
+    int n_keys;             /*!< Number of keyframes */
+};
+
+/*Private functions*/
+Replay *replay_create();
+void replay_put(unsigned char *buf, long value);
+long replay_get(const unsigned char *buf);
+STATUS replay_write_record(Replay *r, char tag, const unsigned char *data, long len);
+STATUS replay_write_keyframe(Replay *r, Game *game);
+STATUS replay_read_file(Replay *r, char *filename);
+STATUS replay_index(Replay *r);
+
+/**
+ * replay_record creates the file and writes the header 
+ * and the keyframe of turn 0
+ */
+Replay *replay_record(char *filename, char *map, Game *game, int interval)
+{
+    Replay *r = NULL;
+    unsigned char buf[20];
+    long map_len;
+
+    /*Error control*/
+    if (!filename || !map || !game)
+    {
+        return NULL;
+    }
+
+    map_len = (long)strlen(map);
+    if (map_len >= WORD_SIZE)
+    {
+        return NULL;
+    }
+
+    r = replay_create();
+    if (!r)
+    {
+        return NULL;
+    }
+
+    strcpy(r->map, map);
+    r->seed = game_get_seed(game);
+    r->interval = (interval > 0) ? interval : REPLAY_INTERVAL;
+
+    r->file = fopen(filename, "wb");
+    if (!r->file)
+    {
+        replay_destroy(r);
+        return NULL;
+    }
+
+    memcpy(buf, REPLAY_MAGIC, 4);
+    replay_put(buf + 4, REPLAY_VERSION);
+    replay_put(buf + 8, (long)r->seed);
+    replay_put(buf + 12, r->interval);
+    replay_put(buf + 16, map_len);
+    if (fwrite(buf, 1, 20, r->file) != 20 || fwrite(map, 1, map_len, r->file) != (size_t)map_len)
+    {
+        replay_destroy(r);
+        return NULL;
+    }
+
+    if (replay_write_keyframe(r, game) == ERROR)
+    {
+        replay_destroy(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+/**
+ * replay_add_command writes a command and, every interval turns, a keyframe
+ */
+STATUS replay_add_command(Replay *r, Game *game, T_Command cmd, char *arg1, char *arg2)
+{
+    unsigned char buf[4 + 4 + MAX_ARG + 4 + MAX_ARG];
+    long len1, len2, pos = 0;
+
+    /*Error control*/
+    if (!r || !r->file || !game)
+    {
+        return ERROR;
+    }
+
+    len1 = arg1 ? (long)strlen(arg1) : 0;
+    len2 = arg2 ? (long)strlen(arg2) : 0;
+    if (len1 >= MAX_ARG || len2 >= MAX_ARG)
+    {
+        return ERROR;
+    }
+
+    replay_put(buf + pos, cmd);
+    pos += 4;
+    replay_put(buf + pos, len1);
+    pos += 4;
+    memcpy(buf + pos, arg1 ? arg1 : "", len1);
+    pos += len1;
+    replay_put(buf + pos, len2);
+    pos += 4;
+    memcpy(buf + pos, arg2 ? arg2 : "", len2);
+    pos += len2;
+
+    if (replay_write_record(r, REPLAY_CMD, buf, pos) == ERROR)
+    {
+        return ERROR;
+    }
+    r->turns++;
+
+    if (r->turns % r->interval == 0)
+    {
+        return replay_write_keyframe(r, game);
+    }
+
+    /* A crash must not lose the last commands */
+    fflush(r->file);
+
+    return OK;
+}
+
+/**
+ * replay_load reads the whole file and indexes its records
+ */
+Replay *replay_load(char *filename)
+{
+    Replay *r = NULL;
+
+    /*Error control*/
+    if (!filename)
+    {
+        return NULL;
+    }
+
+    r = replay_create();
+    if (!r)
+    {
+        return NULL;
+    }
+
+    if (replay_read_file(r, filename) == ERROR || replay_index(r) == ERROR)
+    {
+        replay_destroy(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+/**
+ * replay_destroy frees a replay
+ */
+STATUS replay_destroy(Replay *r)
+{
+    /*Error control*/
+    if (!r)
+    {
+        return ERROR;
+    }
+
+    if (r->file)
+    {
+        fclose(r->file);
+    }
+    free(r->state);
+    free(r->data);
+    free(r->cmd_pos);
+    free(r->key_turn);
+    free(r->key_pos);
+    free(r->key_len);
+    free(r);
+    r = NULL;
+
+    return OK;
+}
+
+int replay_get_turns(Replay *r)
+{
+    /*Error control*/
+    if (!r)
+    {
+        return -1;
+    }
+
+    return r->turns;
+}
+
+const char *replay_get_map(Replay *r)
+{
+    /*Error control*/
+    if (!r)
+    {
+        return NULL;
+    }
+
+    return r->map;
+}
+
+unsigned long replay_get_seed(Replay *r)
+{
+    /*Error control*/
+    if (!r)
+    {
+        return 0;
+    }
+
+    return r->seed;
+}
+
+/**
+ * replay_get_command copies a command from the loaded file
+ */
+STATUS replay_get_command(Replay *r, int turn, T_Command *cmd, char *arg1, char *arg2)
+{
+    long pos, len;
+
+    /*Error control*/
+    if (!r || !r->data || turn < 1 || turn > r->turns || !cmd || !arg1 || !arg2)
+    {
+        return ERROR;
+    }
+
+    /* replay_index already checked the lengths of every command */
+    pos = r->cmd_pos[turn - 1];
+    *cmd = (T_Command)replay_get(r->data + pos);
+    pos += 4;
+    len = replay_get(r->data + pos);
+    pos += 4;
+    memcpy(arg1, r->data + pos, len);
+    arg1[len] = '\0';
+    pos += len;
+    len = replay_get(r->data + pos);
+    pos += 4;
+    memcpy(arg2, r->data + pos, len);
+    arg2[len] = '\0';
+
+    return OK;
+}
+
+/**
+ * replay_seek restores the nearest keyframe and plays the commands after it
+ */
+STATUS replay_seek(Replay *r, Game *game, int turn)
+{
+    T_Command cmd;
+    char arg1[MAX_ARG], arg2[MAX_ARG];
+    int i, k;
+
+    /*Error control*/
+    if (!r || !r->data || !game || turn < 0 || turn > r->turns)
+    {
+        return ERROR;
+    }
+
+    /* Keyframes are stored in order of turn */
+    for (k = r->n_keys - 1; k >= 0 && r->key_turn[k] > turn; k--)
+        ;
+    if (k < 0)
+    {
+        return ERROR;
+    }
+
+    if (game_state_read(game, r->data + r->key_pos[k], r->key_len[k]) == ERROR)
+    {
+        return ERROR;
+    }
+
+    for (i = r->key_turn[k] + 1; i <= turn; i++)
+    {
+        replay_get_command(r, i, &cmd, arg1, arg2);
+        game_update(game, cmd, arg1, arg2);
+    }
+
+    return OK;
+}
+
+/**
+ * Private functions
+ */
+
+/**
+ * @brief Allocates an empty replay
+ */
+Replay *replay_create()
+{
+    Replay *r = NULL;
+
+    r = (Replay *) malloc(sizeof(Replay));
+    if (!r)
+    {
+        return NULL;
+    }
+
+    r->file = NULL;
+    r->map[0] = '\0';
+    r->seed = 0;
+    r->interval = REPLAY_INTERVAL;
+    r->turns = 0;
+    r->state = NULL;
+    r->state_size = 0;
+    r->data = NULL;
+    r->len = 0;
+    r->cmd_pos = NULL;
+    r->key_turn = NULL;
+    r->key_pos = NULL;
+    r->key_len = NULL;
+    r->n_keys = 0;
+
+    return r;
+}
+
+/**
+ * @brief Stores a number in 4 bytes, little endian
+ */
+void replay_put(unsigned char *buf, long value)
+{
+    unsigned long u = (unsigned long)value & 0xFFFFFFFFUL;
+
+    buf[0] = (unsigned char)(u & 0xFF);
+    buf[1] = (unsigned char)((u >> 8) & 0xFF);
+    buf[2] = (unsigned char)((u >> 16) & 0xFF);
+    buf[3] = (unsigned char)((u >> 24) & 0xFF);
+}
+
+/**
+ * @brief Reads a number stored by replay_put
+ */
+long replay_get(const unsigned char *buf)
+{
+    unsigned long u;
+
+    u = (unsigned long)buf[0] | ((unsigned long)buf[1] << 8) |
+        ((unsigned long)buf[2] << 16) | ((unsigned long)buf[3] << 24);
+
+    if (u & 0x80000000UL)
+    {
+        return -(long)((~u & 0xFFFFFFFFUL) + 1);
+    }
+
+    return (long)u;
+}
+
+/**
+ * @brief Writes a record (tag, length and data) in the file
+ */
+STATUS replay_write_record(Replay *r, char tag, const unsigned char *data, long len)
+{
+    unsigned char head[5];
+
+    head[0] = (unsigned char)tag;
+    replay_put(head + 1, len);
+    if (fwrite(head, 1, 5, r->file) != 5 || fwrite(data, 1, len, r->file) != (size_t)len)
+    {
+        return ERROR;
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Writes the state of the game as the keyframe of the current turn
+ */
+STATUS replay_write_keyframe(Replay *r, Game *game)
+{
+    unsigned char *aux = NULL;
+    long size;
+
+    size = game_state_write(game, NULL, 0);
+    if (size < 0)
+    {
+        return ERROR;
+    }
+
+    /* The buffer keeps the turn before the state */
+    if (size + 4 > r->state_size)
+    {
+        aux = (unsigned char *) realloc(r->state, size + 4);
+        if (!aux)
+        {
+            return ERROR;
+        }
+        r->state = aux;
+        r->state_size = size + 4;
+    }
+
+    replay_put(r->state, r->turns);
+    if (game_state_write(game, r->state + 4, size) != size)
+    {
+        return ERROR;
+    }
+
+    if (replay_write_record(r, REPLAY_KEY, r->state, size + 4) == ERROR)
+    {
+        return ERROR;
+    }
+
+    fflush(r->file);
+
+    return OK;
+}
+
+/**
+ * @brief Reads the whole file into memory and checks the header
+ */
+STATUS replay_read_file(Replay *r, char *filename)
+{
+    FILE *f = NULL;
+    long size, map_len;
+
+    f = fopen(filename, "rb");
+    if (!f)
+    {
+        return ERROR;
+    }
+
+    if (fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) < 20 || fseek(f, 0, SEEK_SET) != 0)
+    {
+        fclose(f);
+        return ERROR;
+    }
+
+    r->data = (unsigned char *) malloc(size);
+    if (!r->data || fread(r->data, 1, size, f) != (size_t)size)
+    {
+        fclose(f);
+        return ERROR;
+    }
+    fclose(f);
+    r->len = size;
+
+    if (memcmp(r->data, REPLAY_MAGIC, 4) != 0 || replay_get(r->data + 4) != REPLAY_VERSION)
+    {
+        return ERROR;
+    }
+
+    r->seed = (unsigned long)replay_get(r->data + 8) & 0xFFFFFFFFUL;
+    r->interval = (int)replay_get(r->data + 12);
+    map_len = replay_get(r->data + 16);
+    if (map_len < 0 || map_len >= WORD_SIZE || 20 + map_len > size)
+    {
+        return ERROR;
+    }
+    memcpy(r->map, r->data + 20, map_len);
+    r->map[map_len] = '\0';
+
+    return OK;
+}
+
+/**
+ * @brief Builds the indexes of commands and keyframes in one pass
+ * 
+ * A record cut at the end of the file and everything after it is ignored.
+ */
+STATUS replay_index(Replay *r)
+{
+    long pos, len, len1, len2;
+    long *aux_pos = NULL;
+    int *aux_turn = NULL;
+    int max_cmds = 0, max_keys = 0;
+    char tag;
+
+    pos = 20 + (long)strlen(r->map);
+    while (pos + 5 <= r->len)
+    {
+        tag = (char)r->data[pos];
+        len = replay_get(r->data + pos + 1);
+        pos += 5;
+        if (len < 0 || pos + len > r->len)
+        {
+            break;
+        }
+
+        if (tag == REPLAY_CMD)
+        {
+            if (len < 12)
+            {
+                break;
+            }
+            len1 = replay_get(r->data + pos + 4);
+            len2 = (len1 >= 0 && 12 + len1 <= len) ? replay_get(r->data + pos + 8 + len1) : -1;
+            if (len1 < 0 || len1 >= MAX_ARG || len2 < 0 || len2 >= MAX_ARG || 12 + len1 + len2 != len)
+            {
+                break;
+            }
+
+            if (r->turns == max_cmds)
+            {
+                max_cmds = max_cmds ? max_cmds * 2 : 64;
+                aux_pos = (long *) realloc(r->cmd_pos, max_cmds * sizeof(long));
+                if (!aux_pos)
+                {
+                    return ERROR;
+                }
+                r->cmd_pos = aux_pos;
+            }
+            r->cmd_pos[r->turns++] = pos;
+        }
+        else if (tag == REPLAY_KEY)
+        {
+            if (len < 4 || replay_get(r->data + pos) != r->turns)
+            {
+                break;
+            }
+
+            if (r->n_keys == max_keys)
+            {
+                max_keys = max_keys ? max_keys * 2 : 16;
+                aux_turn = (int *) realloc(r->key_turn, max_keys * sizeof(int));
+                if (!aux_turn)
+                {
+                    return ERROR;
+                }
+                r->key_turn = aux_turn;
+                aux_pos = (long *) realloc(r->key_pos, max_keys * sizeof(long));
+                if (!aux_pos)
+                {
+                    return ERROR;
+                }
+                r->key_pos = aux_pos;
+                aux_pos = (long *) realloc(r->key_len, max_keys * sizeof(long));
+                if (!aux_pos)
+                {
+                    return ERROR;
+                }
+                r->key_len = aux_pos;
+            }
+            r->key_turn[r->n_keys] = r->turns;
+            r->key_pos[r->n_keys] = pos + 4;
+            r->key_len[r->n_keys] = len - 4;
+            r->n_keys++;
+        }
+
+        pos += len;
+    }
+
+    /* Without the keyframe of turn 0 nothing can be played */
+    if (r->n_keys == 0)
+    {
+        return ERROR;
+    }
+
+    return OK;
+}
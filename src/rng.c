@@ -0,0 +1,237 @@
+/** 
+ * @brief It implements the random number generator of a game
+ * 
+ * The generator is xoshiro128** (Blackman and Vigna), seeded with
+ * splitmix32. Words are kept in unsigned long and masked to 32 bits.
+ * 
+ * @file rng.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026 
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include "../include/rng.h"
+
+#define RNG_MASK 0xFFFFFFFFUL /*!< Keeps the 32 lower bits of a word */
+
+/**
+ * @brief Rng
+ * 
+ * This struct stores the state of a generator and its seed.
+ */
+struct _Rng
+{
+    unsigned long s[RNG_STATE_SIZE]; /*!< State of xoshiro128** */
+    unsigned long seed;              /*!< Seed the generator was started from */
+};
+
+/*Private functions*/
+unsigned long rng_rotl(unsigned long x, int k);
+unsigned long rng_splitmix(unsigned long *x);
+
+/**
+ * rng_create Allocates memory for a new generator
+ */
+Rng *rng_create(unsigned long seed)
+{
+    Rng *rng = NULL;
+
+    rng = (Rng *) malloc(sizeof(Rng));
+    if (!rng)
+    {
+        return NULL;
+    }
+
+    rng_set_seed(rng, seed);
+
+    return rng;
+}
+
+/**
+ * rng_destroy Frees the previously allocated memory for a generator
+ */
+STATUS rng_destroy(Rng *rng)
+{
+    /*Error control*/
+    if (!rng)
+    {
+        return ERROR;
+    }
+
+    free(rng);
+    rng = NULL;
+
+    return OK;
+}
+
+/**
+ * rng_set_seed fills the state from the seed with splitmix32, 
+ * which never gives a state of all zeros
+ */
+STATUS rng_set_seed(Rng *rng, unsigned long seed)
+{
+    unsigned long x;
+    int i;
+
+    /*Error control*/
+    if (!rng)
+    {
+        return ERROR;
+    }
+
+    rng->seed = seed & RNG_MASK;
+    x = rng->seed;
+    for (i = 0; i < RNG_STATE_SIZE; i++)
+    {
+        rng->s[i] = rng_splitmix(&x);
+    }
+
+    return OK;
+}
+
+/**
+ * rng_get_seed returns the seed of the generator
+ */
+unsigned long rng_get_seed(Rng *rng)
+{
+    /*Error control*/
+    if (!rng)
+    {
+        return 0;
+    }
+
+    return rng->seed;
+}
+
+/**
+ * rng_next advances xoshiro128** one step
+ */
+unsigned long rng_next(Rng *rng)
+{
+    unsigned long result, t;
+
+    /*Error control*/
+    if (!rng)
+    {
+        return 0;
+    }
+
+    result = (rng_rotl((rng->s[1] * 5) & RNG_MASK, 7) * 9) & RNG_MASK;
+    t = (rng->s[1] << 9) & RNG_MASK;
+
+    rng->s[2] ^= rng->s[0];
+    rng->s[3] ^= rng->s[1];
+    rng->s[1] ^= rng->s[2];
+    rng->s[0] ^= rng->s[3];
+
+    rng->s[2] ^= t;
+    rng->s[3] = rng_rotl(rng->s[3], 11);
+
+    return result;
+}
+
+/**
+ * rng_range discards the last incomplete block of numbers 
+ * so the modulo has no bias
+ */
+int rng_range(Rng *rng, int max)
+{
+    unsigned long limit, r;
+
+    /*Error control*/
+    if (!rng || max <= 0)
+    {
+        return -1;
+    }
+
+    limit = RNG_MASK - (RNG_MASK % (unsigned long)max + 1) % (unsigned long)max;
+    do
+    {
+        r = rng_next(rng);
+    } while (r > limit);
+
+    return (int)(r % (unsigned long)max);
+}
+
+/**
+ * rng_get_state copies the state of the generator
+ */
+STATUS rng_get_state(Rng *rng, unsigned long state[RNG_STATE_SIZE])
+{
+    int i;
+
+    /*Error control*/
+    if (!rng || !state)
+    {
+        return ERROR;
+    }
+
+    for (i = 0; i < RNG_STATE_SIZE; i++)
+    {
+        state[i] = rng->s[i];
+    }
+
+    return OK;
+}
+
+/**
+ * rng_set_state restores a state copied with rng_get_state
+ */
+STATUS rng_set_state(Rng *rng, const unsigned long state[RNG_STATE_SIZE])
+{
+    unsigned long any = 0;
+    int i;
+
+    /*Error control*/
+    if (!rng || !state)
+    {
+        return ERROR;
+    }
+
+    for (i = 0; i < RNG_STATE_SIZE; i++)
+    {
+        any |= state[i] & RNG_MASK;
+    }
+
+    /* xoshiro never leaves the state of all zeros */
+    if (!any)
+    {
+        return ERROR;
+    }
+
+    for (i = 0; i < RNG_STATE_SIZE; i++)
+    {
+        rng->s[i] = state[i] & RNG_MASK;
+    }
+
+    return OK;
+}
+
+/**
+ * Private functions
+ */
+
+/**
+ * @brief Rotates a 32 bits word to the left
+ */
+unsigned long rng_rotl(unsigned long x, int k)
+{
+    return ((x << k) | (x >> (32 - k))) & RNG_MASK;
+}
+
+/**
+ * @brief Next value of splitmix32, used to fill the state from a seed
+ */
+unsigned long rng_splitmix(unsigned long *x)
+{
+    unsigned long z;
+
+    *x = (*x + 0x9E3779B9UL) & RNG_MASK;
+    z = *x;
+    z = ((z ^ (z >> 16)) * 0x85EBCA6BUL) & RNG_MASK;
+    z = ((z ^ (z >> 13)) * 0xC2B2AE35UL) & RNG_MASK;
+
+    return z ^ (z >> 16);
+}
@@ -0,0 +1,356 @@
+/**
+ * @brief It implements the scripts of commands
+ *
+ * The file is mapped in memory (or read, if it is not a regular file) and
+ * gone through once. Every line becomes an entry with its command and the
+ * position of its arguments in a single buffer of strings, so a script of
+ * millions of lines takes a few bytes per command and no more reads.
+ *
+ * @file script.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/script.h"
+
+#define SCRIPT_LINES 64   /*!< Entries reserved at first, doubled when they run out */
+#define SCRIPT_ARGS 256   /*!< Chars of arguments reserved at first, doubled when they run out */
+#define SCRIPT_READ 4096  /*!< Chars read at once when the file can't be mapped */
+
+/**
+ * @brief Command of a line of a script
+ */
+typedef struct
+{
+  T_Command cmd; /*!< Command */
+  long arg1;     /*!< Position of the first argument in args */
+  long arg2;     /*!< Position of the second argument in args */
+} Script_line;
+
+/**
+ * @brief Script
+ *
+ * This struct stores the commands of a script and their arguments.
+ */
+struct _Script
+{
+  Script_line *lines; /*!< Commands, in the order of the file */
+  long n_lines;       /*!< Number of commands */
+  long max_lines;     /*!< Entries reserved in lines */
+  char *args;         /*!< Arguments one after another, each ended by '\0'. The one at 0 is "" */
+  long n_args;        /*!< Chars used in args */
+  long max_args;      /*!< Chars reserved in args */
+};
+
+/*Private functions*/
+char *script_read(int fd, long *len, BOOL *mapped);
+STATUS script_parse(Script *s, const char *data, long len);
+STATUS script_add(Script *s, T_Command cmd, const char *arg1, const char *arg2);
+long script_add_arg(Script *s, const char *arg);
+
+/**
+ * script_load Loads a script from a file
+ */
+Script *script_load(const char *filename)
+{
+  Script *s = NULL;
+  char *data = NULL;
+  long len = 0;
+  BOOL mapped = FALSE;
+  int fd;
+
+  fd = filename ? open(filename, O_RDONLY) : STDIN_FILENO;
+  /*Error control*/
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  s = (Script *) malloc(sizeof(Script));
+  if (!s)
+  {
+    if (filename)
+    {
+      close(fd);
+    }
+    return NULL;
+  }
+  s->n_lines = 0;
+  s->max_lines = SCRIPT_LINES;
+  s->lines = (Script_line *) malloc(s->max_lines * sizeof(Script_line));
+  s->n_args = 1;
+  s->max_args = SCRIPT_ARGS;
+  s->args = (char *) malloc(s->max_args);
+  if (!s->lines || !s->args)
+  {
+    script_destroy(s);
+    s = NULL;
+  }
+  else
+  {
+    s->args[0] = '\0';
+    data = script_read(fd, &len, &mapped);
+    if (!data || script_parse(s, data, len) == ERROR)
+    {
+      script_destroy(s);
+      s = NULL;
+    }
+  }
+
+  if (mapped == TRUE)
+  {
+    munmap(data, len);
+  }
+  else
+  {
+    free(data);
+  }
+  if (filename)
+  {
+    close(fd);
+  }
+
+  return s;
+}
+
+/**
+ * script_destroy Frees the previously allocated memory for a script
+ */
+STATUS script_destroy(Script *s)
+{
+  /*Error control*/
+  if (!s)
+  {
+    return ERROR;
+  }
+
+  free(s->lines);
+  free(s->args);
+  free(s);
+
+  return OK;
+}
+
+/**
+ * script_get_count Gets the number of commands of a script
+ */
+long script_get_count(Script *s)
+{
+  /*Error control*/
+  if (!s)
+  {
+    return -1;
+  }
+
+  return s->n_lines;
+}
+
+/**
+ * script_get Gets a command of a script
+ */
+T_Command script_get(Script *s, long i, char *arg1, char *arg2)
+{
+  /*Error control*/
+  if (!s || !arg1 || !arg2 || i < 0 || i >= s->n_lines)
+  {
+    return NO_CMD;
+  }
+
+  /* Every argument was cut to MAX_ARG - 1 chars when it was read */
+  strcpy(arg1, s->args + s->lines[i].arg1);
+  strcpy(arg2, s->args + s->lines[i].arg2);
+
+  return s->lines[i].cmd;
+}
+
+/**
+ * @brief Gets the whole content of a file
+ * @author Ignacio Nunez
+ *
+ * A regular file is mapped in memory, anything else (a pipe, a terminal)
+ * is read until its end.
+ * @param fd file descriptor of the file
+ * @param len where the number of chars is returned
+ * @param mapped where it is returned if the content must be freed with munmap (TRUE) or free (FALSE)
+ * @return the content, or NULL if there was any mistake. An empty file gives a valid pointer and len 0.
+ */
+char *script_read(int fd, long *len, BOOL *mapped)
+{
+  struct stat st;
+  char *data = NULL, *aux = NULL;
+  long size = SCRIPT_READ;
+  ssize_t n;
+
+  *len = 0;
+  *mapped = FALSE;
+
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    data = (char *) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED)
+    {
+      posix_madvise(data, st.st_size, POSIX_MADV_SEQUENTIAL);
+      *len = (long)st.st_size;
+      *mapped = TRUE;
+      return data;
+    }
+    data = NULL;
+  }
+
+  data = (char *) malloc(size);
+  if (!data)
+  {
+    return NULL;
+  }
+  while ((n = read(fd, data + *len, size - *len)) > 0)
+  {
+    *len += n;
+    if (*len == size)
+    {
+      size *= 2;
+      aux = (char *) realloc(data, size);
+      if (!aux)
+      {
+        free(data);
+        return NULL;
+      }
+      data = aux;
+    }
+  }
+  if (n < 0)
+  {
+    free(data);
+    return NULL;
+  }
+
+  return data;
+}
+
+/**
+ * @brief Interprets every line of the content of a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to the script
+ * @param data content of the file, it does not need to end in '\0'
+ * @param len number of chars of data
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS script_parse(Script *s, const char *data, long len)
+{
+  char line[WORD_SIZE], arg1[MAX_ARG], arg2[MAX_ARG];
+  const char *end = data + len, *eol = NULL;
+  T_Command cmd;
+  long n;
+
+  while (data < end)
+  {
+    eol = (const char *) memchr(data, '\n', end - data);
+    if (!eol)
+    {
+      eol = end;
+    }
+
+    n = eol - data < WORD_SIZE - 1 ? eol - data : WORD_SIZE - 1;
+    memcpy(line, data, n);
+    line[n] = '\0';
+
+    cmd = command_get_line_input(line, arg1, arg2);
+    if (cmd != NO_CMD && script_add(s, cmd, arg1, arg2) == ERROR)
+    {
+      return ERROR;
+    }
+
+    data = eol < end ? eol + 1 : end;
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Adds a command at the end of a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to the script
+ * @param cmd command
+ * @param arg1 first argument, "" if it has none
+ * @param arg2 second argument, "" if it has none
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS script_add(Script *s, T_Command cmd, const char *arg1, const char *arg2)
+{
+  Script_line *aux = NULL;
+  long pos1, pos2;
+
+  if (s->n_lines == s->max_lines)
+  {
+    aux = (Script_line *) realloc(s->lines, 2 * s->max_lines * sizeof(Script_line));
+    if (!aux)
+    {
+      return ERROR;
+    }
+    s->lines = aux;
+    s->max_lines *= 2;
+  }
+
+  pos1 = script_add_arg(s, arg1);
+  pos2 = script_add_arg(s, arg2);
+  if (pos1 < 0 || pos2 < 0)
+  {
+    return ERROR;
+  }
+
+  s->lines[s->n_lines].cmd = cmd;
+  s->lines[s->n_lines].arg1 = pos1;
+  s->lines[s->n_lines].arg2 = pos2;
+  s->n_lines++;
+
+  return OK;
+}
+
+/**
+ * @brief Copies an argument at the end of the arguments of a script
+ * @author Ignacio Nunez
+ *
+ * @param s a pointer to the script
+ * @param arg argument
+ * @return its position in args (0 if it is ""), or -1 if there was any mistake
+ */
+long script_add_arg(Script *s, const char *arg)
+{
+  char *aux = NULL;
+  long len, pos;
+
+  len = (long)strlen(arg);
+  if (len == 0)
+  {
+    return 0;
+  }
+
+  while (s->n_args + len + 1 > s->max_args)
+  {
+    aux = (char *) realloc(s->args, 2 * s->max_args);
+    if (!aux)
+    {
+      return -1;
+    }
+    s->args = aux;
+    s->max_args *= 2;
+  }
+
+  pos = s->n_args;
+  memcpy(s->args + pos, arg, len + 1);
+  s->n_args += len + 1;
+
+  return pos;
+}
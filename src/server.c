@@ -0,0 +1,571 @@
+/**
+ * @brief It defines a headless multi-session game server
+ *
+ * Every client connected to the local unix socket plays its own game. Clients
+ * send one command per line (same syntax as the terminal version) and receive
+ * one reply line per command:
+ *
+ *   <OK|ERROR|-->|<command>|<player location>|<player health>|<dialogue>|<event>
+ *
+ * All the sessions are served by a single epoll loop, so no process or thread
+ * is needed per player.
+ *
+ * @file server.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers and Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../include/game.h"
+#include "../include/command.h"
+#include "../include/game_managment.h"
+
+#define SERVER_SOCKET "/tmp/juego.sock" /*!< Default path of the server socket */
+#define SERVER_EVENTS 64                /*!< Maximun of epoll events handled per wait */
+#define SERVER_LINE 256                 /*!< Maximun length of a command line sent by a client */
+#define SERVER_OUT 8192                 /*!< Maximun of reply bytes pending to be sent to a client */
+#define SERVER_REPLY (3 * WORD_SIZE)     /*!< Longest reply to a command line */
+
+/**
+ * @brief Session
+ *
+ * This struct stores the connection and the game of a client.
+ */
+typedef struct _Session
+{
+  int fd;                  /*!< Socket of the client */
+  Game *game;              /*!< Game played by the client */
+  char in[SERVER_LINE];    /*!< Bytes received that are not a whole line yet */
+  int in_len;              /*!< Number of bytes in in */
+  char pend[SERVER_LINE];  /*!< Bytes read from the socket */
+  int pend_pos;            /*!< First byte of pend not looked at yet */
+  int pend_len;            /*!< Number of bytes in pend */
+  BOOL discard;            /*!< TRUE while skipping a line that was too long */
+  char out[SERVER_OUT];    /*!< Reply bytes pending to be sent */
+  int out_len;             /*!< Number of bytes in out */
+  BOOL closing;            /*!< TRUE if the session must be closed once out is sent */
+  BOOL waiting_out;        /*!< TRUE while epoll is waiting for the socket to be writable */
+} Session;
+
+static volatile sig_atomic_t server_running = 1; /*!< Cleared by SIGINT/SIGTERM to stop the loop */
+
+/**
+ * Private functions
+ */
+void server_stop(int sig);
+int server_listen(char *path);
+int server_set_nonblock(int fd);
+Session *server_session_create(int fd, char *map);
+void server_session_destroy(int epfd, Session *s);
+void server_accept(int epfd, int lfd, char *map);
+BOOL server_read(int epfd, Session *s);
+BOOL server_flush(int epfd, Session *s);
+void server_execute(Session *s, char *line);
+void server_reply(Session *s, char *str);
+void print_syntaxinfo(char *argv[]);
+
+/**
+ * @brief Main function of the server
+ * @author Miguel Soto
+ *
+ * @param argc number of arguments
+ * @param argv arguments: the data file and optionally "-u <socket_path>"
+ * @return 0 if the server stops correctly, 1 if there was an error
+ */
+int main(int argc, char *argv[])
+{
+  struct epoll_event ev, events[SERVER_EVENTS];
+  char *path = SERVER_SOCKET;
+  Game *game = NULL;
+  Session *s = NULL;
+  int epfd = -1, lfd = -1, n, i;
+  BOOL alive;
+
+  if (argc != 2 && !(argc == 4 && strcmp(argv[2], "-u") == 0))
+  {
+    print_syntaxinfo(argv);
+    return 1;
+  }
+  if (argc == 4)
+  {
+    path = argv[3];
+  }
+
+  /* Check the data file before accepting any player */
+  game = game_alloc2();
+  if (!game || game_create_from_file(game, argv[1]) == ERROR)
+  {
+    fprintf(stderr, "Error while loading %s.\n", argv[1]);
+    game_destroy(game);
+    return 1;
+  }
+  game_destroy(game);
+
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT, server_stop);
+  signal(SIGTERM, server_stop);
+
+  lfd = server_listen(path);
+  if (lfd < 0)
+  {
+    return 1;
+  }
+
+  epfd = epoll_create1(0);
+  if (epfd < 0)
+  {
+    perror("epoll_create1");
+    close(lfd);
+    unlink(path);
+    return 1;
+  }
+
+  ev.events = EPOLLIN;
+  ev.data.ptr = NULL;
+  epoll_ctl(epfd, EPOLL_CTL_ADD, lfd, &ev);
+
+  fprintf(stdout, "Server listening on %s\n", path);
+
+  while (server_running)
+  {
+    n = epoll_wait(epfd, events, SERVER_EVENTS, -1);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      perror("epoll_wait");
+      break;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+      s = (Session *)events[i].data.ptr;
+
+      /* The listening socket is the only one without session */
+      if (s == NULL)
+      {
+        server_accept(epfd, lfd, argv[1]);
+        continue;
+      }
+
+      if (events[i].events & (EPOLLERR | EPOLLHUP))
+      {
+        server_session_destroy(epfd, s);
+        continue;
+      }
+
+      /* Lines left waiting for room in out are run once the replies before them are sent */
+      alive = TRUE;
+      do
+      {
+        if (server_read(epfd, s) == FALSE || server_flush(epfd, s) == FALSE)
+        {
+          alive = FALSE;
+        }
+      } while (alive == TRUE && s->out_len == 0 && s->pend_pos < s->pend_len && s->closing == FALSE);
+
+      if (alive == FALSE || (s->closing == TRUE && s->out_len == 0))
+      {
+        server_session_destroy(epfd, s);
+      }
+    }
+  }
+
+  /* Sessions still open are released by the operating system */
+  close(epfd);
+  close(lfd);
+  unlink(path);
+
+  fprintf(stdout, "Server stopped\n");
+
+  return 0;
+}
+
+/**
+ * @brief Signal handler that stops the server loop
+ * @author Miguel Soto
+ *
+ * @param sig signal received
+ */
+void server_stop(int sig)
+{
+  server_running = 0;
+}
+
+/**
+ * @brief Creates the listening unix socket
+ * @author Miguel Soto
+ *
+ * @param path path of the socket file (it is replaced if it already exists)
+ * @return the socket file descriptor or -1 if there was an error
+ */
+int server_listen(char *path)
+{
+  struct sockaddr_un addr;
+  int fd;
+
+  if (strlen(path) >= sizeof(addr.sun_path))
+  {
+    fprintf(stderr, "Socket path too long: %s\n", path);
+    return -1;
+  }
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+  {
+    perror("socket");
+    return -1;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+  unlink(path);
+
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0 || server_set_nonblock(fd) < 0)
+  {
+    perror("bind/listen");
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+/**
+ * @brief Makes a file descriptor non blocking
+ * @author Miguel Soto
+ *
+ * @param fd file descriptor
+ * @return 0 if everything goes well or -1 if there was an error
+ */
+int server_set_nonblock(int fd)
+{
+  int flags = fcntl(fd, F_GETFL, 0);
+
+  if (flags < 0)
+  {
+    return -1;
+  }
+
+  return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/**
+ * @brief Creates a session with a new game for a client
+ * @author Miguel Soto
+ *
+ * @param fd socket of the client
+ * @param map data file the game is loaded from
+ * @return the new session or NULL if there was an error
+ */
+Session *server_session_create(int fd, char *map)
+{
+  Session *s = NULL;
+
+  s = (Session *)malloc(sizeof(Session));
+  if (!s)
+  {
+    return NULL;
+  }
+
+  s->game = game_alloc2();
+  if (!s->game || game_create_from_file(s->game, map) == ERROR)
+  {
+    game_destroy(s->game);
+    free(s);
+    return NULL;
+  }
+
+  s->fd = fd;
+  s->in_len = 0;
+  s->discard = FALSE;
+  s->out_len = 0;
+  s->pend_pos = 0;
+  s->pend_len = 0;
+  s->closing = FALSE;
+  s->waiting_out = FALSE;
+
+  return s;
+}
+
+/**
+ * @brief Closes the connection of a session and frees it
+ * @author Miguel Soto
+ *
+ * @param epfd epoll file descriptor
+ * @param s session to destroy
+ */
+void server_session_destroy(int epfd, Session *s)
+{
+  if (!s)
+  {
+    return;
+  }
+
+  epoll_ctl(epfd, EPOLL_CTL_DEL, s->fd, NULL);
+  close(s->fd);
+  game_destroy(s->game);
+  free(s);
+}
+
+/**
+ * @brief Accepts every pending connection
+ * @author Miguel Soto
+ *
+ * @param epfd epoll file descriptor
+ * @param lfd listening socket
+ * @param map data file the games are loaded from
+ */
+void server_accept(int epfd, int lfd, char *map)
+{
+  struct epoll_event ev;
+  Session *s = NULL;
+  int fd;
+
+  while ((fd = accept(lfd, NULL, NULL)) >= 0)
+  {
+    if (server_set_nonblock(fd) < 0 || (s = server_session_create(fd, map)) == NULL)
+    {
+      close(fd);
+      continue;
+    }
+
+    ev.events = EPOLLIN;
+    ev.data.ptr = s;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+      close(fd);
+      game_destroy(s->game);
+      free(s);
+    }
+  }
+}
+
+/**
+ * @brief Reads what the client has sent and executes every whole line
+ * @author Miguel Soto
+ *
+ * A line is only executed if its reply is sure to fit in out. Otherwise
+ * the bytes left stay in pend, nothing more is read and the client has
+ * to read its replies first, so pipelining many commands never drops any.
+ * When the client closes its side, the session is closed once the replies
+ * are sent.
+ *
+ * @param epfd epoll file descriptor
+ * @param s session of the client
+ * @return FALSE if the connection must be closed, TRUE otherwise
+ */
+BOOL server_read(int epfd, Session *s)
+{
+  char c;
+  int n;
+
+  for (;;)
+  {
+    while (s->pend_pos < s->pend_len && s->closing == FALSE && s->out_len + SERVER_REPLY <= SERVER_OUT)
+    {
+      c = s->pend[s->pend_pos++];
+      if (c == '\n')
+      {
+        if (s->discard == TRUE)
+        {
+          server_reply(s, "ERROR|Unknown|-1|-1|Line too long|\n");
+        }
+        else
+        {
+          s->in[s->in_len] = '\0';
+          server_execute(s, s->in);
+        }
+        s->in_len = 0;
+        s->discard = FALSE;
+      }
+      else if (s->in_len < SERVER_LINE - 1)
+      {
+        s->in[s->in_len++] = c;
+      }
+      else
+      {
+        s->discard = TRUE;
+      }
+    }
+
+    if (s->pend_pos < s->pend_len || s->closing == TRUE)
+    {
+      return TRUE;
+    }
+
+    n = read(s->fd, s->pend, SERVER_LINE);
+    if (n == 0)
+    {
+      s->closing = TRUE;
+      return TRUE;
+    }
+    if (n < 0)
+    {
+      return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? TRUE : FALSE;
+    }
+    s->pend_pos = 0;
+    s->pend_len = n;
+  }
+}
+
+/**
+ * @brief Sends pending replies and updates the epoll interest of the session
+ * @author Miguel Soto
+ *
+ * @param epfd epoll file descriptor
+ * @param s session of the client
+ * @return FALSE if the connection must be closed, TRUE otherwise
+ */
+BOOL server_flush(int epfd, Session *s)
+{
+  struct epoll_event ev;
+  int n;
+
+  while (s->out_len > 0)
+  {
+    n = send(s->fd, s->out, s->out_len, MSG_NOSIGNAL);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        return FALSE;
+      }
+      break;
+    }
+    memmove(s->out, s->out + n, s->out_len - n);
+    s->out_len -= n;
+  }
+
+  /* Only wait for EPOLLOUT (and stop reading) while there is something left to send */
+  if ((s->out_len > 0) != (s->waiting_out == TRUE))
+  {
+    s->waiting_out = (s->out_len > 0) ? TRUE : FALSE;
+    ev.events = (s->waiting_out == TRUE) ? EPOLLOUT : EPOLLIN;
+    ev.data.ptr = s;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, s->fd, &ev);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Executes a command line in the game of a session and queues the reply
+ * @author Miguel Soto
+ *
+ * @param s session of the client
+ * @param line command line received
+ */
+void server_execute(Session *s, char *line)
+{
+  char arg1[MAX_ARG], arg2[MAX_ARG], reply[SERVER_REPLY];
+  char *dialogue = NULL, *status = NULL;
+  const char *event = NULL;
+  T_Command cmd = NO_CMD;
+  Id player = NO_ID;
+  int st;
+
+  cmd = command_get_line_input(line, arg1, arg2);
+  if (cmd == NO_CMD)
+  {
+    return;
+  }
+
+  /* Saved games are shared files, so they are not allowed in the server */
+  if (cmd == SAVE || cmd == LOAD)
+  {
+    sprintf(reply, "ERROR|%s|-1|-1|Not available in server mode|\n", command_get_name(cmd, CMDL));
+    server_reply(s, reply);
+    return;
+  }
+
+  st = game_update(s->game, cmd, arg1, arg2);
+
+  if (st == 0)
+  {
+    status = "ERROR";
+  }
+  else if (st == 1)
+  {
+    status = "OK";
+  }
+  else
+  {
+    status = "--";
+  }
+
+  dialogue = dialogue_get_error(game_get_dialogue(s->game));
+  if (dialogue == NULL || strcmp(dialogue, " ") == 0)
+  {
+    dialogue = dialogue_get_command(game_get_dialogue(s->game));
+  }
+  event = dialogue_get_event(game_get_dialogue(s->game));
+  player = game_get_player_id(s->game);
+
+  sprintf(reply, "%s|%s|%ld|%d|%.900s|%.900s\n", status, command_get_name(cmd, CMDL), game_get_player_location(s->game, player),
+          player_get_health(game_get_player(s->game, player)), dialogue ? dialogue : "", event ? event : "");
+  server_reply(s, reply);
+
+  if (cmd == EXIT)
+  {
+    s->closing = TRUE;
+  }
+}
+
+/**
+ * @brief Queues a reply for a client
+ * @author Miguel Soto
+ *
+ * server_read only runs a line while its reply fits, so the session is
+ * closed here only if a reply is longer than SERVER_REPLY.
+ *
+ * @param s session of the client
+ * @param str reply to send
+ */
+void server_reply(Session *s, char *str)
+{
+  int len = strlen(str);
+
+  if (s->out_len + len > SERVER_OUT)
+  {
+    s->out_len = 0;
+    s->closing = TRUE;
+    return;
+  }
+
+  memcpy(s->out + s->out_len, str, len);
+  s->out_len += len;
+}
+
+/**
+ * @brief Prints syntax info when running the server.
+ * @author Miguel Soto
+ *
+ * @param argv Arguments from the command used to execute program.
+ */
+void print_syntaxinfo(char *argv[])
+{
+  fprintf(stderr, "\nUse: %s <game_data_file> [-u <socket_path>]\n", argv[0]);
+  fprintf(stderr, "\tBy default the server listens on %s\n", SERVER_SOCKET);
+  fprintf(stderr, "\tEvery client plays its own game sending one command per line.\n \n");
+}
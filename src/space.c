@@ -33,12 +33,16 @@ struct _Space
   Light ls;                          /*!< Status of light (Brief for Light Status) */
   Floor floor;                       /*!< Floor level of the space*/
   BOOL fire;                         /*!< If TRUE, torches can be turnon. If FALSE, torches cannot illuminate*/
+  BOOL light_fixed;                  /*!< If TRUE, day and night do not change its light */
+  int light_sources;                 /*!< Lit objects in it, they light it by night */
+  unsigned long *epoch;              /*!< Change counter of the game it belongs to, NULL if none */
 } ;
 
 /**
  * Private functions
  */
 int _dir2i(DIRECTION dir);
+void space_touch(Space *space);
 
 /**
  * @brief Given a direction returns position of links array
@@ -121,6 +125,10 @@ Space *space_create(Id id)
   newSpace->ls = UNKNOWN_LIGHT;
   newSpace->floor = UNKNOWN_FLOOR;
   newSpace->fire = FALSE;
+  newSpace->light_fixed = FALSE;
+  newSpace->light_sources = 0;
+
+  newSpace->epoch = NULL;
 
   return newSpace;
 }
@@ -223,6 +231,7 @@ STATUS space_set_name(Space *space, char *name)
   {
     strcpy(space->name, name);
   }
+  space_touch(space);
   return OK;
 }
 
@@ -266,6 +275,7 @@ STATUS space_set_brief_description(Space *space, char *brief_description)
     return ERROR;
   }
 
+  space_touch(space);
   return OK;
 }
 
@@ -298,6 +308,7 @@ STATUS space_set_long_description(Space *space, char *long_description)
     return ERROR;
   }
 
+  space_touch(space);
   return OK;
 }
 
@@ -319,6 +330,7 @@ STATUS space_set_link(Space *space, Id link, DIRECTION dir)
   }
 
   space->link[n] = link;
+  space_touch(space);
   return OK;
 }
 
@@ -358,6 +370,7 @@ STATUS space_add_objectid(Space *s, Id id)
     return ERROR;
   }
 
+  space_touch(s);
   return OK;
 }
 
@@ -377,6 +390,7 @@ STATUS space_del_objectid(Space *s, Id id)
     return ERROR;
   }
 
+  space_touch(s);
   return OK;
 }
 
@@ -508,6 +522,7 @@ STATUS space_set_gdesc(Space *s, char **newgdesc)
 
   s->gdesc = newgdesc;
 
+  space_touch(s);
   return OK;
 }
 
@@ -655,6 +670,7 @@ STATUS space_set_light_status (Space *space, Light ls)
     space->ls = BRIGHT;
   }
 
+  space_touch(space);
   return OK;
 }
 
@@ -719,6 +735,7 @@ STATUS space_set_floor(Space* space, Floor floor)
   }
 
   space->floor = floor;
+  space_touch(space);
   return OK;
 }
 
@@ -746,5 +763,89 @@ STATUS space_set_fire(Space *s, BOOL fire)
   }
   
   s->fire = fire;
+  space_touch(s);
+  return OK;
+}
+
+/** space_set_light_fixed sets if day and night change the light of the space
+ */
+STATUS space_set_light_fixed(Space *s, BOOL fixed)
+{
+  /* Error control */
+  if (!s || (fixed != TRUE && fixed != FALSE))
+  {
+    return ERROR;
+  }
+
+  s->light_fixed = fixed;
+  space_touch(s);
+  return OK;
+}
+
+/** space_get_light_fixed gets if day and night change the light of the space
+ */
+BOOL space_get_light_fixed(Space *s)
+{
+  if (!s)
+  {
+    return FALSE;
+  }
+
+  return s->light_fixed;
+}
+
+/** space_set_light_sources sets the number of lit objects in the space
+ */
+STATUS space_set_light_sources(Space *s, int n)
+{
+  /* Error control */
+  if (!s || n < 0)
+  {
+    return ERROR;
+  }
+
+  s->light_sources = n;
+  space_touch(s);
   return OK;
 }
+
+/** space_get_light_sources gets the number of lit objects in the space
+ */
+int space_get_light_sources(Space *s)
+{
+  if (!s)
+  {
+    return -1;
+  }
+
+  return s->light_sources;
+}
+
+/** space_set_epoch sets the change counter the space bumps when it is modified
+ */
+STATUS space_set_epoch(Space *space, unsigned long *epoch)
+{
+  /* Error control */
+  if (!space)
+  {
+    return ERROR;
+  }
+
+  space->epoch = epoch;
+
+  return OK;
+}
+
+/**
+ * @brief Tells the game that a space changed
+ * @author Ignacio Nunez
+ *
+ * @param space pointer to the space
+ */
+void space_touch(Space *space)
+{
+  if (space->epoch)
+  {
+    (*space->epoch)++;
+  }
+}
@@ -0,0 +1,302 @@
+/**
+ * @brief It implements the cache of pre-rendered room tiles of the map
+ *
+ * The cache is direct mapped: a tile goes to the entry given by its space
+ * and kind, and is rendered again only when its key changes.
+ *
+ * @file tile.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tile.h"
+
+#define TILE_CACHE_SIZE 64 /*!< Number of entries of a cache */
+
+/**
+ * @brief Kinds of tiles
+ */
+typedef enum
+{
+  T_CENTRE, /*!< Space of the player */
+  T_SIDE,   /*!< Space to the east or west */
+  T_NORTH,  /*!< Space to the north, without its top border */
+  T_SOUTH   /*!< Space to the south, without its bottom border */
+} Tile_kind;
+
+/**
+ * @brief Everything a tile depends on
+ */
+typedef struct
+{
+  Id id;                                              /*!< Id of the space */
+  Tile_kind kind;                                     /*!< Kind of tile */
+  Light light;                                        /*!< Light status of the space */
+  BOOL object;                                        /*!< TRUE if the object marker is shown */
+  BOOL hidden;                                        /*!< TRUE if the space is hidden */
+  BOOL enemy;                                         /*!< TRUE if an enemy is drawn */
+  char sprite[ENEMY_GDESC_Y][ENEMY_GDESC_X + 1];      /*!< Graphic description of that enemy */
+} Tile_key;
+
+/**
+ * @brief Tile
+ *
+ * This struct stores a rendered box and the key it was rendered from.
+ */
+struct _Tile
+{
+  Tile_key key;                         /*!< What the tile shows */
+  BOOL valid;                           /*!< FALSE if the entry is empty */
+  int n_rows;                           /*!< Number of rows */
+  char rows[TILE_ROWS][TILE_LEN + 1];   /*!< Text of the rows */
+};
+
+/**
+ * @brief Tile_cache
+ *
+ * This struct stores the tiles of a cache.
+ */
+struct _Tile_cache
+{
+  Tile tiles[TILE_CACHE_SIZE]; /*!< Entries of the cache */
+  long misses;                 /*!< Tiles rendered */
+};
+
+/*Private functions*/
+void tile_render(Tile *tile, const View_space *vs);
+void tile_key(Tile_key *key, const View *view, View_slot slot);
+
+/**
+ * tile_cache_create Allocates memory for a new, empty cache
+ */
+Tile_cache *tile_cache_create()
+{
+  Tile_cache *tc = NULL;
+
+  tc = (Tile_cache *) malloc(sizeof(Tile_cache));
+  if (!tc)
+  {
+    return NULL;
+  }
+
+  tile_cache_clear(tc);
+  tc->misses = 0;
+
+  return tc;
+}
+
+/**
+ * tile_cache_destroy Frees the previously allocated memory for a cache
+ */
+STATUS tile_cache_destroy(Tile_cache *tc)
+{
+  /*Error control*/
+  if (!tc)
+  {
+    return ERROR;
+  }
+
+  free(tc);
+
+  return OK;
+}
+
+/**
+ * tile_cache_clear Drops every tile of a cache
+ */
+STATUS tile_cache_clear(Tile_cache *tc)
+{
+  int i;
+
+  /*Error control*/
+  if (!tc)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < TILE_CACHE_SIZE; i++)
+  {
+    tc->tiles[i].valid = FALSE;
+  }
+
+  return OK;
+}
+
+/**
+ * tile_cache_get Gets the tile of a space of a view
+ */
+const Tile *tile_cache_get(Tile_cache *tc, const View *view, View_slot slot)
+{
+  Tile_key key;
+  Tile *tile = NULL;
+
+  /*Error control*/
+  if (!tc || !view || slot < V_ACT || slot >= V_SPACES || view->space[slot].id == NO_ID)
+  {
+    return NULL;
+  }
+
+  tile_key(&key, view, slot);
+  tile = &tc->tiles[((unsigned long)key.id * 4 + key.kind) % TILE_CACHE_SIZE];
+  if (tile->valid == TRUE && memcmp(&tile->key, &key, sizeof(Tile_key)) == 0)
+  {
+    return tile;
+  }
+
+  tile->key = key;
+  tile->valid = TRUE;
+  tile_render(tile, &view->space[slot]);
+  tc->misses++;
+
+  return tile;
+}
+
+/**
+ * tile_cache_get_misses Gets how many tiles a cache has rendered
+ */
+long tile_cache_get_misses(Tile_cache *tc)
+{
+  /*Error control*/
+  if (!tc)
+  {
+    return -1;
+  }
+
+  return tc->misses;
+}
+
+/**
+ * tile_get_rows Gets the number of rows of a tile
+ */
+int tile_get_rows(const Tile *tile)
+{
+  /*Error control*/
+  if (!tile)
+  {
+    return 0;
+  }
+
+  return tile->n_rows;
+}
+
+/**
+ * tile_get_row Gets a row of a tile
+ */
+const char *tile_get_row(const Tile *tile, int row)
+{
+  /*Error control*/
+  if (!tile || row < 0 || row >= tile->n_rows)
+  {
+    return NULL;
+  }
+
+  return tile->rows[row];
+}
+
+/**
+ * @brief Fills the key of the tile of a space of a view
+ * @author Ignacio Nunez
+ *
+ * Only the current space shows the player and the enemy in it.
+ * @param key pointer to the key to fill
+ * @param view pointer to the view
+ * @param slot which space of the view
+ */
+void tile_key(Tile_key *key, const View *view, View_slot slot)
+{
+  int i;
+
+  memset(key, 0, sizeof(Tile_key));
+  key->id = view->space[slot].id;
+  key->light = view->space[slot].light;
+  key->object = view->space[slot].object;
+  key->hidden = view->space[slot].hidden;
+
+  if (slot == V_ACT)
+  {
+    key->kind = T_CENTRE;
+    key->enemy = view->enemy_here;
+    if (key->enemy == TRUE)
+    {
+      for (i = 0; i < ENEMY_GDESC_Y; i++)
+      {
+        strcpy(key->sprite[i], view->enemy_gdesc[i]);
+      }
+    }
+  }
+  else if (slot == V_NORTH)
+  {
+    key->kind = T_NORTH;
+  }
+  else if (slot == V_SOUTH)
+  {
+    key->kind = T_SOUTH;
+  }
+  else
+  {
+    key->kind = T_SIDE;
+  }
+}
+
+/**
+ * @brief Renders the box of a space
+ * @author Ignacio Nunez
+ *
+ * @param tile pointer to the tile, its key already set
+ * @param vs pointer to the space of the view
+ */
+void tile_render(Tile *tile, const View_space *vs)
+{
+  const char *border = "+-----------------+", *blank = "|                 |";
+  char obj = ' ';
+  int i, n = 0;
+
+  obj = tile->key.object == TRUE ? '*' : ' ';
+
+  if (tile->key.kind != T_NORTH)
+  {
+    strcpy(tile->rows[n++], border);
+  }
+  sprintf(tile->rows[n++], "| %.*s |", TILE_LEN - 4, vs->name);
+
+  if (tile->key.kind == T_NORTH || tile->key.kind == T_SOUTH)
+  {
+    strcpy(tile->rows[n++], blank);
+    sprintf(tile->rows[n++], "|        %c        |", obj);
+    strcpy(tile->rows[n++], blank);
+    if (tile->key.kind == T_NORTH)
+    {
+      strcpy(tile->rows[n++], border);
+    }
+    tile->n_rows = n;
+    return;
+  }
+
+  strcpy(tile->rows[n++], tile->key.kind == T_CENTRE ? "|           gpp0^ |" : blank);
+  strcpy(tile->rows[n++], blank);
+  for (i = 0; i < TAM_GDESC_Y; i++)
+  {
+    if (tile->key.enemy == TRUE && i < ENEMY_GDESC_Y)
+    {
+      sprintf(tile->rows[n++], "| %s %s|", tile->key.sprite[i], vs->gdesc[i]);
+    }
+    else if (tile->key.enemy == TRUE)
+    {
+      sprintf(tile->rows[n++], "|        %s|", vs->gdesc[i]);
+    }
+    else
+    {
+      sprintf(tile->rows[n++], "|    %s    |", vs->gdesc[i]);
+    }
+  }
+  strcpy(tile->rows[n++], blank);
+  sprintf(tile->rows[n++], "|        %c        |", obj);
+  strcpy(tile->rows[n++], border);
+
+  tile->n_rows = n;
+}
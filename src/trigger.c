@@ -0,0 +1,254 @@
+/**
+ * @brief It implements the triggers of a map
+ *
+ * @file trigger.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include "../include/trigger.h"
+
+#define N_TRIGGER_TYPES 3 /*!< Number of types of trigger */
+
+/**
+ * @brief Name of each type of trigger in the map file
+ */
+static const char *const trigger_names[N_TRIGGER_TYPES] = {"death", "broken", "light"};
+
+/**
+ * @brief Triggers
+ *
+ * This struct stores the triggers of a map, in the order they were added.
+ */
+struct _Triggers
+{
+  int count;                     /*!< Number of triggers */
+  T_Trigger type[MAX_TRIGGERS];  /*!< What each trigger is run on */
+  Id subject[MAX_TRIGGERS];      /*!< Element each trigger is run for */
+  Id object[MAX_TRIGGERS];       /*!< Object each trigger drops */
+  Id space[MAX_TRIGGERS];        /*!< Space each trigger drops its object in */
+};
+
+/**
+ * trigger_create Allocates memory for a new, empty set of triggers
+ */
+Triggers *trigger_create()
+{
+  Triggers *t = NULL;
+
+  t = (Triggers *) malloc(sizeof(Triggers));
+  if (!t)
+  {
+    return NULL;
+  }
+
+  t->count = 0;
+
+  return t;
+}
+
+/**
+ * trigger_destroy Frees the previously allocated memory for some triggers
+ */
+STATUS trigger_destroy(Triggers *t)
+{
+  /*Error control*/
+  if (!t)
+  {
+    return ERROR;
+  }
+
+  free(t);
+
+  return OK;
+}
+
+/**
+ * trigger_add Adds a trigger
+ */
+STATUS trigger_add(Triggers *t, T_Trigger type, Id subject, Id object, Id space)
+{
+  /*Error control*/
+  if (!t || t->count == MAX_TRIGGERS || subject == NO_ID)
+  {
+    return ERROR;
+  }
+
+  /*Only deaths drop objects*/
+  if ((type == T_DEATH) != (object != NO_ID && space != NO_ID))
+  {
+    return ERROR;
+  }
+  if (type != T_DEATH && type != T_BROKEN && type != T_LIGHT)
+  {
+    return ERROR;
+  }
+
+  t->type[t->count] = type;
+  t->subject[t->count] = subject;
+  t->object[t->count] = object;
+  t->space[t->count] = space;
+  t->count++;
+
+  return OK;
+}
+
+/**
+ * trigger_get_count Gets the number of triggers
+ */
+int trigger_get_count(Triggers *t)
+{
+  /*Error control*/
+  if (!t)
+  {
+    return -1;
+  }
+
+  return t->count;
+}
+
+/**
+ * trigger_find Finds the next trigger of an element
+ */
+int trigger_find(Triggers *t, T_Trigger type, Id subject, int from)
+{
+  int i;
+
+  /*Error control*/
+  if (!t || from < 0)
+  {
+    return -1;
+  }
+
+  for (i = from; i < t->count; i++)
+  {
+    if ((type == T_NONE || t->type[i] == type) && (subject == NO_ID || t->subject[i] == subject))
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * trigger_get_type Gets what a trigger is run on
+ */
+T_Trigger trigger_get_type(Triggers *t, int i)
+{
+  /*Error control*/
+  if (!t || i < 0 || i >= t->count)
+  {
+    return T_NONE;
+  }
+
+  return t->type[i];
+}
+
+/**
+ * trigger_get_subject Gets the element a trigger is run for
+ */
+Id trigger_get_subject(Triggers *t, int i)
+{
+  /*Error control*/
+  if (!t || i < 0 || i >= t->count)
+  {
+    return NO_ID;
+  }
+
+  return t->subject[i];
+}
+
+/**
+ * trigger_get_object Gets the object a trigger drops
+ */
+Id trigger_get_object(Triggers *t, int i)
+{
+  /*Error control*/
+  if (!t || i < 0 || i >= t->count)
+  {
+    return NO_ID;
+  }
+
+  return t->object[i];
+}
+
+/**
+ * trigger_get_space Gets the space a trigger drops its object in
+ */
+Id trigger_get_space(Triggers *t, int i)
+{
+  /*Error control*/
+  if (!t || i < 0 || i >= t->count)
+  {
+    return NO_ID;
+  }
+
+  return t->space[i];
+}
+
+/**
+ * trigger_get_type_byName Gets what a trigger is run on by its name in the map file
+ */
+T_Trigger trigger_get_type_byName(char *name)
+{
+  int i;
+
+  /*Error control*/
+  if (!name)
+  {
+    return T_NONE;
+  }
+
+  for (i = 0; i < N_TRIGGER_TYPES; i++)
+  {
+    if (strcasecmp(name, trigger_names[i]) == 0)
+    {
+      return (T_Trigger) i;
+    }
+  }
+
+  return T_NONE;
+}
+
+/**
+ * trigger_print_save Prints the triggers in the save file
+ */
+STATUS trigger_print_save(char *filename, Triggers *t)
+{
+  FILE *file = NULL;
+  int i;
+
+  /*Error control*/
+  if (!filename || !t)
+  {
+    return ERROR;
+  }
+
+  file = fopen(filename, "a");
+  if (!file)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < t->count; i++)
+  {
+    if (t->type[i] == T_DEATH)
+    {
+      fprintf(file, "#t:%s|%ld|%ld|%ld|\n", trigger_names[t->type[i]], t->subject[i], t->object[i], t->space[i]);
+    }
+    else
+    {
+      fprintf(file, "#t:%s|%ld|\n", trigger_names[t->type[i]], t->subject[i]);
+    }
+  }
+
+  fclose(file);
+
+  return OK;
+}
@@ -0,0 +1,404 @@
+/**
+ * @brief It implements the view of a game
+ *
+ * Everything the graphic engine shows is looked up here once per turn
+ * and copied into a View.
+ *
+ * @file view_model.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "../include/view_model.h"
+#include "../include/inventory.h"
+#include "../include/set.h"
+
+#define VIEW_PLAYER 21 /*!< Id of the player shown */
+#define VIEW_BOSS 45   /*!< Id of the enemy that ends the game when killed */
+
+/*Private functions*/
+void view_model_copy(char *dest, const char *src, int max);
+BOOL view_model_has_object(Game *game, Space *space);
+void view_model_build_space(View_space *vs, Game *game, Space *space, BOOL hidden);
+void view_model_build_floor(View *view, Game *game);
+int view_model_build_log(char lines[][VIEW_LOG_LEN + 1], Dialogue *dialogue, BOOL events);
+
+/**
+ * view_model_build Builds the view of a game
+ */
+STATUS view_model_build(View *view, Game *game, int st)
+{
+  Space *act = NULL, *space = NULL;
+  Player *player = NULL;
+  Enemy *enemy = NULL;
+  Object *obj = NULL;
+  Link *link = NULL;
+  Set *set = NULL;
+  Inventory *inventory = NULL;
+  Id id = NO_ID;
+  char **gdesc = NULL;
+  int i, n;
+
+  /* Error control */
+  if (!view || !game)
+  {
+    return ERROR;
+  }
+
+  memset(view, 0, sizeof(View));
+  view->time = game_get_time(game);
+
+  /* Player */
+  player = game_get_player(game, VIEW_PLAYER);
+  view->player_location = game_get_player_location(game, VIEW_PLAYER);
+  view->player_health = player_get_health(player);
+  gdesc = player_get_gdesc(player);
+  for (i = 0; i < PLAYER_GDESC_Y; i++)
+  {
+    view_model_copy(view->player_gdesc[i], gdesc ? gdesc[i] : NULL, PLAYER_GDESC_X);
+  }
+
+  inventory = player_get_inventory(game_get_player(game, game_get_player_id(game)));
+  set = inventory_get_objects(inventory);
+  n = set_get_nids(set);
+  for (i = 0; i < n && view->n_inventory < MAX_OBJS; i++)
+  {
+    view_model_copy(view->inventory[view->n_inventory++], obj_get_name(game_get_object(game, set_get_ids_by_number(set, i))), OBJ_NAME_LEN);
+  }
+
+  /* Enemies */
+  for (i = 0; i < MAX_ENEMYS; i++)
+  {
+    id = game_get_enemy_id(game, i);
+    enemy = game_get_enemy(game, id);
+    if (!enemy)
+    {
+      break;
+    }
+    view->enemies[i].location = game_get_enemy_location(game, id);
+    view->enemies[i].health = enemy_get_health(enemy);
+    view_model_copy(view->enemies[i].name, enemy_get_name(enemy), ENEMY_LEN_NAME);
+    view->n_enemies++;
+  }
+
+  view->game_over = (view->player_health <= 0 || enemy_get_health(game_get_enemy(game, VIEW_BOSS)) <= 0) ? TRUE : FALSE;
+
+  /* Current space and its neighbours */
+  for (i = 0; i < V_SPACES; i++)
+  {
+    view->space[i].id = NO_ID;
+  }
+
+  act = game_get_space(game, view->player_location);
+  if (!act)
+  {
+    return view_model_build_turn(view, game, st);
+  }
+
+  view_model_build_space(&view->space[V_ACT], game, act, FALSE);
+  for (i = 0; i < VIEW_MAX_LINKS; i++)
+  {
+    link = game_get_link(game, space_get_link(act, i));
+    if (!link)
+    {
+      continue;
+    }
+
+    view->open[i] = (link_get_status(link) == OPEN_L) ? TRUE : FALSE;
+    if (link_get_status(link) == CLOSE && link_get_name(link) != NULL)
+    {
+      view->closed[view->n_closed].direction = link_get_direction(link);
+      view_model_copy(view->closed[view->n_closed].name, link_get_name(link), LINK_NAME_LEN);
+      view->n_closed++;
+    }
+
+    id = space_get_id_dest_by_link(link);
+    space = game_get_space(game, id);
+    if (i <= W && space)
+    {
+      view_model_build_space(&view->space[V_NORTH + i], game, space,
+                             (id == VIEW_HIDDEN_SPACE && view->time == DAY) ? TRUE : FALSE);
+    }
+  }
+
+  /* Occupant of the current space */
+  enemy = game_get_enemy_in_space(game, view->space[V_ACT].id);
+  gdesc = enemy_get_gdesc(enemy);
+  if (enemy)
+  {
+    view->enemy_here = TRUE;
+    for (i = 0; i < ENEMY_GDESC_Y; i++)
+    {
+      view_model_copy(view->enemy_gdesc[i], gdesc ? gdesc[i] : NULL, ENEMY_GDESC_X);
+    }
+  }
+
+  /* Visible objects of the current space */
+  set = space_get_objects(act);
+  n = set_get_nids(set);
+  for (i = 0; i < n; i++)
+  {
+    obj = game_get_object(game, set_get_ids_by_number(set, i));
+    if (!obj)
+    {
+      break;
+    }
+
+    if (obj_is_visible(obj, game_get_space_light(game, act)) == TRUE)
+    {
+      view_model_copy(view->objects[view->n_objects++], obj_get_name(obj), OBJ_NAME_LEN);
+    }
+  }
+
+  view_model_copy(view->description, space_get_brief_description(act), WORD_SIZE);
+
+  view->floor = space_get_floor(act);
+  view_model_build_floor(view, game);
+
+  return view_model_build_turn(view, game, st);
+}
+
+/**
+ * view_model_build_turn Rebuilds the parts of a view that change every turn
+ */
+STATUS view_model_build_turn(View *view, Game *game, int st)
+{
+  const char *text = NULL;
+
+  /* Error control */
+  if (!view || !game)
+  {
+    return ERROR;
+  }
+
+  view->last_cmd = game_get_last_command(game);
+  view->st = st;
+
+  view->has_inspection = FALSE;
+  memset(view->inspection, 0, sizeof(view->inspection));
+  text = game_get_inspection(game);
+  if (text)
+  {
+    view->has_inspection = TRUE;
+    view_model_copy(view->inspection, text, WORD_SIZE);
+  }
+
+  /* Scrollback of the dialogue and the events */
+  memset(view->dialogue, 0, sizeof(view->dialogue));
+  view->n_dialogue = view_model_build_log(view->dialogue, game_get_dialogue(game), FALSE);
+
+  memset(view->events, 0, sizeof(view->events));
+  view->n_events = view_model_build_log(view->events, game_get_dialogue(game), TRUE);
+
+  /* Nothing happening is not kept, but it is said while it lasts */
+  text = dialogue_get_event(game_get_dialogue(game));
+  if (text && (view->n_events == 0 || strcmp(text, view->events[view->n_events - 1]) != 0))
+  {
+    if (view->n_events == VIEW_LOG)
+    {
+      memmove(view->events[0], view->events[1], (VIEW_LOG - 1) * sizeof(view->events[0]));
+      memset(view->events[--view->n_events], 0, sizeof(view->events[0]));
+    }
+    view_model_copy(view->events[view->n_events++], text, VIEW_LOG_LEN);
+  }
+
+  return OK;
+}
+
+/**
+ * view_model_changed Checks if an area of a view differs from another view
+ */
+BOOL view_model_changed(const View *old, const View *view, View_area area)
+{
+  size_t from, to;
+
+  /* Error control */
+  if (!old || !view)
+  {
+    return FALSE;
+  }
+
+  /* Each area runs up to the first field of the next block of the view */
+  switch (area)
+  {
+  case VA_MAP:
+    from = offsetof(View, space);
+    to = offsetof(View, player_location);
+    break;
+  case VA_DESCRIPT:
+    from = offsetof(View, player_location);
+    to = offsetof(View, last_cmd);
+    break;
+  case VA_DIALOGUE:
+    from = offsetof(View, n_dialogue);
+    to = sizeof(View);
+    break;
+  default:
+    return FALSE;
+  }
+
+  return memcmp((const char *)view + from, (const char *)old + from, to - from) != 0 ? TRUE : FALSE;
+}
+
+/**
+ * @brief Copies at most max characters of a string, NULL gives ""
+ * @author Ignacio Nunez
+ *
+ * @param dest pointer to a buffer of at least max + 1 characters
+ * @param src pointer to the string to copy
+ * @param max maximun number of characters copied
+ */
+void view_model_copy(char *dest, const char *src, int max)
+{
+  if (!src)
+  {
+    dest[0] = '\0';
+    return;
+  }
+
+  strncpy(dest, src, max);
+  dest[max] = '\0';
+}
+
+/**
+ * @brief Checks if any object of a space can be seen with its light
+ * @author Ignacio Nunez
+ *
+ * @param game pointer to the game
+ * @param space pointer to the space
+ * @return TRUE if there is a visible object, FALSE otherwise
+ */
+BOOL view_model_has_object(Game *game, Space *space)
+{
+  Set *set = NULL;
+  int i, n;
+
+  set = space_get_objects(space);
+  n = set_get_nids(set);
+  for (i = 0; i < n; i++)
+  {
+    if (obj_is_visible(game_get_object(game, set_get_ids_by_number(set, i)), game_get_space_light(game, space)) == TRUE)
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Fills a space of a view
+ * @author Ignacio Nunez
+ *
+ * The name is padded to VIEW_NAME_PAD characters. A hidden space shows
+ * a wall pattern instead of its name and graphic description.
+ * @param vs pointer to the space of the view
+ * @param game pointer to the game
+ * @param space pointer to the space of the game
+ * @param hidden TRUE if the space can not be seen now
+ */
+void view_model_build_space(View_space *vs, Game *game, Space *space, BOOL hidden)
+{
+  char **gdesc = NULL;
+  int i, len;
+
+  vs->id = space_get_id(space);
+  vs->hidden = hidden;
+  vs->light = game_get_space_light(game, space);
+  vs->object = view_model_has_object(game, space);
+
+  view_model_copy(vs->name, space_get_name(space), VIEW_NAME_LEN);
+  for (len = strlen(vs->name); len < VIEW_NAME_PAD; len++)
+  {
+    vs->name[len] = ' ';
+  }
+  vs->name[len] = '\0';
+
+  gdesc = space_get_gdesc(space);
+  for (i = 0; i < TAM_GDESC_Y; i++)
+  {
+    view_model_copy(vs->gdesc[i], gdesc ? gdesc[i] : NULL, TAM_GDESC_X);
+  }
+
+  if (hidden == TRUE)
+  {
+    strcpy(vs->name, "¬¬¬¬¬¬¬ ");
+    for (i = 0; i < TAM_GDESC_Y; i++)
+    {
+      strcpy(vs->gdesc[i], "¬¬¬¬ ");
+    }
+  }
+}
+
+/**
+ * @brief Fills the spaces of the floor of the current space
+ * @author Ignacio Nunez
+ *
+ * @param view pointer to the view, its floor already set
+ * @param game pointer to the game
+ */
+void view_model_build_floor(View *view, Game *game)
+{
+  View_cell *cell = NULL;
+  Space *space = NULL;
+  int i, d;
+
+  for (i = 0; i < MAX_SPACES; i++)
+  {
+    space = game_get_space(game, game_get_space_id_at(game, i));
+    if (!space || space_get_floor(space) != view->floor)
+    {
+      continue;
+    }
+
+    cell = &view->cells[view->n_cells++];
+    cell->id = space_get_id(space);
+    cell->light = game_get_space_light(game, space);
+    cell->hidden = (cell->id == VIEW_HIDDEN_SPACE && view->time == DAY) ? TRUE : FALSE;
+    view_model_copy(cell->name, space_get_name(space), VIEW_CELL_NAME);
+    for (d = 0; d < VIEW_CELL_LINKS; d++)
+    {
+      cell->next[d] = space_get_id_dest_by_link(game_get_link(game, space_get_link(space, d)));
+    }
+  }
+}
+
+/**
+ * @brief Copies the newest messages of the scrollback of a kind, the oldest first
+ * @author Ignacio Nunez
+ *
+ * @param lines where the messages are copied, VIEW_LOG lines
+ * @param dialogue pointer to the dialogue
+ * @param events TRUE for the events, FALSE for the messages of the commands
+ * @return number of lines copied
+ */
+int view_model_build_log(char lines[][VIEW_LOG_LEN + 1], Dialogue *dialogue, BOOL events)
+{
+  DL_Kind kind;
+  int age, oldest = -1, n = 0;
+
+  /* The oldest one that is shown */
+  for (age = 0; n < VIEW_LOG && dialogue_log_get(dialogue, age, &kind) != NULL; age++)
+  {
+    if ((kind == DL_EVENT) == (events == TRUE))
+    {
+      oldest = age;
+      n++;
+    }
+  }
+
+  n = 0;
+  for (age = oldest; age >= 0; age--)
+  {
+    if (dialogue_log_get(dialogue, age, &kind) != NULL && (kind == DL_EVENT) == (events == TRUE))
+    {
+      view_model_copy(lines[n++], dialogue_log_get(dialogue, age, NULL), VIEW_LOG_LEN);
+    }
+  }
+
+  return n;
+}
@@ -0,0 +1,140 @@
+/**
+ * @brief It tests command module
+ *
+ * @file command_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/command.h"
+#include "command_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for command unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module command:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_command_lookup();
+  if (all || test == 2) test2_command_lookup();
+  if (all || test == 3) test3_command_lookup();
+  if (all || test == 4) test4_command_lookup();
+  if (all || test == 5) test5_command_lookup();
+  if (all || test == 6) test1_command_get_line_input();
+  if (all || test == 7) test2_command_get_line_input();
+  if (all || test == 8) test3_command_get_line_input();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_command_lookup()
+{
+  T_Command cmd;
+  int ok = 1;
+
+  for (cmd = EXIT; cmd <= MAP; cmd++)
+  {
+    if (command_lookup(command_get_name(cmd, CMDS)) != cmd || command_lookup(command_get_name(cmd, CMDL)) != cmd)
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok);
+}
+
+void test2_command_lookup()
+{
+  T_Command cmd;
+  T_CmdType type;
+  char name[WORD_SIZE];
+  int i, ok = 1;
+
+  for (cmd = EXIT; cmd <= MAP; cmd++)
+  {
+    for (type = CMDS; type <= CMDL; type++)
+    {
+      strcpy(name, command_get_name(cmd, type));
+      for (i = 0; name[i] != '\0'; i++)
+      {
+        name[i] = toupper((unsigned char)name[i]);
+      }
+      if (command_lookup(name) != cmd)
+      {
+        ok = 0;
+      }
+    }
+  }
+  PRINT_TEST_RESULT(ok);
+}
+
+void test3_command_lookup()
+{
+  PRINT_TEST_RESULT(command_lookup("Jump") == UNKNOWN && command_lookup("Maps") == UNKNOWN &&
+                    command_lookup("mm") == UNKNOWN && command_lookup("Exi") == UNKNOWN);
+}
+
+void test4_command_lookup()
+{
+  PRINT_TEST_RESULT(command_lookup("") == UNKNOWN);
+}
+
+void test5_command_lookup()
+{
+  PRINT_TEST_RESULT(command_lookup(NULL) == NO_CMD);
+}
+
+void test1_command_get_line_input()
+{
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(command_get_line_input("TAKE Torch1\n", arg1, arg2) == TAKE && strcmp(arg1, "Torch1") == 0);
+}
+
+void test2_command_get_line_input()
+{
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(command_get_line_input("o Door with Key", arg1, arg2) == OPEN &&
+                    strcmp(arg1, "Door") == 0 && strcmp(arg2, "Key") == 0);
+}
+
+void test3_command_get_line_input()
+{
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(command_get_line_input("dance now", arg1, arg2) == UNKNOWN);
+}
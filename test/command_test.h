@@ -0,0 +1,64 @@
+/** 
+ * @brief It declares the tests for the command module
+ * 
+ * @file command_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef COMMAND_TEST_H
+#define COMMAND_TEST_H
+
+/**
+ * @test Test finding every command by its short and long names
+ * @pre each name of command_get_name, from EXIT to MAP
+ * @post Output == that command
+ */
+void test1_command_lookup();
+/**
+ * @test Test finding every command by its names in upper case
+ * @pre each name of command_get_name in upper case
+ * @post Output == that command
+ */
+void test2_command_lookup();
+/**
+ * @test Test finding a name that no command has
+ * @pre names = "Jump", "Maps", "mm", "Exi"
+ * @post Output == UNKNOWN
+ */
+void test3_command_lookup();
+/**
+ * @test Test finding an empty name
+ * @pre name = ""
+ * @post Output == UNKNOWN
+ */
+void test4_command_lookup();
+/**
+ * @test Test finding no name
+ * @pre pointer to name = NULL
+ * @post Output == NO_CMD
+ */
+void test5_command_lookup();
+
+/**
+ * @test Test interpreting a line with an argument
+ * @pre line = "TAKE Torch1\n"
+ * @post Output == TAKE, arg1 == "Torch1"
+ */
+void test1_command_get_line_input();
+/**
+ * @test Test interpreting an open line
+ * @pre line = "o Door with Key"
+ * @post Output == OPEN, arg1 == "Door", arg2 == "Key"
+ */
+void test2_command_get_line_input();
+/**
+ * @test Test interpreting an unknown line
+ * @pre line = "dance now"
+ * @post Output == UNKNOWN
+ */
+void test3_command_get_line_input();
+
+#endif
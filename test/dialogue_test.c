@@ -15,7 +15,7 @@
 #include "dialogue_test.h"
 #include "test.h"
 
-#define MAX_TESTS 14  /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 28  /*!< It defines the maximun tests in this file */
 
 int main(int argc, char **argv)
 {
@@ -85,6 +85,29 @@ int main(int argc, char **argv)
   if (all || test == i) test2_dialogue_set_error();
   i++;
 
+  if (all || test == i) test1_dialogue_log_turn();
+  i++;
+  if (all || test == i) test2_dialogue_log_turn();
+  i++;
+  if (all || test == i) test3_dialogue_log_turn();
+  i++;
+  if (all || test == i) test4_dialogue_log_turn();
+  i++;
+  if (all || test == i) test5_dialogue_log_turn();
+  i++;
+  if (all || test == i) test6_dialogue_log_turn();
+  i++;
+
+  if (all || test == i) test1_dialogue_log_get();
+  i++;
+
+  if (all || test == i) test3_dialogue_set_command();
+  i++;
+  if (all || test == i) test4_dialogue_set_command();
+  i++;
+  if (all || test == i) test3_dialogue_set_error();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -219,6 +242,31 @@ void test2_dialogue_set_command()
 	PRINT_TEST_RESULT(dialogue_set_command(d, condition, NULL, NULL, NULL)==ERROR);
 }
 
+void test3_dialogue_set_command()
+{
+  Dialogue *d = NULL;
+  Object *o = NULL;
+
+  d = dialogue_create();
+  o = obj_create(1);
+  obj_set_name(o, "Torch1");
+  dialogue_set_command(d, DC_TON, NULL, o, NULL);
+  PRINT_TEST_RESULT(strcmp(dialogue_get_command(d), "You turned Torch1 on ") == 0);
+  dialogue_destroy(d);
+  obj_destroy(o);
+}
+
+void test4_dialogue_set_command()
+{
+  Dialogue *d = NULL;
+
+  d = dialogue_create();
+  dialogue_set_command(d, DC_MOVE_N, NULL, NULL, NULL);
+  PRINT_TEST_RESULT(strcmp(dialogue_get_command(d), "You moved North, you are now in the  ") == 0 &&
+                    dialogue_set_command(d, COMMAND_SIZE, NULL, NULL, NULL) == ERROR);
+  dialogue_destroy(d);
+}
+
 /*dialogue_set_event*/
 
 void test1_dialogue_set_event()
@@ -256,3 +304,105 @@ void test2_dialogue_set_error()
 	int condition = 4;
 	PRINT_TEST_RESULT(dialogue_set_error(d, condition, NULL, NULL, NULL)==ERROR);
 }
+
+void test3_dialogue_set_error()
+{
+  Dialogue *d = NULL;
+
+  d = dialogue_create();
+  dialogue_set_error(d, E_SAVE, NULL, NULL, NULL);
+  PRINT_TEST_RESULT(strcmp(dialogue_get_error(d), "Couldn't save the game") == 0);
+  dialogue_destroy(d);
+}
+
+/*dialogue_log_turn*/
+void test1_dialogue_log_turn()
+{
+  Dialogue *d = NULL;
+  DL_Kind kind = DL_EVENT;
+
+  d = dialogue_create();
+  dialogue_reset(d);
+  dialogue_set_command(d, DC_SAVE, NULL, NULL, NULL);
+  dialogue_log_turn(d);
+  PRINT_TEST_RESULT(dialogue_log_get_count(d) == 1 &&
+                    strcmp(dialogue_log_get(d, 0, &kind), "Save completed successfully") == 0 && kind == DL_COMMAND);
+  dialogue_destroy(d);
+}
+
+void test2_dialogue_log_turn()
+{
+  Dialogue *d = NULL;
+  DL_Kind kind = DL_EVENT;
+
+  d = dialogue_create();
+  dialogue_reset(d);
+  dialogue_set_command(d, DC_SAVE, NULL, NULL, NULL);
+  dialogue_set_error(d, E_SAVE, NULL, NULL, NULL);
+  dialogue_log_turn(d);
+  PRINT_TEST_RESULT(dialogue_log_get_count(d) == 1 &&
+                    strcmp(dialogue_log_get(d, 0, &kind), "Couldn't save the game") == 0 && kind == DL_ERROR);
+  dialogue_destroy(d);
+}
+
+void test3_dialogue_log_turn()
+{
+  Dialogue *d = NULL;
+
+  d = dialogue_create();
+  dialogue_reset(d);
+  dialogue_log_turn(d);
+  PRINT_TEST_RESULT(dialogue_log_get_count(d) == 0);
+  dialogue_destroy(d);
+}
+
+void test4_dialogue_log_turn()
+{
+  Dialogue *d = NULL;
+  DL_Kind kind = DL_COMMAND, before = DL_EVENT;
+
+  d = dialogue_create();
+  dialogue_reset(d);
+  dialogue_set_command(d, DC_SAVE, NULL, NULL, NULL);
+  dialogue_set_event(d, DE_TRAP);
+  dialogue_log_turn(d);
+  PRINT_TEST_RESULT(dialogue_log_get_count(d) == 2 && dialogue_log_get(d, 0, &kind) != NULL && kind == DL_EVENT &&
+                    dialogue_log_get(d, 1, &before) != NULL && before == DL_COMMAND);
+  dialogue_destroy(d);
+}
+
+void test5_dialogue_log_turn()
+{
+  Dialogue *d = NULL;
+  int i;
+
+  d = dialogue_create();
+  for (i = 0; i < DIALOGUE_LOG_SIZE + 3; i++)
+  {
+    dialogue_reset(d);
+    dialogue_set_command(d, i == DIALOGUE_LOG_SIZE + 2 ? DC_LOAD : DC_SAVE, NULL, NULL, NULL);
+    dialogue_log_turn(d);
+  }
+  PRINT_TEST_RESULT(dialogue_log_get_count(d) == DIALOGUE_LOG_SIZE &&
+                    strcmp(dialogue_log_get(d, 0, NULL), "Loading game... Successful") == 0 &&
+                    strcmp(dialogue_log_get(d, DIALOGUE_LOG_SIZE - 1, NULL), "Save completed successfully") == 0);
+  dialogue_destroy(d);
+}
+
+void test6_dialogue_log_turn()
+{
+  PRINT_TEST_RESULT(dialogue_log_turn(NULL) == ERROR);
+}
+
+/*dialogue_log_get*/
+void test1_dialogue_log_get()
+{
+  Dialogue *d = NULL;
+
+  d = dialogue_create();
+  dialogue_reset(d);
+  dialogue_set_command(d, DC_SAVE, NULL, NULL, NULL);
+  dialogue_log_turn(d);
+  PRINT_TEST_RESULT(dialogue_log_get(d, 1, NULL) == NULL && dialogue_log_get(d, -1, NULL) == NULL);
+  dialogue_destroy(d);
+}
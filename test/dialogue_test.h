@@ -109,6 +109,20 @@ void test1_dialogue_set_command();
  */
 void test2_dialogue_set_command();
 
+/**
+ * @test Test the name of an object in a command message
+ * @pre DC_TON with an object named Torch1
+ * @post Output == "You turned Torch1 on "
+ */
+void test3_dialogue_set_command();
+
+/**
+ * @test Test a command message without its modifier
+ * @pre DC_MOVE_N without space
+ * @post the * is a blank, and a condition out of the messages gives ERROR
+ */
+void test4_dialogue_set_command();
+
 /**
  * @test Test dialogue reset
  * @pre pointer to dialogue
@@ -137,4 +151,55 @@ void test1_dialogue_set_error();
  */
 void test2_dialogue_set_error();
 
+/**
+ * @test Test an error message without *
+ * @pre E_SAVE
+ * @post Output == "Couldn't save the game"
+ */
+void test3_dialogue_set_error();
+
+/**
+ * @test Test the command message of a turn
+ * @pre DC_SAVE set
+ * @post it is the newest message, of kind DL_COMMAND
+ */
+void test1_dialogue_log_turn();
+/**
+ * @test Test the error message of a turn
+ * @pre DC_SAVE and E_SAVE set
+ * @post only the error is kept
+ */
+void test2_dialogue_log_turn();
+/**
+ * @test Test a turn where nothing was said
+ * @pre dialogue reset
+ * @post nothing is kept
+ */
+void test3_dialogue_log_turn();
+/**
+ * @test Test the event message of a turn
+ * @pre DC_SAVE and DE_TRAP set
+ * @post the event is the newest message and the command the one before it
+ */
+void test4_dialogue_log_turn();
+/**
+ * @test Test a full scrollback
+ * @pre DIALOGUE_LOG_SIZE + 3 turns
+ * @post DIALOGUE_LOG_SIZE messages, the oldest ones overwritten
+ */
+void test5_dialogue_log_turn();
+/**
+ * @test Test keeping the messages of no dialogue
+ * @pre pointer to dialogue = NULL
+ * @post Output == ERROR
+ */
+void test6_dialogue_log_turn();
+
+/**
+ * @test Test getting a message older than the scrollback
+ * @pre one message kept
+ * @post NULL for age 1
+ */
+void test1_dialogue_log_get();
+
 #endif
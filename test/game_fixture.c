@@ -0,0 +1,35 @@
+/**
+ * @brief It implements the game the tests that play commands start from
+ *
+ * @file game_fixture.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include "../include/game_managment.h"
+#include "game_fixture.h"
+
+/**
+ * game_fixture_load Loads a new game from a map
+ */
+Game *game_fixture_load(char *file)
+{
+  Game *game = NULL;
+
+  game = game_alloc2();
+  if (!game)
+  {
+    return NULL;
+  }
+
+  if (game_create_from_file(game, file) == ERROR)
+  {
+    game_destroy(game);
+    return NULL;
+  }
+
+  return game;
+}
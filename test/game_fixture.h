@@ -0,0 +1,25 @@
+/** 
+ * @brief It declares the game the tests that play commands start from
+ * 
+ * @file game_fixture.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef GAME_FIXTURE_H
+#define GAME_FIXTURE_H
+
+#include "../include/game.h"
+
+/**
+ * @brief Loads a new game from a map
+ * @author Ignacio Nunez
+ *
+ * @param file name of the map
+ * @return pointer to the game or NULL if anything went wrong
+ */
+Game *game_fixture_load(char *file);
+
+#endif
@@ -11,86 +11,204 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 #include "../include/game_rules.h"
 #include "game_rules_test.h"
 #include "test.h"
 
-#define NUMBER_TEST 1000  /*!< It defines the number of tests in this file */
+#define DELAYS 10000      /*!< Delays drawn to check their average */
 
 int main(int argc, char **argv)
-{	
-	int test;
+{
+	test1_game_rules_get_delay();
+	test2_game_rules_get_delay();
+	test1_game_rules_wheel_next();
+	test2_game_rules_wheel_next();
+	test3_game_rules_wheel_next();
+	test1_game_rules_wheel_set();
+	test1_game_rules_wheel_stop();
+	test1_game_rules_wheel_reset();
+	test1_game_rules_table_add();
+	test2_game_rules_table_add();
+	test1_game_rules_table_get();
+	test2_game_rules_table_get();
+	test1_game_rules_event_get_byName();
+	test1_game_rules_cond_get_byName();
+
+	PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_game_rules_get_delay()
+{
+	Rng *rng = rng_create(7);
+	long d, total = 0, min = -1;
+	int i;
 
-	if(argc > 1)
-	{
-		test = atoi(argv[1]);
+	/*A 2% chance each turn happens every 50 turns on average*/
+	for(i = 0; i < DELAYS; i++){
+		d = game_rules_get_delay(rng, 2);
+		total += d;
+		if(min < 0 || d < min){
+			min = d;
+		}
 	}
-	else{
-		test = NUMBER_TEST;
+
+	PRINT_TEST_RESULT(min >= 1 && total / DELAYS >= 45 && total / DELAYS <= 55);
+	rng_destroy(rng);
+}
+
+void test2_game_rules_get_delay()
+{
+	Rng *rng = rng_create(7);
+
+	PRINT_TEST_RESULT(game_rules_get_delay(rng, 0) == -1 && game_rules_get_delay(rng, 101) == -1 &&
+	                  game_rules_get_delay(rng, 100) == 1);
+	rng_destroy(rng);
+}
+
+void test1_game_rules_wheel_next()
+{
+	Wheel *w = game_rules_wheel_create(10);
+	int due[WHEEL_TIMERS];
+
+	game_rules_wheel_set(w, 2, 11);
+	PRINT_TEST_RESULT(game_rules_wheel_next(w, due) == 1 && due[0] == 2 &&
+	                  game_rules_wheel_get_due(w, 2) == -1 && game_rules_wheel_get_now(w) == 11);
+	game_rules_wheel_destroy(w);
+}
+
+void test2_game_rules_wheel_next()
+{
+	Wheel *w = game_rules_wheel_create(0);
+	int due[WHEEL_TIMERS], i, early = 0;
+
+	/*Further than the two levels*/
+	game_rules_wheel_set(w, 0, 5000);
+	for(i = 1; i < 5000; i++){
+		early += game_rules_wheel_next(w, due);
 	}
 
-	test1_game_rules_get_event(test);
+	PRINT_TEST_RESULT(early == 0 && game_rules_wheel_next(w, due) == 1 && due[0] == 0);
+	game_rules_wheel_destroy(w);
+}
 
-	PRINT_PASSED_PERCENTAGE;
+void test3_game_rules_wheel_next()
+{
+	Wheel *w = game_rules_wheel_create(0);
+	int due[WHEEL_TIMERS];
 
-  return 1;
+	game_rules_wheel_set(w, 3, 100);
+	game_rules_wheel_set(w, 1, 100);
+	game_rules_wheel_set(w, 5, 100);
+	while(game_rules_wheel_get_now(w) < 99){
+		game_rules_wheel_next(w, due);
+	}
+
+	PRINT_TEST_RESULT(game_rules_wheel_next(w, due) == 3 && due[0] == 1 && due[1] == 3 && due[2] == 5);
+	game_rules_wheel_destroy(w);
 }
 
-void test1_game_rules_get_event(int test)
+void test1_game_rules_wheel_set()
 {
-	int i;
-	float e0, e1, e2, e3, e4, e5;
+	Wheel *w = game_rules_wheel_create(10);
+
+	PRINT_TEST_RESULT(game_rules_wheel_set(w, 0, 10) == ERROR && game_rules_wheel_set(w, WHEEL_TIMERS, 20) == ERROR &&
+	                  game_rules_wheel_set(NULL, 0, 20) == ERROR);
+	game_rules_wheel_destroy(w);
+}
+
+void test1_game_rules_wheel_stop()
+{
+	Wheel *w = game_rules_wheel_create(0);
+	int due[WHEEL_TIMERS];
+
+	game_rules_wheel_set(w, 4, 1);
+	game_rules_wheel_stop(w, 4);
+
+	PRINT_TEST_RESULT(game_rules_wheel_get_due(w, 4) == -1 && game_rules_wheel_next(w, due) == 0);
+	game_rules_wheel_destroy(w);
+}
+
+void test1_game_rules_wheel_reset()
+{
+	Wheel *w = game_rules_wheel_create(0);
+	int due[WHEEL_TIMERS];
+
+	game_rules_wheel_set(w, 4, 300);
+	game_rules_wheel_reset(w, 299);
+
+	PRINT_TEST_RESULT(game_rules_wheel_get_due(w, 4) == -1 && game_rules_wheel_next(w, due) == 0 &&
+	                  game_rules_wheel_get_now(w) == 300);
+	game_rules_wheel_destroy(w);
+}
+
+void test1_game_rules_table_add()
+{
+	Event_table *t = game_rules_table_create();
+
+	PRINT_TEST_RESULT(game_rules_table_add_default(t) == OK && game_rules_table_get_count(t) == 5 &&
+	                  game_rules_table_get_chance(t) == 100 - EVENT_ONE);
+	game_rules_table_destroy(t);
+}
+
+void test2_game_rules_table_add()
+{
+	Event_table *t = game_rules_table_create();
+
+	game_rules_table_add(t, TRAP, 60, COND_NONE);
+
+	/*More than 100% or no event*/
+	PRINT_TEST_RESULT(game_rules_table_add(t, SLIME, 41, COND_NONE) == ERROR &&
+	                  game_rules_table_add(t, NOTHING, 10, COND_NONE) == ERROR &&
+	                  game_rules_table_add(t, SLIME, 0, COND_NONE) == ERROR && game_rules_table_get_count(t) == 1);
+	game_rules_table_destroy(t);
+}
+
+void test1_game_rules_table_get()
+{
+	Event_table *t = game_rules_table_create();
+	Rng *rng = rng_create(7);
+	int i, cond, trap = 0, slime = 0, spawn = 0;
 	R_Event event;
 
-	srand(time(NULL));
-
-	fprintf(stdout, "Porcentages of happening for every event: \n");
-  	fprintf(stdout, "Event nº0 (No event): %d%%\n", EVENT_ONE);
-  	fprintf(stdout, "Event nº1: %d%%\n", 100 - EVENT_ONE);
-  	fprintf(stdout, "Event nº2: %d%%\n", EVENT_TWO - EVENT_ONE);
-  	fprintf(stdout, "Event nº3: %d%%\n", EVENT_THREE - EVENT_TWO);
-  	fprintf(stdout, "Event nº4: %d%%\n", EVENT_FOUR - EVENT_THREE);
-  	fprintf(stdout, "Event nº4: %d%%\n", EVENT_FIVE - EVENT_FOUR);
-
-	for(e0=0, e1=0, e2=0, e3=0, e4=0, e5=0, i=0 ; i < test ; i++)
-	{
-		event = game_rules_get_event();
-		PRINT_TEST_RESULT(event < -1);
-		fprintf(stdout, "Random event for test %d: ", i+1);
-
-		if(event == EVENT_CERO){
-			fprintf(stdout, "Event 0\n");
-			e0++;
-		}
-		else if(event == EVENT_ONE){
-			fprintf(stdout, "Event 1\n");
-			e1++;
-		}
-		else if(event == EVENT_TWO){
-			fprintf(stdout, "Event 2\n");
-			e2++;
-		}
-		else if(event == EVENT_THREE){
-			fprintf(stdout, "Event 3\n");
-			e3++;
-		}
-		else if(event == EVENT_FOUR){
-			fprintf(stdout, "Event 4\n");
-			e4++;
-		}
-		else if(event == EVENT_FIVE){
-			fprintf(stdout, "Event 5\n");
-			e5++;
-		}
+	game_rules_table_add(t, TRAP, 1, COND_NIGHT);
+	game_rules_table_add(t, SLIME, 6, COND_MOVE);
+	game_rules_table_add(t, SPAWN, 3, COND_NONE);
+
+	/*In proportion 1:6:3*/
+	for(i = 0; i < DELAYS; i++){
+		event = game_rules_table_get(t, rng, &cond);
+		trap += event == TRAP && cond == COND_NIGHT;
+		slime += event == SLIME && cond == COND_MOVE;
+		spawn += event == SPAWN && cond == COND_NONE;
 	}
 
-	fprintf(stdout, "FINAL RESULTS:\n");
-	fprintf(stdout, "Event 0 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", EVENT_ONE, (e0*100)/test);
-	fprintf(stdout, "Event 1 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", EVENT_TWO - EVENT_ONE, (e1*100)/test);
-	fprintf(stdout, "Event 2 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", EVENT_THREE - EVENT_TWO, (e2*100)/test);
-	fprintf(stdout, "Event 3 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", EVENT_FOUR - EVENT_THREE, (e3*100)/test);
-	fprintf(stdout, "Event 4 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", EVENT_FIVE - EVENT_FOUR, (e4*100)/test);
-	fprintf(stdout, "Event 5 - Porcentage expected: %d%% --> Porcentage obtained: %.2f%%\n", 100 - EVENT_FIVE, (e5*100)/test);
+	PRINT_TEST_RESULT(trap + slime + spawn == DELAYS && trap > 800 && trap < 1200 &&
+	                  slime > 5700 && slime < 6300 && spawn > 2700 && spawn < 3300);
+	rng_destroy(rng);
+	game_rules_table_destroy(t);
+}
 
-}
\ No newline at end of file
+void test2_game_rules_table_get()
+{
+	Event_table *t = game_rules_table_create();
+	Rng *rng = rng_create(7);
+	int cond;
+
+	PRINT_TEST_RESULT(game_rules_table_get(t, rng, &cond) == NOTHING && game_rules_table_get(NULL, rng, &cond) == NOTHING);
+	rng_destroy(rng);
+	game_rules_table_destroy(t);
+}
+
+void test1_game_rules_event_get_byName()
+{
+	PRINT_TEST_RESULT(game_rules_event_get_byName("daynight") == DAYNIGHT && game_rules_event_get_byName("Trap") == TRAP &&
+	                  game_rules_event_get_byName("rain") == NOTHING);
+}
+
+void test1_game_rules_cond_get_byName()
+{
+	PRINT_TEST_RESULT(game_rules_cond_get_byName("night") == COND_NIGHT && game_rules_cond_get_byName("none") == COND_NONE &&
+	                  game_rules_cond_get_byName("rain") == -1);
+}
@@ -11,6 +11,97 @@
 #ifndef GAME_RULES_TEST_H
 #define GAME_RULES_TEST_H
 
-void test1_game_rules_get_event(int test);
+/**
+ * @test Test the turns until something happens again
+ * @pre many delays of a 2% chance each turn
+ * @post every delay is 1 or more and their average is about 50
+ */
+void test1_game_rules_get_delay();
+/**
+ * @test Test the turns until something happens again
+ * @pre chances 0, 101 and 100
+ * @post Output == -1, -1 and 1
+ */
+void test2_game_rules_get_delay();
+
+/**
+ * @test Test moving a wheel to the next turn
+ * @pre a timer due in the next turn
+ * @post the timer is returned and stopped
+ */
+void test1_game_rules_wheel_next();
+/**
+ * @test Test moving a wheel to the next turn
+ * @pre a timer due further than the two levels of the wheel
+ * @post the timer is returned in its turn and not before
+ */
+void test2_game_rules_wheel_next();
+/**
+ * @test Test moving a wheel to the next turn
+ * @pre timers 3, 1 and 5 due in the same turn
+ * @post they are returned from the lowest
+ */
+void test3_game_rules_wheel_next();
+
+/**
+ * @test Test setting a timer
+ * @pre due turn not after the current one, wrong timer, no wheel
+ * @post Output == ERROR
+ */
+void test1_game_rules_wheel_set();
+
+/**
+ * @test Test stopping a timer
+ * @pre a timer due in the next turn, stopped
+ * @post it is not returned
+ */
+void test1_game_rules_wheel_stop();
+
+/**
+ * @test Test moving a wheel to a turn
+ * @pre a timer set, the wheel is reset
+ * @post the timer is stopped
+ */
+void test1_game_rules_wheel_reset();
+
+/**
+ * @test Test adding entries to an event table
+ * @pre the entries of a map without events
+ * @post 5 entries, with the chance of any event of the EVENT_* ranges
+ */
+void test1_game_rules_table_add();
+/**
+ * @test Test adding entries to an event table
+ * @pre chances adding up to more than 100, NOTHING, chance 0
+ * @post Output == ERROR
+ */
+void test2_game_rules_table_add();
+
+/**
+ * @test Test drawing the entry that happens
+ * @pre entries with chances 1, 6 and 3
+ * @post they come in that proportion, with their conditions
+ */
+void test1_game_rules_table_get();
+/**
+ * @test Test drawing the entry that happens
+ * @pre an empty table, no table
+ * @post Output == NOTHING
+ */
+void test2_game_rules_table_get();
+
+/**
+ * @test Test getting an event by its name
+ * @pre names of events and a wrong one
+ * @post the events, NOTHING for the wrong one
+ */
+void test1_game_rules_event_get_byName();
+
+/**
+ * @test Test getting a condition by its name
+ * @pre names of conditions and a wrong one
+ * @post the conditions, -1 for the wrong one
+ */
+void test1_game_rules_cond_get_byName();
 
 #endif
\ No newline at end of file
@@ -12,10 +12,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../include/game.h"
+#include "../include/game_managment.h"
+#include "game_fixture.h"
 #include "game_test.h"
 #include "test.h"
 
-#define MAX_TESTS 46 /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 67 /*!< It defines the maximun tests in this file */
+#define MAP_FILE "map.dat" /*!< Map used by the tests that play commands */
+#define STATE_SIZE 65536  /*!< Size of the buffers where the state of a game is written */
+#define N_PLAYED 300      /*!< Commands played by the tests of game_update_batch */
 
 /**
  * @brief Main function for inventory unit tests.
@@ -165,6 +170,55 @@ int main(int argc, char **argv)
   if (all || test == i) test2_game_get_enemyWithPlayer();
   i++;
 
+  if (all || test == i) test1_game_get_epoch();
+  i++;
+  if (all || test == i) test2_game_get_epoch();
+  i++;
+  if (all || test == i) test3_game_get_epoch();
+  i++;
+
+  if (all || test == i) test1_game_update_batch();
+  i++;
+  if (all || test == i) test2_game_update_batch();
+  i++;
+  if (all || test == i) test3_game_update_batch();
+  i++;
+
+  if (all || test == i) test1_game_set_realtime();
+  i++;
+  if (all || test == i) test2_game_set_realtime();
+  i++;
+
+  if (all || test == i) test1_game_tick();
+  i++;
+  if (all || test == i) test2_game_tick();
+  i++;
+
+  if (all || test == i) test1_game_set_triggers();
+  i++;
+  if (all || test == i) test2_game_set_triggers();
+  i++;
+  if (all || test == i) test3_game_set_triggers();
+  i++;
+
+  if (all || test == i) test1_game_get_space_light();
+  i++;
+  if (all || test == i) test2_game_get_space_light();
+  i++;
+  if (all || test == i) test3_game_get_space_light();
+  i++;
+  if (all || test == i) test4_game_get_space_light();
+  i++;
+  if (all || test == i) test5_game_get_space_light();
+  i++;
+  if (all || test == i) test6_game_get_space_light();
+  i++;
+
+  if (all || test == i) test1_game_set_lights();
+  i++;
+  if (all || test == i) test2_game_set_lights();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -637,3 +691,320 @@ void test2_game_get_enemyWithPlayer(){
 	Game *g = NULL;
 	PRINT_TEST_RESULT(game_get_enemyWithPlayer(g, 20) == NULL);
 }
+
+/*game_get_epoch*/
+void test1_game_get_epoch(){
+	Game *g = NULL;
+	Player *p;
+	unsigned long epoch;
+	g = game_alloc2();
+	game_create(g);
+
+	p = player_create(1);
+	game_add_player(g, p);
+	epoch = game_get_epoch(g);
+	player_set_location(p, 20);
+
+	PRINT_TEST_RESULT(game_get_epoch(g) > epoch);
+	game_destroy(g);
+}
+
+void test2_game_get_epoch(){
+	Game *g = NULL;
+	Player *p;
+	unsigned long epoch;
+	g = game_alloc2();
+	game_create(g);
+
+	p = player_create(1);
+	game_add_player(g, p);
+	epoch = game_get_epoch(g);
+	player_get_location(p);
+	game_get_inspection(g);
+
+	PRINT_TEST_RESULT(game_get_epoch(g) == epoch);
+	game_destroy(g);
+}
+
+void test3_game_get_epoch(){
+	Game *g = NULL;
+	PRINT_TEST_RESULT(game_get_epoch(g) == 0);
+}
+
+/*game_update_batch*/
+
+/**
+ * @brief Loads the map of the tests that play commands
+ *
+ * @param seed seed of the game
+ * @return the game, or NULL if there was any mistake
+ */
+static Game *load_game(unsigned long seed){
+	Game *game = NULL;
+
+	game = game_fixture_load(MAP_FILE);
+	if (game && game_set_seed(game, seed) == ERROR){
+		game_destroy(game);
+		return NULL;
+	}
+
+	return game;
+}
+
+void test1_game_update_batch(){
+	Game_command cycle[] = {{MOVE, "s", ""}, {MOVE, "s", ""}, {MOVE, "n", ""}, {MOVE, "n", ""},
+	                        {TAKE, "Torch1", ""}, {INSPECT, "s", ""}, {TURNON, "Torch1", ""}, {MOVE, "e", ""},
+	                        {ATTACK, "", ""}, {UNKNOWN, "", ""}, {DROP, "Torch1", ""}, {MOVE, "w", ""}};
+	Game_command cmds[N_PLAYED];
+	Game *g1 = NULL, *g2 = NULL;
+	static unsigned char s1[STATE_SIZE], s2[STATE_SIZE];
+	int st1[N_PLAYED], st2[N_PLAYED], n = sizeof(cycle) / sizeof(cycle[0]), i, ok;
+	long len1, len2;
+
+	g1 = load_game(3);
+	g2 = load_game(3);
+	if (!g1 || !g2)
+	{
+		PRINT_TEST_RESULT(0);
+		game_destroy(g1);
+		game_destroy(g2);
+		return;
+	}
+
+	for (i = 0; i < N_PLAYED; i++)
+	{
+		cmds[i] = cycle[i % n];
+		st1[i] = game_update(g1, cmds[i].cmd, cmds[i].arg1, cmds[i].arg2);
+	}
+	ok = (game_update_batch(g2, cmds, N_PLAYED, st2, NULL) == N_PLAYED);
+	for (i = 0; i < N_PLAYED; i++)
+	{
+		ok = ok && st1[i] == st2[i];
+	}
+
+	len1 = game_state_write(g1, s1, STATE_SIZE);
+	len2 = game_state_write(g2, s2, STATE_SIZE);
+	PRINT_TEST_RESULT(ok && len1 > 0 && len1 == len2 && memcmp(s1, s2, len1) == 0 &&
+	                  game_get_epoch(g1) == game_get_epoch(g2));
+	game_destroy(g1);
+	game_destroy(g2);
+}
+
+void test2_game_update_batch(){
+	Game_command cmd = {EXIT, "", ""};
+	int st;
+
+	PRINT_TEST_RESULT(game_update_batch(NULL, &cmd, 1, &st, NULL) == -1);
+}
+
+void test3_game_update_batch(){
+	Game_command cmds[3] = {{MOVE, "s", ""}, {INSPECT, "s", ""}, {MOVE, "n", ""}};
+	Game *g = NULL;
+	long ns[3] = {-1, -1, -1};
+	int st[3];
+
+	g = load_game(3);
+	PRINT_TEST_RESULT(game_update_batch(g, cmds, 3, st, ns) == 3 && ns[0] >= 0 && ns[1] >= 0 && ns[2] >= 0 &&
+	                  ns[0] + ns[1] + ns[2] > 0);
+	game_destroy(g);
+}
+
+/*game_set_realtime*/
+void test1_game_set_realtime(){
+	Game *g = NULL;
+	int i, ok;
+
+	g = load_game(3);
+	ok = (game_set_realtime(g, TRUE) == OK);
+	for (i = 0; i < N_PLAYED; i++)
+	{
+		game_update(g, UNKNOWN, "", "");
+		ok = ok && game_get_last_event(g) == NOTHING;
+	}
+
+	PRINT_TEST_RESULT(g != NULL && ok);
+	game_destroy(g);
+}
+
+void test2_game_set_realtime(){
+	PRINT_TEST_RESULT(game_set_realtime(NULL, TRUE) == ERROR);
+}
+
+/*game_tick*/
+void test1_game_tick(){
+	Game *g = NULL;
+	int i, ok;
+
+	g = load_game(3);
+	game_set_realtime(g, TRUE);
+	game_update(g, MOVE, "s", "");
+	for (i = 0, ok = 0; i < 10 * N_PLAYED && !ok; i++)
+	{
+		game_tick(g);
+		ok = game_get_last_event(g) != NOTHING;
+	}
+
+	PRINT_TEST_RESULT(g != NULL && ok && game_get_last_command(g) == MOVE);
+	game_destroy(g);
+}
+
+void test2_game_tick(){
+	PRINT_TEST_RESULT(game_tick(NULL) == ERROR);
+}
+
+/*game_set_triggers*/
+void test1_game_set_triggers(){
+	Game *g = NULL;
+
+	/*map.dat keeps 121 and 125 dark*/
+	g = load_game(3);
+	game_set_time(g, NIGHT);
+	game_set_time(g, DAY);
+
+	PRINT_TEST_RESULT(g != NULL && space_get_light_fixed(game_get_space(g, 121)) == TRUE &&
+	                  space_get_light_fixed(game_get_space(g, 122)) == FALSE &&
+	                  game_get_space_light(g, game_get_space(g, 122)) == BRIGHT &&
+	                  game_get_space_light(g, game_get_space(g, 121)) == DARK);
+	game_destroy(g);
+}
+
+void test2_game_set_triggers(){
+	Game *g = NULL;
+	Triggers *t = trigger_create();
+
+	g = load_game(3);
+	trigger_add(t, T_LIGHT, 122, NO_ID, NO_ID);
+	game_set_triggers(g, t);
+	game_set_time(g, NIGHT);
+
+	PRINT_TEST_RESULT(game_get_space_light(g, game_get_space(g, 122)) == BRIGHT);
+	game_destroy(g);
+}
+
+void test3_game_set_triggers(){
+	Game *g = NULL;
+
+	g = load_game(3);
+	PRINT_TEST_RESULT(game_set_triggers(g, NULL) == ERROR && game_set_triggers(NULL, NULL) == ERROR);
+	game_destroy(g);
+}
+
+/*game_get_space_light*/
+void test1_game_get_space_light(){
+	Game *g = NULL;
+	Object *torch = NULL;
+
+	/*The player starts in 11, which has fire, with Torch1*/
+	g = load_game(3);
+	torch = game_get_object(g, 390);
+	player_add_object(game_get_player(g, 21), torch);
+	object_set_turnedon(torch, TRUE);
+	game_update_ls(g);
+	game_set_time(g, NIGHT);
+
+	PRINT_TEST_RESULT(game_get_space_light(g, game_get_space(g, 11)) == BRIGHT &&
+	                  space_get_light_sources(game_get_space(g, 11)) == 2 &&
+	                  game_get_space_light(g, game_get_space(g, 122)) == DARK);
+	game_destroy(g);
+}
+
+void test2_game_get_space_light(){
+	Game *g = NULL;
+	Object *torch = NULL;
+
+	g = load_game(3);
+	torch = game_get_object(g, 390);
+	player_add_object(game_get_player(g, 21), torch);
+	object_set_turnedon(torch, TRUE);
+	game_update_ls(g);
+	object_set_turnedon(torch, FALSE);
+	game_update_ls(g);
+
+	PRINT_TEST_RESULT(space_get_light_sources(game_get_space(g, 11)) == 1);
+	game_destroy(g);
+}
+
+void test3_game_get_space_light(){
+	Game *g = NULL;
+	Object *torch = NULL;
+
+	/*13 goes to 126 through an open link and to 14 through a closed one*/
+	g = load_game(3);
+	torch = game_get_object(g, 390);
+	player_add_object(game_get_player(g, 21), torch);
+	object_set_turnedon(torch, TRUE);
+	game_set_player_location(g, 21, 13);
+	game_update_ls(g);
+	game_set_time(g, NIGHT);
+
+	PRINT_TEST_RESULT(game_get_space_light(g, game_get_space(g, 126)) == BRIGHT &&
+	                  game_get_space_light(g, game_get_space(g, 14)) == DARK &&
+	                  space_get_light_sources(game_get_space(g, 11)) == 1);
+	game_destroy(g);
+}
+
+void test4_game_get_space_light(){
+	Game *g = NULL;
+	Object *torch = NULL;
+
+	/*Door2 goes from 126 to 13*/
+	g = load_game(3);
+	torch = game_get_object(g, 390);
+	player_add_object(game_get_player(g, 21), torch);
+	player_add_object(game_get_player(g, 21), game_get_object(g, 385));
+	object_set_turnedon(torch, TRUE);
+	game_set_player_location(g, 21, 126);
+	game_update_ls(g);
+
+	PRINT_TEST_RESULT(space_get_light_sources(game_get_space(g, 13)) == 0 &&
+	                  game_update(g, OPEN, "Door2", "Key2") == OK &&
+	                  space_get_light_sources(game_get_space(g, 13)) == 1);
+	game_destroy(g);
+}
+
+void test5_game_get_space_light(){
+	Game *g = NULL;
+
+	g = load_game(3);
+	PRINT_TEST_RESULT(game_get_space_light(g, NULL) == UNKNOWN_LIGHT &&
+	                  game_get_space_light(NULL, game_get_space(g, 11)) == UNKNOWN_LIGHT);
+	game_destroy(g);
+}
+
+void test6_game_get_space_light(){
+	Game *g = NULL;
+	Object *torch = NULL;
+	BOOL ok;
+
+	/*The torch is left lit in 13, and the player goes away*/
+	g = load_game(3);
+	torch = game_get_object(g, 390);
+	player_add_object(game_get_player(g, 21), torch);
+	object_set_turnedon(torch, TRUE);
+	game_set_player_location(g, 21, 13);
+	game_update_ls(g);
+	game_update(g, DROP, "Torch1", "");
+	game_set_player_location(g, 21, 11);
+	game_update_ls(g);
+	ok = (space_get_light_sources(game_get_space(g, 13)) == 1 && space_get_light_sources(game_get_space(g, 126)) == 1);
+	game_set_lights(g);
+
+	PRINT_TEST_RESULT(ok && space_get_light_sources(game_get_space(g, 13)) == 1 &&
+	                  space_get_light_sources(game_get_space(g, 126)) == 1);
+	game_destroy(g);
+}
+
+/*game_set_lights*/
+void test1_game_set_lights(){
+	Game *g = NULL;
+
+	/*11 is the only space with fire*/
+	g = load_game(3);
+	space_set_light_sources(game_get_space(g, 11), 5);
+	PRINT_TEST_RESULT(game_set_lights(g) == OK && space_get_light_sources(game_get_space(g, 11)) == 1);
+	game_destroy(g);
+}
+
+void test2_game_set_lights(){
+	PRINT_TEST_RESULT(game_set_lights(NULL) == ERROR);
+}
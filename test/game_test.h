@@ -340,4 +340,151 @@ void test1_game_get_enemyWithPlayer();
  */
 void test2_game_get_enemyWithPlayer();
 
+/**
+ * @test Test game epoch getter
+ * @pre memory-allocated game, one of its players moves
+ * @post the epoch goes up
+ */
+void test1_game_get_epoch();
+
+/**
+ * @test Test game epoch getter
+ * @pre memory-allocated game, only getters are called
+ * @post the epoch does not change
+ */
+void test2_game_get_epoch();
+
+/**
+ * @test Test game epoch getter
+ * @pre non-memory-allocated game
+ * @post return 0
+ */
+void test3_game_get_epoch();
+
+/**
+ * @test Test playing several commands at once
+ * @pre two games loaded with the same seed, one plays the commands with game_update
+ * @post the same statuses, state and epoch in both games
+ */
+void test1_game_update_batch();
+
+/**
+ * @test Test playing several commands at once
+ * @pre non-memory-allocated game
+ * @post return -1
+ */
+void test2_game_update_batch();
+
+/**
+ * @test Test timing several commands played at once
+ * @pre three commands and where to save their times
+ * @post a time for every command
+ */
+void test3_game_update_batch();
+
+/**
+ * @test Test playing a game in real time
+ * @pre game loaded in real time, many commands are played
+ * @post no event happens
+ */
+void test1_game_set_realtime();
+
+/**
+ * @test Test playing a game in real time
+ * @pre non-memory-allocated game
+ * @post return ERROR
+ */
+void test2_game_set_realtime();
+
+/**
+ * @test Test letting the time go on
+ * @pre game loaded in real time, a move and many ticks are played
+ * @post some event happens and the last command is still the move
+ */
+void test1_game_tick();
+
+/**
+ * @test Test letting the time go on
+ * @pre non-memory-allocated game
+ * @post return ERROR
+ */
+void test2_game_tick();
+
+/**
+ * @test Test the triggers loaded from the map
+ * @pre game loaded from map.dat, night and then day
+ * @post 121 stays dark, 122 gets light
+ */
+void test1_game_set_triggers();
+
+/**
+ * @test Test setting the triggers of a game
+ * @pre a light trigger for 122, it gets dark
+ * @post 122 keeps its light
+ */
+void test2_game_set_triggers();
+
+/**
+ * @test Test setting no triggers
+ * @pre triggers = NULL, game = NULL
+ * @post return ERROR
+ */
+void test3_game_set_triggers();
+
+/**
+ * @test Test getting the light of a space
+ * @pre night, the player carries a lit torch in 11, which has fire
+ * @post 11 has light from both, 122 has none
+ */
+void test1_game_get_space_light();
+
+/**
+ * @test Test getting the light of a space
+ * @pre the torch of the player is turned off again
+ * @post only the fire lights 11
+ */
+void test2_game_get_space_light();
+
+/**
+ * @test Test getting the light of a space
+ * @pre night, the player carries a lit torch in 13
+ * @post the light gets to 126 through the open link, not to 14, and leaves 11
+ */
+void test3_game_get_space_light();
+
+/**
+ * @test Test getting the light of a space
+ * @pre the player carries a lit torch in 126 and opens Door2
+ * @post the light gets to 13
+ */
+void test4_game_get_space_light();
+
+/**
+ * @test Test getting the light of no space
+ * @pre space = NULL, game = NULL
+ * @post return UNKNOWN_LIGHT
+ */
+void test5_game_get_space_light();
+
+/**
+ * @test Test getting the light of a space
+ * @pre a lit torch is dropped in 13 and the player goes away
+ * @post the torch keeps lighting 13 and 126, also spread from scratch
+ */
+void test6_game_get_space_light();
+
+/**
+ * @test Test spreading the light from scratch
+ * @pre 11, which has fire, counted wrong
+ * @post 11 has the light of its fire
+ */
+void test1_game_set_lights();
+
+/**
+ * @test Test spreading the light of no game
+ * @pre game = NULL
+ * @post return ERROR
+ */
+void test2_game_set_lights();
+
 #endif
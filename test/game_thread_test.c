@@ -0,0 +1,197 @@
+/**
+ * @brief It tests that several games can be played at the same time
+ *
+ * Every thread loads its own game from map.dat and plays the same
+ * commands with a different seed. The result of every game must be the
+ * same one obtained playing that game alone.
+ *
+ * @file game_thread_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../include/game.h"
+#include "../include/command.h"
+#include "game_fixture.h"
+#include "game_thread_test.h"
+#include "test.h"
+
+#define MAX_TESTS 2       /*!< It defines the maximun tests in this file */
+#define N_THREADS 8       /*!< Games played at the same time */
+#define N_ROUNDS 20       /*!< Times the script is played in every game */
+#define MAP_FILE "map.dat" /*!< Map loaded by every game */
+
+/**
+ * @brief Commands played by every game
+ */
+static const char *script[] = {
+    "t Torch1", "ton Torch1", "a Beggar", "m s", "t Apple3", "t Sword1",
+    "m s", "t Sword2", "m e", "m e", "a Guard2", "a Guard2", "a Guard2",
+    "i Corridor2", "m w", "m w", "m n", "u Apple3", "m n", "m u", "m e",
+    "a Guard1", "a Guard1", "m w", "m d", NULL};
+
+/**
+ * @brief Arguments and result of one game
+ */
+typedef struct
+{
+  unsigned int seed;    /*!< Seed of the game */
+  unsigned long result; /*!< Hash of the state of the game at the end */
+} Match;
+
+unsigned long play(unsigned int seed);
+void *play_thread(void *arg);
+
+/**
+ * @brief Main function for game thread tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module game_thread:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1)
+    test1_game_thread_sequential();
+  if (all || test == 2)
+    test2_game_thread_parallel();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/**
+ * @brief Plays the script in a new game
+ *
+ * @param seed seed of the game
+ * @return hash of the state of the game after every command, 0 on error
+ */
+unsigned long play(unsigned int seed)
+{
+  Game *game = NULL;
+  T_Command cmd;
+  char arg1[WORD_SIZE], arg2[WORD_SIZE];
+  unsigned long hash = 5381;
+  Id player_id;
+  int i, j;
+
+  game = game_fixture_load(MAP_FILE);
+  if (!game)
+  {
+    return 0;
+  }
+  game_set_seed(game, seed);
+  player_id = game_get_player_id(game);
+
+  for (i = 0; i < N_ROUNDS && !game_is_over(game); i++)
+  {
+    for (j = 0; script[j] != NULL && !game_is_over(game); j++)
+    {
+      cmd = command_get_line_input(script[j], arg1, arg2);
+      game_update(game, cmd, arg1, arg2);
+
+      hash = hash * 33 + game_get_player_location(game, player_id);
+      hash = hash * 33 + player_get_health(game_get_player(game, player_id));
+      hash = hash * 33 + game_get_time(game);
+      hash = hash * 33 + game_get_last_event(game);
+    }
+  }
+
+  for (i = 0; i < MAX_ENEMYS && game_get_enemy_id(game, i) != NO_ID; i++)
+  {
+    hash = hash * 33 + enemy_get_health(game_get_enemy(game, game_get_enemy_id(game, i)));
+  }
+
+  game_destroy(game);
+
+  return hash;
+}
+
+/**
+ * @brief Thread entry point, plays one match
+ */
+void *play_thread(void *arg)
+{
+  Match *match = (Match *)arg;
+
+  match->result = play(match->seed);
+
+  return NULL;
+}
+
+void test1_game_thread_sequential()
+{
+  unsigned long r1, r2;
+
+  r1 = play(1234);
+  r2 = play(1234);
+  PRINT_TEST_RESULT(r1 != 0 && r1 == r2);
+}
+
+void test2_game_thread_parallel()
+{
+  pthread_t threads[N_THREADS];
+  Match matches[N_THREADS];
+  unsigned long expected[N_THREADS];
+  BOOL ok = TRUE;
+  int i;
+
+  for (i = 0; i < N_THREADS; i++)
+  {
+    matches[i].seed = 1000 + i;
+    matches[i].result = 0;
+    expected[i] = play(matches[i].seed);
+  }
+
+  for (i = 0; i < N_THREADS; i++)
+  {
+    if (pthread_create(&threads[i], NULL, play_thread, &matches[i]) != 0)
+    {
+      ok = FALSE;
+      threads[i] = 0;
+      matches[i].seed = 0;
+    }
+  }
+
+  for (i = 0; i < N_THREADS; i++)
+  {
+    if (matches[i].seed != 0)
+    {
+      pthread_join(threads[i], NULL);
+    }
+    if (expected[i] == 0 || matches[i].result != expected[i])
+    {
+      ok = FALSE;
+    }
+  }
+
+  PRINT_TEST_RESULT(ok == TRUE);
+}
@@ -0,0 +1,28 @@
+/** 
+ * @brief It declares the tests for playing several games at the same time
+ * 
+ * @file game_thread_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef GAME_THREAD_TEST_H
+#define GAME_THREAD_TEST_H
+
+/**
+ * @test Test that one game played twice with the same seed ends the same way
+ * @pre Same seed and same commands
+ * @post Output == same result
+ */
+void test1_game_thread_sequential();
+
+/**
+ * @test Test that games played in parallel end like the same games played alone
+ * @pre One thread per game, every game with its own seed
+ * @post Output == same result as sequential play
+ */
+void test2_game_thread_parallel();
+
+#endif
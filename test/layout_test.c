@@ -0,0 +1,152 @@
+/**
+ * @brief It tests layout module
+ *
+ * @file layout_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../include/layout.h"
+#include "layout_test.h"
+#include "test.h"
+
+#define MAX_TESTS 7 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for layout unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module layout:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_layout_compute();
+  if (all || test == 2) test2_layout_compute();
+  if (all || test == 3) test3_layout_compute();
+  if (all || test == 4) test4_layout_compute();
+  if (all || test == 5) test5_layout_compute();
+  if (all || test == 6) test1_layout_get_terminal();
+  if (all || test == 7) test2_layout_get_terminal();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/**
+ * @brief Tells if every area shown of a layout is inside its screen
+ *
+ * @param l pointer to the layout
+ * @return 1 if they are, 0 otherwise
+ */
+int inside(const Layout *l)
+{
+  int i;
+
+  for (i = 0; i < L_AREAS; i++)
+  {
+    if (l->area[i].width == 0)
+    {
+      continue;
+    }
+    if (l->area[i].x < 1 || l->area[i].y < 1 || l->area[i].height < 1 ||
+        l->area[i].x + l->area[i].width > l->columns - 1 ||
+        l->area[i].y + l->area[i].height > l->rows - 1)
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+void test1_layout_compute()
+{
+  Layout l;
+
+  layout_compute(&l, 45, 120);
+  PRINT_TEST_RESULT(l.compact == FALSE && l.rows == LAYOUT_ROWS && l.columns == LAYOUT_COLUMNS &&
+                    l.area[L_MAP].x == 1 && l.area[L_MAP].y == 1 &&
+                    l.area[L_MAP].width == 80 && l.area[L_MAP].height == 25 && inside(&l));
+}
+
+void test2_layout_compute()
+{
+  Layout l;
+
+  layout_compute(&l, 24, 80);
+  PRINT_TEST_RESULT(l.compact == TRUE && l.rows == 23 && l.columns == 80 &&
+                    l.area[L_DESCRIPT].width == 0 && l.area[L_HELP].width == 0 &&
+                    l.area[L_MAP].width == 78 && l.area[L_EVENTS].width > 0 && inside(&l));
+}
+
+void test3_layout_compute()
+{
+  Layout l;
+
+  layout_compute(&l, 30, 110);
+  PRINT_TEST_RESULT(l.compact == TRUE && l.area[L_MAP].width == 80 &&
+                    l.area[L_DESCRIPT].width > 0 && l.area[L_DESCRIPT].x == 82 && inside(&l));
+}
+
+void test4_layout_compute()
+{
+  Layout l;
+
+  layout_compute(&l, 5, 10);
+  PRINT_TEST_RESULT(l.rows == LAYOUT_MIN_ROWS && l.columns == LAYOUT_MIN_COLUMNS && inside(&l));
+}
+
+void test5_layout_compute()
+{
+  PRINT_TEST_RESULT(layout_compute(NULL, 45, 120) == ERROR);
+}
+
+void test1_layout_get_terminal()
+{
+  int fd[2], rows, columns;
+
+  if (pipe(fd) != 0)
+  {
+    PRINT_TEST_RESULT(0);
+    return;
+  }
+  PRINT_TEST_RESULT(layout_get_terminal(fd[0], &rows, &columns) == ERROR);
+  close(fd[0]);
+  close(fd[1]);
+}
+
+void test2_layout_get_terminal()
+{
+  int columns;
+
+  PRINT_TEST_RESULT(layout_get_terminal(STDOUT_FILENO, NULL, &columns) == ERROR);
+}
@@ -0,0 +1,58 @@
+/** 
+ * @brief It declares the tests for the layout module
+ * 
+ * @file layout_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LAYOUT_TEST_H
+#define LAYOUT_TEST_H
+
+/**
+ * @test Test the layout of a terminal big enough
+ * @pre rows = 45, columns = 120
+ * @post the usual screen, with the map at 1,1 and 80x25
+ */
+void test1_layout_compute();
+/**
+ * @test Test the layout of a small terminal
+ * @pre rows = 24, columns = 80
+ * @post compact, no description, every area inside the screen
+ */
+void test2_layout_compute();
+/**
+ * @test Test the layout of a terminal wide but not high enough
+ * @pre rows = 30, columns = 110
+ * @post compact, description next to the map
+ */
+void test3_layout_compute();
+/**
+ * @test Test the layout of a terminal smaller than the smallest screen
+ * @pre rows = 5, columns = 10
+ * @post the smallest screen
+ */
+void test4_layout_compute();
+/**
+ * @test Test working out no layout
+ * @pre pointer to layout = NULL
+ * @post Output == ERROR
+ */
+void test5_layout_compute();
+
+/**
+ * @test Test getting the size of something that is not a terminal
+ * @pre fd of a pipe
+ * @post Output == ERROR
+ */
+void test1_layout_get_terminal();
+/**
+ * @test Test getting the size with no place to return it
+ * @pre pointer to rows = NULL
+ * @post Output == ERROR
+ */
+void test2_layout_get_terminal();
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @brief It tests libscreen module
+ *
+ * What is painted is caught by sending stdout to a temporary file.
+ *
+ * @file libscreen_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "../include/libscreen.h"
+#include "libscreen_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8   /*!< It defines the maximun tests in this file */
+#define OUT_SIZE 8192 /*!< Biggest paint caught by the tests */
+
+static char out[OUT_SIZE]; /*!< Bytes sent by the last paint caught */
+
+/**
+ * @brief Main function for libscreen unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module libscreen:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_screen_area_init();
+  if (all || test == 2) test2_screen_area_init();
+  if (all || test == 3) test3_screen_area_init();
+  if (all || test == 4) test1_screen_paint();
+  if (all || test == 5) test2_screen_paint();
+  if (all || test == 6) test3_screen_paint();
+  if (all || test == 7) test1_screen_area_puts();
+  if (all || test == 8) test4_screen_paint();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/**
+ * @brief Paints the screen, catching what is sent to the terminal in out
+ *
+ * @return number of bytes sent, -1 if they could not be caught
+ */
+long paint()
+{
+  FILE *f = NULL;
+  long len;
+  int saved;
+
+  fflush(stdout);
+  f = tmpfile();
+  saved = dup(STDOUT_FILENO);
+  if (!f || saved < 0 || dup2(fileno(f), STDOUT_FILENO) < 0)
+  {
+    return -1;
+  }
+
+  screen_paint();
+
+  dup2(saved, STDOUT_FILENO);
+  close(saved);
+  rewind(f);
+  len = (long)fread(out, 1, OUT_SIZE - 1, f);
+  out[len] = '\0';
+  fclose(f);
+
+  return len;
+}
+
+void test1_screen_area_init()
+{
+  Area *a = NULL;
+
+  screen_init(10, 40);
+  a = screen_area_init(1, 1, 20, 5);
+  PRINT_TEST_RESULT(a != NULL);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+void test2_screen_area_init()
+{
+  screen_init(10, 40);
+  PRINT_TEST_RESULT(screen_area_init(1, 1, 40, 5) == NULL);
+  screen_destroy();
+}
+
+void test3_screen_area_init()
+{
+  screen_destroy();
+  PRINT_TEST_RESULT(screen_area_init(1, 1, 20, 5) == NULL);
+}
+
+void test1_screen_paint()
+{
+  long len;
+
+  screen_init(10, 40);
+  len = paint();
+  PRINT_TEST_RESULT(len > 10 * 40 && strncmp(out, "\033[H\033[2J", 7) == 0);
+  screen_destroy();
+}
+
+void test2_screen_paint()
+{
+  screen_init(10, 40);
+  paint();
+  PRINT_TEST_RESULT(paint() == (long)strlen("\033[11;1H\033[0m\033[J") &&
+                    strcmp(out, "\033[11;1H\033[0m\033[J") == 0);
+  screen_destroy();
+}
+
+void test3_screen_paint()
+{
+  Area *a = NULL;
+
+  screen_init(10, 40);
+  a = screen_area_init(1, 1, 20, 5);
+  paint();
+  screen_area_puts(a, "hello");
+  paint();
+  PRINT_TEST_RESULT(strstr(out, "\033[2;2H") != NULL && strstr(out, "hello") != NULL &&
+                    strstr(out, "\033[3;") == NULL);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+void test1_screen_area_puts()
+{
+  Area *a = NULL;
+
+  screen_init(10, 40);
+  a = screen_area_init(1, 1, 5, 3);
+  paint();
+  screen_area_puts(a, "abcdefgh");
+  paint();
+  PRINT_TEST_RESULT(strstr(out, "abcde") != NULL && strstr(out, "\033[3;2H") != NULL &&
+                    strstr(out, "fgh") != NULL);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+void test4_screen_paint()
+{
+  Area *a = NULL;
+  int saved, full;
+
+  screen_init(10, 40);
+  a = screen_area_init(1, 1, 20, 5);
+  paint();
+  screen_area_puts(a, "hello");
+
+  /* The terminal does not get this paint */
+  fflush(stdout);
+  saved = dup(STDOUT_FILENO);
+  full = open("/dev/full", O_WRONLY);
+  dup2(full, STDOUT_FILENO);
+  screen_paint();
+  dup2(saved, STDOUT_FILENO);
+  close(saved);
+  close(full);
+
+  PRINT_TEST_RESULT(paint() > 10 * 40 && strncmp(out, "\033[H\033[2J", 7) == 0 && strstr(out, "hello") != NULL);
+  screen_area_destroy(a);
+  screen_destroy();
+}
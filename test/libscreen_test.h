@@ -0,0 +1,65 @@
+/** 
+ * @brief It declares the tests for the libscreen module
+ * 
+ * @file libscreen_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LIBSCREEN_TEST_H
+#define LIBSCREEN_TEST_H
+
+/**
+ * @test Test area creation
+ * @pre screen of 10x40, area inside it
+ * @post Output != NULL
+ */
+void test1_screen_area_init();
+/**
+ * @test Test area creation outside the screen
+ * @pre area wider than the screen
+ * @post Output == NULL
+ */
+void test2_screen_area_init();
+/**
+ * @test Test area creation without screen
+ * @pre screen destroyed
+ * @post Output == NULL
+ */
+void test3_screen_area_init();
+
+/**
+ * @test Test the first paint of a screen
+ * @pre new screen
+ * @post the terminal is cleared and every row is sent
+ */
+void test1_screen_paint();
+/**
+ * @test Test painting a screen that did not change
+ * @pre screen painted once
+ * @post only the move to the prompt is sent
+ */
+void test2_screen_paint();
+/**
+ * @test Test painting a line written in an area
+ * @pre screen painted once, then a line written in an area
+ * @post the line is sent and the row it is not in is not
+ */
+void test3_screen_paint();
+/**
+ * @test Test painting after a paint the terminal did not get
+ * @pre screen painted once, a line written, then a paint that could not be sent
+ * @post the next paint clears the terminal and sends every row
+ */
+void test4_screen_paint();
+
+/**
+ * @test Test writing a line wider than its area
+ * @pre area of width 5, line of 8 chars
+ * @post the rest of the line goes to the next row of the area
+ */
+void test1_screen_area_puts();
+
+#endif
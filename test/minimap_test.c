@@ -0,0 +1,176 @@
+/**
+ * @brief It tests minimap module
+ *
+ * @file minimap_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/minimap.h"
+#include "game_fixture.h"
+#include "minimap_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9        /*!< It defines the maximun tests in this file */
+#define MAP_FILE "map.dat" /*!< Map used by the tests */
+
+static View view; /*!< View of a new game */
+
+/**
+ * @brief Main function for minimap unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  Game *game = NULL;
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module minimap:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  game = game_fixture_load(MAP_FILE);
+  if (!game)
+  {
+    printf("Error: can not load %s\n", MAP_FILE);
+    exit(EXIT_FAILURE);
+  }
+  view_model_build(&view, game, 1);
+  game_destroy(game);
+
+  if (all || test == 1) test1_minimap_create();
+  if (all || test == 2) test1_minimap_destroy();
+  if (all || test == 3) test1_minimap_render();
+  if (all || test == 4) test2_minimap_render();
+  if (all || test == 5) test3_minimap_render();
+  if (all || test == 6) test4_minimap_render();
+  if (all || test == 7) test1_minimap_clear();
+  if (all || test == 8) test1_minimap_get_position();
+  if (all || test == 9) test1_minimap_get_row();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_minimap_create()
+{
+  Minimap *mm = NULL;
+
+  mm = minimap_create();
+  PRINT_TEST_RESULT(mm != NULL && minimap_get_layouts(mm) == 0);
+  minimap_destroy(mm);
+}
+
+void test1_minimap_destroy()
+{
+  PRINT_TEST_RESULT(minimap_destroy(NULL) == ERROR);
+}
+
+void test1_minimap_render()
+{
+  PRINT_TEST_RESULT(minimap_render(NULL, &view) == ERROR);
+}
+
+void test2_minimap_render()
+{
+  Minimap *mm = NULL;
+  int r1, c1, r2, c2, r3, c3;
+
+  mm = minimap_create();
+  minimap_render(mm, &view);
+  PRINT_TEST_RESULT(minimap_get_position(mm, 11, &r1, &c1) == OK && minimap_get_position(mm, 121, &r2, &c2) == OK &&
+                    minimap_get_position(mm, 16, &r3, &c3) == OK && r2 == r1 + MINIMAP_CELL_Y && c2 == c1 &&
+                    r3 == r2 && c3 == c2 + MINIMAP_CELL_X && minimap_get_row(mm, r2 + 4)[c2 + 4] == '|' &&
+                    strncmp(minimap_get_row(mm, r2 + 2) + c2 + 7, "|--|", 4) == 0);
+  minimap_destroy(mm);
+}
+
+void test3_minimap_render()
+{
+  Minimap *mm = NULL;
+  int r1, c1, r2, c2;
+
+  mm = minimap_create();
+  minimap_render(mm, &view);
+  minimap_get_position(mm, 11, &r1, &c1);
+  minimap_get_position(mm, 121, &r2, &c2);
+  PRINT_TEST_RESULT(strncmp(minimap_get_row(mm, 0), " Floor: FLOOR_0", 15) == 0 &&
+                    strncmp(minimap_get_row(mm, r1 + 1) + c1, "|Cell  |", 8) == 0 &&
+                    strncmp(minimap_get_row(mm, r1 + 2) + c1, "|   @  |", 8) == 0 &&
+                    strncmp(minimap_get_row(mm, r2 + 2) + c2, "|::::::|", 8) == 0 &&
+                    strlen(minimap_get_row(mm, 0)) == MINIMAP_COLS);
+  minimap_destroy(mm);
+}
+
+void test4_minimap_render()
+{
+  Minimap *mm = NULL;
+  View moved;
+  int r1, c1, r2, c2;
+
+  mm = minimap_create();
+  minimap_render(mm, &view);
+  memcpy(&moved, &view, sizeof(View));
+  moved.player_location = 121;
+  minimap_render(mm, &moved);
+  minimap_get_position(mm, 11, &r1, &c1);
+  minimap_get_position(mm, 121, &r2, &c2);
+  PRINT_TEST_RESULT(minimap_get_layouts(mm) == 1 && strncmp(minimap_get_row(mm, r1 + 2) + c1, "|      |", 8) == 0 &&
+                    strncmp(minimap_get_row(mm, r2 + 2) + c2, "|:::@::|", 8) == 0);
+  minimap_destroy(mm);
+}
+
+void test1_minimap_clear()
+{
+  Minimap *mm = NULL;
+
+  mm = minimap_create();
+  minimap_render(mm, &view);
+  minimap_clear(mm);
+  minimap_render(mm, &view);
+  PRINT_TEST_RESULT(minimap_get_layouts(mm) == 2);
+  minimap_destroy(mm);
+}
+
+void test1_minimap_get_position()
+{
+  Minimap *mm = NULL;
+  int row, col;
+
+  mm = minimap_create();
+  minimap_render(mm, &view);
+  PRINT_TEST_RESULT(minimap_get_position(mm, 12, &row, &col) == ERROR);
+  minimap_destroy(mm);
+}
+
+void test1_minimap_get_row()
+{
+  Minimap *mm = NULL;
+
+  mm = minimap_create();
+  PRINT_TEST_RESULT(minimap_get_row(mm, MINIMAP_ROWS) == NULL && minimap_get_row(mm, 0) != NULL);
+  minimap_destroy(mm);
+}
@@ -0,0 +1,74 @@
+/** 
+ * @brief It declares the tests for the minimap module
+ * 
+ * @file minimap_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef MINIMAP_TEST_H
+#define MINIMAP_TEST_H
+
+/**
+ * @test Test minimap creation
+ * @pre none
+ * @post Output != NULL, no layout worked out
+ */
+void test1_minimap_create();
+
+/**
+ * @test Test destroying no minimap
+ * @pre pointer to minimap = NULL
+ * @post Output == ERROR
+ */
+void test1_minimap_destroy();
+
+/**
+ * @test Test drawing with no minimap
+ * @pre pointer to minimap = NULL
+ * @post Output == ERROR
+ */
+void test1_minimap_render();
+/**
+ * @test Test the layout of the first floor
+ * @pre view of a new game
+ * @post corridor below the cell, secret chamber to the right of the corridor
+ */
+void test2_minimap_render();
+/**
+ * @test Test the marks drawn every turn
+ * @pre view of a new game
+ * @post player in the cell, dark corridor, floor in the title
+ */
+void test3_minimap_render();
+/**
+ * @test Test the layout is worked out once
+ * @pre the same floor drawn twice, the player moved in between
+ * @post one layout, the player marker moved
+ */
+void test4_minimap_render();
+
+/**
+ * @test Test dropping the layouts
+ * @pre minimap drawn, then cleared and drawn again
+ * @post two layouts worked out
+ */
+void test1_minimap_clear();
+
+/**
+ * @test Test the position of a space of another floor
+ * @pre view of a new game, space of the attic
+ * @post Output == ERROR
+ */
+void test1_minimap_get_position();
+
+/**
+ * @test Test getting a row out of the minimap
+ * @pre row = MINIMAP_ROWS
+ * @post Output == NULL
+ */
+void test1_minimap_get_row();
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @brief It tests render_queue module
+ *
+ * @file render_queue_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../include/render_queue.h"
+#include "render_queue_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8    /*!< It defines the maximun tests in this file */
+#define N_VIEWS 100    /*!< Views put in by the producer of the thread test */
+
+static View view; /*!< View put in by the tests */
+
+/**
+ * @brief Main function for render_queue unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module render_queue:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_render_queue_create();
+  if (all || test == 2) test2_render_queue_create();
+  if (all || test == 3) test1_render_queue_push();
+  if (all || test == 4) test2_render_queue_push();
+  if (all || test == 5) test1_render_queue_front();
+  if (all || test == 6) test2_render_queue_front();
+  if (all || test == 7) test1_render_queue_pop();
+  if (all || test == 8) test1_render_queue_wait();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/**
+ * @brief Takes every view out of a queue, checking they come in order
+ *
+ * @param arg pointer to the queue
+ * @return NULL if every view came in order, the queue otherwise
+ */
+void *consume(void *arg)
+{
+  Render_queue *q = (Render_queue *)arg;
+  const View *v = NULL;
+  int next = 0;
+  void *ret = NULL;
+
+  while ((v = render_queue_front(q)) != NULL)
+  {
+    if (v->st != next++)
+    {
+      ret = arg;
+    }
+    render_queue_pop(q);
+  }
+
+  return next == N_VIEWS ? ret : arg;
+}
+
+void test1_render_queue_create()
+{
+  Render_queue *q = NULL;
+
+  q = render_queue_create(2);
+  PRINT_TEST_RESULT(q != NULL && render_queue_get_count(q) == 0);
+  render_queue_destroy(q);
+}
+
+void test2_render_queue_create()
+{
+  PRINT_TEST_RESULT(render_queue_create(0) == NULL);
+}
+
+void test1_render_queue_push()
+{
+  PRINT_TEST_RESULT(render_queue_push(NULL, &view) == ERROR);
+}
+
+void test2_render_queue_push()
+{
+  Render_queue *q = NULL;
+
+  q = render_queue_create(2);
+  render_queue_close(q);
+  PRINT_TEST_RESULT(render_queue_push(q, &view) == ERROR);
+  render_queue_destroy(q);
+}
+
+void test1_render_queue_front()
+{
+  Render_queue *q = NULL;
+  BOOL first, second;
+
+  q = render_queue_create(2);
+  view.last_cmd = TAKE;
+  render_queue_push(q, &view);
+  view.last_cmd = MOVE;
+  render_queue_push(q, &view);
+  first = (render_queue_get_count(q) == 2 && render_queue_front(q)->last_cmd == TAKE) ? TRUE : FALSE;
+  render_queue_pop(q);
+  second = (render_queue_front(q)->last_cmd == MOVE) ? TRUE : FALSE;
+  render_queue_pop(q);
+  PRINT_TEST_RESULT(first == TRUE && second == TRUE && render_queue_get_count(q) == 0);
+  render_queue_destroy(q);
+}
+
+void test2_render_queue_front()
+{
+  Render_queue *q = NULL;
+
+  q = render_queue_create(2);
+  render_queue_close(q);
+  PRINT_TEST_RESULT(render_queue_front(q) == NULL);
+  render_queue_destroy(q);
+}
+
+void test1_render_queue_pop()
+{
+  Render_queue *q = NULL;
+
+  q = render_queue_create(2);
+  PRINT_TEST_RESULT(render_queue_pop(q) == ERROR);
+  render_queue_destroy(q);
+}
+
+void test1_render_queue_wait()
+{
+  Render_queue *q = NULL;
+  pthread_t consumer;
+  void *ret = NULL;
+  int i;
+
+  q = render_queue_create(2);
+  if (pthread_create(&consumer, NULL, consume, q) != 0)
+  {
+    PRINT_TEST_RESULT(0);
+    render_queue_destroy(q);
+    return;
+  }
+
+  for (i = 0; i < N_VIEWS; i++)
+  {
+    view.st = i;
+    render_queue_push(q, &view);
+  }
+  render_queue_wait(q);
+  i = render_queue_get_count(q);
+  render_queue_close(q);
+  pthread_join(consumer, &ret);
+
+  PRINT_TEST_RESULT(i == 0 && ret == NULL);
+  render_queue_destroy(q);
+}
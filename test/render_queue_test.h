@@ -0,0 +1,67 @@
+/** 
+ * @brief It declares the tests for the render_queue module
+ * 
+ * @file render_queue_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RENDER_QUEUE_TEST_H
+#define RENDER_QUEUE_TEST_H
+
+/**
+ * @test Test queue creation
+ * @pre size = 2
+ * @post Output != NULL, no views in it
+ */
+void test1_render_queue_create();
+/**
+ * @test Test queue creation without slots
+ * @pre size = 0
+ * @post Output == NULL
+ */
+void test2_render_queue_create();
+
+/**
+ * @test Test putting a view in no queue
+ * @pre pointer to queue = NULL
+ * @post Output == ERROR
+ */
+void test1_render_queue_push();
+/**
+ * @test Test putting a view in a closed queue
+ * @pre queue closed
+ * @post Output == ERROR
+ */
+void test2_render_queue_push();
+
+/**
+ * @test Test the order views come out
+ * @pre two views put in
+ * @post the first one is at the front, then the second one
+ */
+void test1_render_queue_front();
+/**
+ * @test Test the front of a closed, empty queue
+ * @pre queue closed
+ * @post Output == NULL
+ */
+void test2_render_queue_front();
+
+/**
+ * @test Test taking out of an empty queue
+ * @pre empty queue
+ * @post Output == ERROR
+ */
+void test1_render_queue_pop();
+
+/**
+ * @test Test a producer and a consumer thread
+ * @pre queue of two views, a hundred views put in
+ * @post the consumer gets all of them in order
+ */
+void test1_render_queue_wait();
+
+#endif
@@ -0,0 +1,161 @@
+/**
+ * @brief It tests render_stats module
+ *
+ * @file render_stats_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/render_stats.h"
+#include "render_stats_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for render_stats unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module render_stats:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_render_stats_create();
+  if (all || test == 2) test1_render_stats_add();
+  if (all || test == 3) test2_render_stats_add();
+  if (all || test == 4) test3_render_stats_add();
+  if (all || test == 5) test1_render_stats_stop();
+  if (all || test == 6) test2_render_stats_stop();
+  if (all || test == 7) test1_render_stats_get_max();
+  if (all || test == 8) test1_render_stats_print();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_render_stats_create()
+{
+  Render_stats *rs = NULL;
+
+  rs = render_stats_create();
+  PRINT_TEST_RESULT(rs != NULL && render_stats_get_count(rs, RS_PAINT) == 0);
+  render_stats_destroy(rs);
+}
+
+void test1_render_stats_add()
+{
+  Render_stats *rs = NULL;
+
+  rs = render_stats_create();
+  render_stats_add(rs, RS_BYTES, 0);
+  render_stats_add(rs, RS_BYTES, 1);
+  render_stats_add(rs, RS_BYTES, 5);
+  render_stats_add(rs, RS_BYTES, 7);
+  PRINT_TEST_RESULT(render_stats_get_count(rs, RS_BYTES) == 4 && render_stats_get_bucket(rs, RS_BYTES, 0) == 1 &&
+                    render_stats_get_bucket(rs, RS_BYTES, 1) == 1 && render_stats_get_bucket(rs, RS_BYTES, 3) == 2);
+  render_stats_destroy(rs);
+}
+
+void test2_render_stats_add()
+{
+  PRINT_TEST_RESULT(render_stats_add(NULL, RS_BYTES, 1) == ERROR);
+}
+
+void test3_render_stats_add()
+{
+  Render_stats *rs = NULL;
+
+  rs = render_stats_create();
+  render_stats_add(rs, RS_BYTES, 0x7fffffffL);
+  render_stats_add(rs, RS_BYTES, 0x7fffffffL);
+  PRINT_TEST_RESULT(render_stats_get_bucket(rs, RS_BYTES, RENDER_STATS_BUCKETS - 1) == 2);
+  render_stats_destroy(rs);
+}
+
+void test1_render_stats_stop()
+{
+  Render_stats *rs = NULL;
+  long start;
+
+  rs = render_stats_create();
+  start = render_stats_start(rs);
+  PRINT_TEST_RESULT(render_stats_stop(rs, RS_PAINT, start) == OK && render_stats_get_count(rs, RS_PAINT) == 1 &&
+                    render_stats_get_max(rs, RS_PAINT) >= 0);
+  render_stats_destroy(rs);
+}
+
+void test2_render_stats_stop()
+{
+  PRINT_TEST_RESULT(render_stats_start(NULL) == 0 && render_stats_stop(NULL, RS_PAINT, 0) == ERROR);
+}
+
+void test1_render_stats_get_max()
+{
+  Render_stats *rs = NULL;
+
+  rs = render_stats_create();
+  render_stats_add(rs, RS_MAP, 3);
+  render_stats_add(rs, RS_MAP, 9);
+  PRINT_TEST_RESULT(render_stats_get_max(rs, RS_MAP) == 9 && render_stats_get_max(rs, RS_SCREEN) == -1);
+  render_stats_destroy(rs);
+}
+
+void test1_render_stats_print()
+{
+  Render_stats *rs = NULL;
+  FILE *f = NULL;
+  char line[256];
+  int bytes = 0, others = 0;
+
+  rs = render_stats_create();
+  f = tmpfile();
+  render_stats_add(rs, RS_BYTES, 100);
+  render_stats_add(rs, RS_BYTES, 3000);
+  render_stats_print(rs, f);
+  rewind(f);
+  while (fgets(line, sizeof(line), f))
+  {
+    if (line[0] == ' ')
+    {
+      continue;
+    }
+    if (strncmp(line, "bytes:", 6) == 0)
+    {
+      bytes++;
+    }
+    else
+    {
+      others++;
+    }
+  }
+  PRINT_TEST_RESULT(bytes == 1 && others == 0);
+  fclose(f);
+  render_stats_destroy(rs);
+}
@@ -0,0 +1,67 @@
+/** 
+ * @brief It declares the tests for the render_stats module
+ * 
+ * @file render_stats_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RENDER_STATS_TEST_H
+#define RENDER_STATS_TEST_H
+
+/**
+ * @test Test statistics creation
+ * @pre nothing
+ * @post Output != NULL, no values in them
+ */
+void test1_render_stats_create();
+
+/**
+ * @test Test adding values to a histogram
+ * @pre values 0, 1, 5 and 7 added to RS_BYTES
+ * @post 4 values, one in bucket 0, one in bucket 1 and two in bucket 3
+ */
+void test1_render_stats_add();
+/**
+ * @test Test adding a value to no statistics
+ * @pre pointer to statistics = NULL
+ * @post Output == ERROR
+ */
+void test2_render_stats_add();
+/**
+ * @test Test adding a value out of every bucket
+ * @pre value bigger than 2^31
+ * @post it goes to the last bucket
+ */
+void test3_render_stats_add();
+
+/**
+ * @test Test measuring a time
+ * @pre start and stop on RS_PAINT
+ * @post one value, not negative
+ */
+void test1_render_stats_stop();
+/**
+ * @test Test measuring with no statistics
+ * @pre pointer to statistics = NULL
+ * @post start returns 0 and stop returns ERROR
+ */
+void test2_render_stats_stop();
+
+/**
+ * @test Test the biggest value of a histogram
+ * @pre values 3 and 9 added
+ * @post Output == 9, and -1 for a histogram without values
+ */
+void test1_render_stats_get_max();
+
+/**
+ * @test Test printing the statistics
+ * @pre values added to RS_BYTES only
+ * @post only the bytes are printed
+ */
+void test1_render_stats_print();
+
+#endif
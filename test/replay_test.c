@@ -0,0 +1,237 @@
+/**
+ * @brief It tests replay module
+ *
+ * @file replay_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/replay.h"
+#include "game_fixture.h"
+#include "replay_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8                   /*!< It defines the maximun tests in this file */
+#define MAP_FILE "map.dat"            /*!< Map used by the tests */
+#define REPLAY_FILE "replay_test.rpl" /*!< Replay written by the tests */
+#define CUT_FILE "replay_test_cut.rpl" /*!< Replay cut by the tests */
+#define N_TURNS 37                    /*!< Commands played */
+#define INTERVAL 5                    /*!< Turns between keyframes */
+#define SEED 2022                     /*!< Seed of the game */
+#define STATE_SIZE 8192               /*!< Size of the buffers of the states */
+
+/**
+ * @brief Commands played
+ */
+static const char *script[] = {
+    "t Torch1", "ton Torch1", "a Beggar", "m s", "t Apple3", "t Sword1",
+    "m s", "t Sword2", "m e", "m e", "a Guard2", "a Guard2", "a Guard2",
+    "i Corridor2", "m w", "m w", "m n", "u Apple3", "m n", "m u", "m e",
+    "a Guard1", "a Guard1", "m w", "m d", NULL};
+
+static unsigned char states[N_TURNS + 1][STATE_SIZE]; /*!< State after every turn */
+static long state_len[N_TURNS + 1];                  /*!< Size of every state */
+
+
+/**
+ * @brief Main function for replay unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ * The replay is always recorded first, the other tests need it.
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module replay:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_replay_record();
+  i++;
+  test2_replay_record();
+  i++;
+  if (all || test == i) test1_replay_load();
+  i++;
+  if (all || test == i) test2_replay_load();
+  i++;
+  if (all || test == i) test3_replay_load();
+  i++;
+  if (all || test == i) test1_replay_get_command();
+  i++;
+  if (all || test == i) test1_replay_seek();
+  i++;
+  if (all || test == i) test2_replay_seek();
+
+  remove(REPLAY_FILE);
+  remove(CUT_FILE);
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_replay_record()
+{
+  PRINT_TEST_RESULT(replay_record(REPLAY_FILE, MAP_FILE, NULL, INTERVAL) == NULL);
+}
+
+void test2_replay_record()
+{
+  Game *game = NULL;
+  Replay *r = NULL;
+  T_Command cmd;
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+  BOOL ok = TRUE;
+  int i;
+
+  game = game_fixture_load(MAP_FILE);
+  game_set_seed(game, SEED);
+  r = replay_record(REPLAY_FILE, MAP_FILE, game, INTERVAL);
+  state_len[0] = game_state_write(game, states[0], STATE_SIZE);
+
+  for (i = 1; i <= N_TURNS; i++)
+  {
+    cmd = command_get_line_input(script[(i - 1) % 25], arg1, arg2);
+    game_update(game, cmd, arg1, arg2);
+    if (replay_add_command(r, game, cmd, arg1, arg2) == ERROR)
+    {
+      ok = FALSE;
+    }
+    state_len[i] = game_state_write(game, states[i], STATE_SIZE);
+  }
+
+  PRINT_TEST_RESULT(r != NULL && ok == TRUE && state_len[0] > 0);
+  replay_destroy(r);
+  game_destroy(game);
+}
+
+void test1_replay_load()
+{
+  Replay *r = NULL;
+
+  r = replay_load(REPLAY_FILE);
+  PRINT_TEST_RESULT(r != NULL && replay_get_turns(r) == N_TURNS &&
+                    strcmp(replay_get_map(r), MAP_FILE) == 0 && replay_get_seed(r) == SEED);
+  replay_destroy(r);
+}
+
+void test2_replay_load()
+{
+  PRINT_TEST_RESULT(replay_load(MAP_FILE) == NULL);
+}
+
+void test3_replay_load()
+{
+  FILE *in = NULL, *out = NULL;
+  Replay *r = NULL;
+  long size, i;
+
+  in = fopen(REPLAY_FILE, "rb");
+  out = fopen(CUT_FILE, "wb");
+  if (!in || !out)
+  {
+    PRINT_TEST_RESULT(FALSE);
+    return;
+  }
+  fseek(in, 0, SEEK_END);
+  size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  for (i = 0; i < size - 3; i++)
+  {
+    fputc(fgetc(in), out);
+  }
+  fclose(in);
+  fclose(out);
+
+  r = replay_load(CUT_FILE);
+  PRINT_TEST_RESULT(r != NULL && replay_get_turns(r) < N_TURNS);
+  replay_destroy(r);
+}
+
+void test1_replay_get_command()
+{
+  Replay *r = NULL;
+  T_Command cmd, expected;
+  char arg1[MAX_ARG], arg2[MAX_ARG], exp1[MAX_ARG], exp2[MAX_ARG];
+  BOOL ok = TRUE;
+  int i;
+
+  r = replay_load(REPLAY_FILE);
+  for (i = 1; i <= N_TURNS; i++)
+  {
+    expected = command_get_line_input(script[(i - 1) % 25], exp1, exp2);
+    if (replay_get_command(r, i, &cmd, arg1, arg2) == ERROR || cmd != expected ||
+        strcmp(arg1, exp1) != 0 || strcmp(arg2, exp2) != 0)
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(r != NULL && ok == TRUE);
+  replay_destroy(r);
+}
+
+void test1_replay_seek()
+{
+  Replay *r = NULL;
+  Game *game = NULL;
+  unsigned char state[STATE_SIZE];
+  long len;
+  BOOL ok = TRUE;
+  int i;
+
+  r = replay_load(REPLAY_FILE);
+  /* Seeking backwards and forwards on the same game */
+  game = game_fixture_load(MAP_FILE);
+  for (i = N_TURNS; i >= 0; i -= 3)
+  {
+    if (replay_seek(r, game, i) == ERROR)
+    {
+      ok = FALSE;
+      continue;
+    }
+    len = game_state_write(game, state, STATE_SIZE);
+    if (len != state_len[i] || memcmp(state, states[i], len) != 0)
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(r != NULL && ok == TRUE);
+  game_destroy(game);
+  replay_destroy(r);
+}
+
+void test2_replay_seek()
+{
+  Replay *r = NULL;
+  Game *game = NULL;
+
+  r = replay_load(REPLAY_FILE);
+  game = game_fixture_load(MAP_FILE);
+  PRINT_TEST_RESULT(replay_seek(r, game, N_TURNS + 1) == ERROR);
+  game_destroy(game);
+  replay_destroy(r);
+}
@@ -0,0 +1,66 @@
+/** 
+ * @brief It declares the tests for the replay module
+ * 
+ * @file replay_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef REPLAY_TEST_H
+#define REPLAY_TEST_H
+
+/**
+ * @test Test replay recording without a game
+ * @pre pointer to game = NULL
+ * @post Output == NULL
+ */
+void test1_replay_record();
+/**
+ * @test Test replay recording
+ * @pre game loaded and commands played
+ * @post Output == OK for every command
+ */
+void test2_replay_record();
+
+/**
+ * @test Test loading a recorded replay
+ * @pre replay recorded by test2_replay_record
+ * @post same turns, map and seed
+ */
+void test1_replay_load();
+/**
+ * @test Test loading a file that is not a replay
+ * @pre data file of the game
+ * @post Output == NULL
+ */
+void test2_replay_load();
+/**
+ * @test Test loading a replay cut in the middle of a record
+ * @pre replay without its last bytes
+ * @post Output != NULL with less turns
+ */
+void test3_replay_load();
+
+/**
+ * @test Test getting the commands of a replay
+ * @pre replay recorded by test2_replay_record
+ * @post same commands that were played
+ */
+void test1_replay_get_command();
+
+/**
+ * @test Test moving to every turn of a replay
+ * @pre new game loaded from the same map
+ * @post state of the game == state recorded in that turn
+ */
+void test1_replay_seek();
+/**
+ * @test Test moving to a turn out of the replay
+ * @pre turn = number of turns + 1
+ * @post Output == ERROR
+ */
+void test2_replay_seek();
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * @brief It tests rng module
+ *
+ * @file rng_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/rng.h"
+#include "rng_test.h"
+#include "test.h"
+
+#define MAX_TESTS 10  /*!< It defines the maximun tests in this file */
+#define N_NUMBERS 1000 /*!< Numbers compared in every test */
+
+/**
+ * @brief Main function for rng unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module rng:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_rng_create();
+  i++;
+  if (all || test == i) test1_rng_destroy();
+  i++;
+  if (all || test == i) test1_rng_next();
+  i++;
+  if (all || test == i) test2_rng_next();
+  i++;
+  if (all || test == i) test3_rng_next();
+  i++;
+  if (all || test == i) test1_rng_range();
+  i++;
+  if (all || test == i) test2_rng_range();
+  i++;
+  if (all || test == i) test1_rng_state();
+  i++;
+  if (all || test == i) test2_rng_state();
+  i++;
+  if (all || test == i) test1_rng_set_seed();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_rng_create()
+{
+  Rng *rng = NULL;
+
+  rng = rng_create(42);
+  PRINT_TEST_RESULT(rng != NULL);
+  rng_destroy(rng);
+}
+
+void test1_rng_destroy()
+{
+  PRINT_TEST_RESULT(rng_destroy(NULL) == ERROR);
+}
+
+void test1_rng_next()
+{
+  Rng *a = NULL, *b = NULL;
+  int i, same = 1;
+
+  a = rng_create(42);
+  b = rng_create(42);
+  for (i = 0; i < N_NUMBERS; i++)
+  {
+    if (rng_next(a) != rng_next(b))
+    {
+      same = 0;
+    }
+  }
+  PRINT_TEST_RESULT(same == 1);
+  rng_destroy(a);
+  rng_destroy(b);
+}
+
+void test2_rng_next()
+{
+  Rng *a = NULL, *b = NULL;
+  int i, equal = 0;
+
+  a = rng_create(42);
+  b = rng_create(43);
+  for (i = 0; i < N_NUMBERS; i++)
+  {
+    if (rng_next(a) == rng_next(b))
+    {
+      equal++;
+    }
+  }
+  PRINT_TEST_RESULT(equal < 2);
+  rng_destroy(a);
+  rng_destroy(b);
+}
+
+void test3_rng_next()
+{
+  Rng *rng = NULL;
+  unsigned long state[RNG_STATE_SIZE] = {1, 2, 3, 4};
+  unsigned long r1, r2;
+
+  rng = rng_create(0);
+  rng_set_state(rng, state);
+  r1 = rng_next(rng);
+  r2 = rng_next(rng);
+  PRINT_TEST_RESULT(r1 == 11520 && r2 == 0);
+  rng_destroy(rng);
+}
+
+void test1_rng_range()
+{
+  Rng *rng = NULL;
+  int seen[10];
+  int i, r, ok = 1;
+
+  memset(seen, 0, sizeof(seen));
+  rng = rng_create(7);
+  for (i = 0; i < N_NUMBERS; i++)
+  {
+    r = rng_range(rng, 10);
+    if (r < 0 || r > 9)
+    {
+      ok = 0;
+    }
+    else
+    {
+      seen[r] = 1;
+    }
+  }
+  for (i = 0; i < 10; i++)
+  {
+    if (!seen[i])
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok == 1);
+  rng_destroy(rng);
+}
+
+void test2_rng_range()
+{
+  Rng *rng = NULL;
+
+  rng = rng_create(7);
+  PRINT_TEST_RESULT(rng_range(rng, 0) == -1);
+  rng_destroy(rng);
+}
+
+void test1_rng_state()
+{
+  Rng *a = NULL, *b = NULL;
+  unsigned long state[RNG_STATE_SIZE];
+  int i, same = 1;
+
+  a = rng_create(99);
+  b = rng_create(1);
+  for (i = 0; i < 10; i++)
+  {
+    rng_next(a);
+  }
+  rng_get_state(a, state);
+  rng_set_state(b, state);
+  for (i = 0; i < N_NUMBERS; i++)
+  {
+    if (rng_next(a) != rng_next(b))
+    {
+      same = 0;
+    }
+  }
+  PRINT_TEST_RESULT(same == 1);
+  rng_destroy(a);
+  rng_destroy(b);
+}
+
+void test2_rng_state()
+{
+  Rng *rng = NULL;
+  unsigned long state[RNG_STATE_SIZE] = {0, 0, 0, 0};
+
+  rng = rng_create(1);
+  PRINT_TEST_RESULT(rng_set_state(rng, state) == ERROR);
+  rng_destroy(rng);
+}
+
+void test1_rng_set_seed()
+{
+  Rng *rng = NULL;
+  unsigned long first;
+
+  rng = rng_create(5);
+  first = rng_next(rng);
+  rng_next(rng);
+  rng_set_seed(rng, 5);
+  PRINT_TEST_RESULT(rng_next(rng) == first && rng_get_seed(rng) == 5);
+  rng_destroy(rng);
+}
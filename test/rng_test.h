@@ -0,0 +1,80 @@
+/** 
+ * @brief It declares the tests for the rng module
+ * 
+ * @file rng_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RNG_TEST_H
+#define RNG_TEST_H
+
+/**
+ * @test Test generator creation
+ * @pre any seed
+ * @post Non NULL pointer to generator
+ */
+void test1_rng_create();
+
+/**
+ * @test Test free generator
+ * @pre pointer to generator = NULL
+ * @post Output == ERROR
+ */
+void test1_rng_destroy();
+
+/**
+ * @test Test that the same seed gives the same numbers
+ * @pre two generators with the same seed
+ * @post Output == same numbers
+ */
+void test1_rng_next();
+/**
+ * @test Test that different seeds give different numbers
+ * @pre two generators with different seeds
+ * @post Output != same numbers
+ */
+void test2_rng_next();
+/**
+ * @test Test the output of xoshiro128** for a known state
+ * @pre state {1, 2, 3, 4}
+ * @post Output == 11520 and 0
+ */
+void test3_rng_next();
+
+/**
+ * @test Test that the numbers are inside the range
+ * @pre max = 10
+ * @post Output between 0 and 9, all of them appear
+ */
+void test1_rng_range();
+/**
+ * @test Test range with a wrong max
+ * @pre max = 0
+ * @post Output == -1
+ */
+void test2_rng_range();
+
+/**
+ * @test Test that a restored state continues the same sequence
+ * @pre state copied in the middle of a sequence
+ * @post Output == same numbers
+ */
+void test1_rng_state();
+/**
+ * @test Test restoring a state of all zeros
+ * @pre state {0, 0, 0, 0}
+ * @post Output == ERROR
+ */
+void test2_rng_state();
+
+/**
+ * @test Test that setting the seed restarts the sequence
+ * @pre generator used and seeded again
+ * @post Output == same numbers and same seed
+ */
+void test1_rng_set_seed();
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @brief It tests script module
+ *
+ * @file script_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/script.h"
+#include "script_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9                               /*!< It defines the maximun tests in this file */
+#define SCRIPT_FILE "script_test.tmp"             /*!< File where the scripts of the tests are written */
+#define SCRIPT_TEXT "take Torch1\n\nopen Door with Key\r\nexit\n" /*!< Script of most tests */
+
+/**
+ * @brief Main function for script unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module script:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_script_load();
+  if (all || test == 2) test2_script_load();
+  if (all || test == 3) test3_script_load();
+  if (all || test == 4) test4_script_load();
+  if (all || test == 5) test1_script_get();
+  if (all || test == 6) test2_script_get();
+  if (all || test == 7) test3_script_get();
+  if (all || test == 8) test4_script_get();
+  if (all || test == 9) test1_script_get_count();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  remove(SCRIPT_FILE);
+
+  return 1;
+}
+
+/**
+ * @brief Writes a script and loads it
+ *
+ * @param text content of the script
+ * @return the script, or NULL if there was any mistake
+ */
+Script *load(const char *text)
+{
+  FILE *f = NULL;
+
+  f = fopen(SCRIPT_FILE, "w");
+  if (!f)
+  {
+    return NULL;
+  }
+  fputs(text, f);
+  fclose(f);
+
+  return script_load(SCRIPT_FILE);
+}
+
+void test1_script_load()
+{
+  Script *s = load(SCRIPT_TEXT);
+
+  PRINT_TEST_RESULT(script_get_count(s) == 3);
+  script_destroy(s);
+}
+
+void test2_script_load()
+{
+  Script *s = load("");
+
+  PRINT_TEST_RESULT(s != NULL && script_get_count(s) == 0);
+  script_destroy(s);
+}
+
+void test3_script_load()
+{
+  PRINT_TEST_RESULT(script_load("no_such_script.cmd") == NULL);
+}
+
+void test4_script_load()
+{
+  Script *s = load("m n\ne");
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(script_get_count(s) == 2 && script_get(s, 1, arg1, arg2) == EXIT);
+  script_destroy(s);
+}
+
+void test1_script_get()
+{
+  Script *s = load(SCRIPT_TEXT);
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(script_get(s, 0, arg1, arg2) == TAKE && strcmp(arg1, "Torch1") == 0 && arg2[0] == '\0');
+  script_destroy(s);
+}
+
+void test2_script_get()
+{
+  Script *s = load(SCRIPT_TEXT);
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(script_get(s, 1, arg1, arg2) == OPEN && strcmp(arg1, "Door") == 0 && strcmp(arg2, "Key") == 0);
+  script_destroy(s);
+}
+
+void test3_script_get()
+{
+  Script *s = load(SCRIPT_TEXT);
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(script_get(s, 3, arg1, arg2) == NO_CMD);
+  script_destroy(s);
+}
+
+void test4_script_get()
+{
+  char arg1[MAX_ARG], arg2[MAX_ARG];
+
+  PRINT_TEST_RESULT(script_get(NULL, 0, arg1, arg2) == NO_CMD);
+}
+
+void test1_script_get_count()
+{
+  PRINT_TEST_RESULT(script_get_count(NULL) == -1);
+}
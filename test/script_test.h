@@ -0,0 +1,71 @@
+/** 
+ * @brief It declares the tests for the script module
+ * 
+ * @file script_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SCRIPT_TEST_H
+#define SCRIPT_TEST_H
+
+/**
+ * @test Test loading a script
+ * @pre file with 3 commands and a blank line
+ * @post 3 commands
+ */
+void test1_script_load();
+/**
+ * @test Test loading an empty script
+ * @pre empty file
+ * @post a script with 0 commands
+ */
+void test2_script_load();
+/**
+ * @test Test loading a file that does not exist
+ * @pre file name of no file
+ * @post Output == NULL
+ */
+void test3_script_load();
+/**
+ * @test Test loading a script whose last line has no '\n'
+ * @pre file "m n\ne"
+ * @post 2 commands, the last one EXIT
+ */
+void test4_script_load();
+
+/**
+ * @test Test getting a command with an argument
+ * @pre line "take Torch1"
+ * @post Output == TAKE, arg1 == "Torch1", arg2 == ""
+ */
+void test1_script_get();
+/**
+ * @test Test getting a command with two arguments
+ * @pre line "open Door with Key"
+ * @post Output == OPEN, arg1 == "Door", arg2 == "Key"
+ */
+void test2_script_get();
+/**
+ * @test Test getting a command out of the script
+ * @pre position == number of commands
+ * @post Output == NO_CMD
+ */
+void test3_script_get();
+/**
+ * @test Test getting a command from no script
+ * @pre pointer to script = NULL
+ * @post Output == NO_CMD
+ */
+void test4_script_get();
+
+/**
+ * @test Test getting the number of commands of no script
+ * @pre pointer to script = NULL
+ * @post Output == -1
+ */
+void test1_script_get_count();
+
+#endif
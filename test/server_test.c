@@ -0,0 +1,234 @@
+/**
+ * @brief It tests the server
+ *
+ * The server is run as a child process and the tests are its clients.
+ *
+ * @file server_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "server_test.h"
+#include "test.h"
+
+#define MAX_TESTS 3                          /*!< It defines the maximun tests in this file */
+#define SOCKET_PATH "/tmp/server_test.sock"  /*!< Socket of the server tested */
+#define MAP_FILE "map.dat"                   /*!< Map played */
+#define N_PIPELINED 1000                     /*!< Commands sent at once */
+#define SESSION_OUT 8192                     /*!< Reply bytes a session keeps, SERVER_OUT in server.c */
+#define WAIT_MS 5000                         /*!< Longest wait for a reply */
+
+/*Private functions*/
+pid_t server_test_start();
+int server_test_connect();
+int server_test_replies(int fd, int want, long *bytes, char *first);
+
+/**
+ * @brief Main function for server unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1, i;
+  pid_t server;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module server:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  server = server_test_start();
+
+  i = 1;
+  if (all || test == i) test1_server_pipeline();
+  i++;
+  if (all || test == i) test2_server_pipeline();
+  i++;
+  if (all || test == i) test1_server_save();
+
+  if (server > 0)
+  {
+    kill(server, SIGTERM);
+    waitpid(server, NULL, 0);
+  }
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/**
+ * @brief Runs the server in a child process
+ *
+ * @return pid of the server, or -1 if it could not be run
+ */
+pid_t server_test_start()
+{
+  pid_t pid;
+  int null;
+
+  unlink(SOCKET_PATH);
+  pid = fork();
+  if (pid == 0)
+  {
+    null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    execl("./server", "server", MAP_FILE, "-u", SOCKET_PATH, (char *)NULL);
+    _exit(1);
+  }
+
+  return pid;
+}
+
+/**
+ * @brief Connects to the server, waiting for it to listen
+ *
+ * @return the socket, or -1 if the server is not there
+ */
+int server_test_connect()
+{
+  struct sockaddr_un addr;
+  int fd, i;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, SOCKET_PATH);
+
+  for (i = 0; i < 100; i++)
+  {
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+      return fd;
+    }
+    close(fd);
+    usleep(20000);
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Reads replies from the server
+ *
+ * @param fd socket
+ * @param want replies to read, it stops before if the server closes or is too slow
+ * @param bytes where the bytes read are returned
+ * @param first where the first reply is returned, NULL if not needed
+ * @return number of replies read
+ */
+int server_test_replies(int fd, int want, long *bytes, char *first)
+{
+  struct pollfd p;
+  char buf[4096];
+  int n, i, lines = 0;
+
+  *bytes = 0;
+  p.fd = fd;
+  p.events = POLLIN;
+  while (lines < want && poll(&p, 1, WAIT_MS) > 0)
+  {
+    n = read(fd, buf, sizeof(buf));
+    if (n <= 0)
+    {
+      break;
+    }
+    if (first && *bytes == 0)
+    {
+      memcpy(first, buf, n < 64 ? n : 63);
+      first[n < 64 ? n : 63] = '\0';
+    }
+    *bytes += n;
+    for (i = 0; i < n; i++)
+    {
+      lines += (buf[i] == '\n') ? 1 : 0;
+    }
+  }
+
+  return lines;
+}
+
+void test1_server_pipeline()
+{
+  char cmds[4 * N_PIPELINED + 1] = "";
+  long bytes = 0;
+  int fd, i, lines = 0;
+
+  fd = server_test_connect();
+  for (i = 0; i < N_PIPELINED; i++)
+  {
+    strcat(cmds, "m s\n");
+  }
+  if (fd >= 0 && write(fd, cmds, strlen(cmds)) == (int)strlen(cmds))
+  {
+    lines = server_test_replies(fd, N_PIPELINED, &bytes, NULL);
+  }
+  PRINT_TEST_RESULT(lines == N_PIPELINED && bytes > SESSION_OUT);
+  close(fd);
+}
+
+void test2_server_pipeline()
+{
+  char cmds[4 * N_PIPELINED + 1] = "";
+  long bytes = 0;
+  int fd, i, lines = 0;
+
+  fd = server_test_connect();
+  for (i = 0; i < N_PIPELINED; i++)
+  {
+    strcat(cmds, "m n\n");
+  }
+  if (fd >= 0 && write(fd, cmds, strlen(cmds)) == (int)strlen(cmds) && shutdown(fd, SHUT_WR) == 0)
+  {
+    /* One more than sent, so it only stops when the server closes */
+    lines = server_test_replies(fd, N_PIPELINED + 1, &bytes, NULL);
+  }
+  PRINT_TEST_RESULT(lines == N_PIPELINED && bytes > SESSION_OUT);
+  close(fd);
+}
+
+void test1_server_save()
+{
+  char first[64] = "";
+  long bytes = 0;
+  int fd, lines = 0;
+
+  fd = server_test_connect();
+  if (fd >= 0 && write(fd, "save x\n", 7) == 7)
+  {
+    lines = server_test_replies(fd, 1, &bytes, first);
+  }
+  PRINT_TEST_RESULT(lines == 1 && strncmp(first, "ERROR|", 6) == 0);
+  close(fd);
+}
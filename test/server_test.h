@@ -0,0 +1,34 @@
+/** 
+ * @brief It declares the tests for the server
+ * 
+ * @file server_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SERVER_TEST_H
+#define SERVER_TEST_H
+
+/**
+ * @test Test pipelining commands
+ * @pre many commands sent at once, their replies do not fit in the session buffer
+ * @post Output == a reply for every command, the session stays open
+ */
+void test1_server_pipeline();
+/**
+ * @test Test pipelining commands and closing
+ * @pre many commands sent at once, then the client closes its side
+ * @post Output == a reply for every command before the session is closed
+ */
+void test2_server_pipeline();
+
+/**
+ * @test Test saving in the server
+ * @pre save command
+ * @post Output == ERROR reply
+ */
+void test1_server_save();
+
+#endif
@@ -15,7 +15,7 @@
 #include "space_test.h"
 #include "test.h"
 
-#define MAX_TESTS 46 /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 54 /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for SPACE unit tests.
@@ -170,6 +170,24 @@ int main(int argc, char **argv)
   if (all || test == i) test2_space_get_floor();
   i++;
 
+  if (all || test == i) test1_space_set_light_fixed();
+  i++;
+  if (all || test == i) test2_space_set_light_fixed();
+  i++;
+  if (all || test == i) test1_space_get_light_fixed();
+  i++;
+  if (all || test == i) test2_space_get_light_fixed();
+  i++;
+
+  if (all || test == i) test1_space_set_light_sources();
+  i++;
+  if (all || test == i) test2_space_set_light_sources();
+  i++;
+  if (all || test == i) test1_space_get_light_sources();
+  i++;
+  if (all || test == i) test2_space_get_light_sources();
+  i++;
+
 
   PRINT_PASSED_PERCENTAGE;
 
@@ -574,3 +592,67 @@ void test2_space_get_floor()
   Space *s = NULL;
   PRINT_TEST_RESULT(space_get_floor(s) == UNKNOWN_FLOOR);
 }
+
+/* space_set_light_fixed*/
+void test1_space_set_light_fixed()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_set_light_fixed(s, TRUE) == OK);
+  space_destroy(s);
+}
+void test2_space_set_light_fixed()
+{
+  Space *s = NULL;
+  PRINT_TEST_RESULT(space_set_light_fixed(s, TRUE) == ERROR);
+}
+
+/* space_get_light_fixed*/
+void test1_space_get_light_fixed()
+{
+  Space *s;
+  s = space_create(5);
+  space_set_light_fixed(s, TRUE);
+  PRINT_TEST_RESULT(space_get_light_fixed(s) == TRUE);
+  space_destroy(s);
+}
+void test2_space_get_light_fixed()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_get_light_fixed(s) == FALSE);
+  space_destroy(s);
+}
+
+/* space_set_light_sources*/
+void test1_space_set_light_sources()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_set_light_sources(s, 2) == OK);
+  space_destroy(s);
+}
+void test2_space_set_light_sources()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_set_light_sources(s, -1) == ERROR);
+  space_destroy(s);
+}
+
+/* space_get_light_sources*/
+void test1_space_get_light_sources()
+{
+  Space *s;
+  s = space_create(5);
+  space_set_light_sources(s, 2);
+  PRINT_TEST_RESULT(space_get_light_sources(s) == 2);
+  space_destroy(s);
+}
+void test2_space_get_light_sources()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_get_light_sources(s) == 0);
+  space_destroy(s);
+}
@@ -391,4 +391,56 @@ void test1_space_get_floor();
  */
 void test2_space_get_floor();
 
+/**
+ * @test Test function for setting if day and night change the light
+ * @pre pointer to space != NULL
+ * @post Output==OK
+ */
+void test1_space_set_light_fixed();
+/**
+ * @test Test function for setting if day and night change the light
+ * @pre pointer to space = NULL
+ * @post Output==ERROR
+ */
+void test2_space_set_light_fixed();
+
+/**
+ * @test Test function for getting if day and night change the light
+ * @pre space with its light fixed
+ * @post Output==TRUE
+ */
+void test1_space_get_light_fixed();
+/**
+ * @test Test function for getting if day and night change the light
+ * @pre new space
+ * @post Output==FALSE
+ */
+void test2_space_get_light_fixed();
+
+/**
+ * @test Test function for setting the number of lit objects
+ * @pre pointer to space != NULL
+ * @post Output==OK
+ */
+void test1_space_set_light_sources();
+/**
+ * @test Test function for setting the number of lit objects
+ * @pre negative number
+ * @post Output==ERROR
+ */
+void test2_space_set_light_sources();
+
+/**
+ * @test Test function for getting the number of lit objects
+ * @pre space with 2 lit objects
+ * @post Output==2
+ */
+void test1_space_get_light_sources();
+/**
+ * @test Test function for getting the number of lit objects
+ * @pre new space
+ * @post Output==0
+ */
+void test2_space_get_light_sources();
+
 #endif
@@ -0,0 +1,182 @@
+/**
+ * @brief It tests tile module
+ *
+ * @file tile_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tile.h"
+#include "game_fixture.h"
+#include "tile_test.h"
+#include "test.h"
+
+#define MAX_TESTS 10       /*!< It defines the maximun tests in this file */
+#define MAP_FILE "map.dat" /*!< Map used by the tests */
+
+static View view; /*!< View of a new game */
+
+/**
+ * @brief Main function for tile unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  Game *game = NULL;
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module tile:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  game = game_fixture_load(MAP_FILE);
+  if (!game)
+  {
+    printf("Error: can not load %s\n", MAP_FILE);
+    exit(EXIT_FAILURE);
+  }
+  view_model_build(&view, game, 1);
+  game_destroy(game);
+
+  if (all || test == 1) test1_tile_cache_create();
+  if (all || test == 2) test1_tile_cache_destroy();
+  if (all || test == 3) test1_tile_cache_get();
+  if (all || test == 4) test2_tile_cache_get();
+  if (all || test == 5) test3_tile_cache_get();
+  if (all || test == 6) test4_tile_cache_get();
+  if (all || test == 7) test5_tile_cache_get();
+  if (all || test == 8) test6_tile_cache_get();
+  if (all || test == 9) test1_tile_cache_clear();
+  if (all || test == 10) test1_tile_get_row();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_tile_cache_create()
+{
+  Tile_cache *tc = NULL;
+
+  tc = tile_cache_create();
+  PRINT_TEST_RESULT(tc != NULL && tile_cache_get_misses(tc) == 0);
+  tile_cache_destroy(tc);
+}
+
+void test1_tile_cache_destroy()
+{
+  PRINT_TEST_RESULT(tile_cache_destroy(NULL) == ERROR);
+}
+
+void test1_tile_cache_get()
+{
+  PRINT_TEST_RESULT(tile_cache_get(NULL, &view, V_ACT) == NULL);
+}
+
+void test2_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+
+  tc = tile_cache_create();
+  PRINT_TEST_RESULT(tile_cache_get(tc, &view, V_NORTH) == NULL);
+  tile_cache_destroy(tc);
+}
+
+void test3_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile *tile = NULL;
+
+  tc = tile_cache_create();
+  tile = tile_cache_get(tc, &view, V_ACT);
+  PRINT_TEST_RESULT(tile_get_rows(tile) == TILE_ROWS && strcmp(tile_get_row(tile, 0), "+-----------------+") == 0 &&
+                    strcmp(tile_get_row(tile, 1), "| Cell            |") == 0 &&
+                    strcmp(tile_get_row(tile, 2), "|           gpp0^ |") == 0 &&
+                    strncmp(tile_get_row(tile, 4), "|  <o>   ", 9) == 0 && strlen(tile_get_row(tile, 4)) == TILE_COLS);
+  tile_cache_destroy(tc);
+}
+
+void test4_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile *tile = NULL;
+
+  tc = tile_cache_create();
+  tile = tile_cache_get(tc, &view, V_SOUTH);
+  PRINT_TEST_RESULT(tile_get_rows(tile) == TILE_STUB_ROWS && strcmp(tile_get_row(tile, 0), "+-----------------+") == 0 &&
+                    strcmp(tile_get_row(tile, TILE_STUB_ROWS - 1), "|                 |") == 0);
+  tile_cache_destroy(tc);
+}
+
+void test5_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile *t1 = NULL, *t2 = NULL;
+
+  tc = tile_cache_create();
+  t1 = tile_cache_get(tc, &view, V_ACT);
+  t2 = tile_cache_get(tc, &view, V_ACT);
+  PRINT_TEST_RESULT(t1 != NULL && t1 == t2 && tile_cache_get_misses(tc) == 1);
+  tile_cache_destroy(tc);
+}
+
+void test6_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile *tile = NULL;
+  View changed;
+
+  tc = tile_cache_create();
+  tile_cache_get(tc, &view, V_ACT);
+  changed = view;
+  changed.space[V_ACT].object = view.space[V_ACT].object == TRUE ? FALSE : TRUE;
+  tile = tile_cache_get(tc, &changed, V_ACT);
+  PRINT_TEST_RESULT(tile_cache_get_misses(tc) == 2 &&
+                    tile_get_row(tile, TILE_ROWS - 2)[9] == (changed.space[V_ACT].object == TRUE ? '*' : ' '));
+  tile_cache_destroy(tc);
+}
+
+void test1_tile_cache_clear()
+{
+  Tile_cache *tc = NULL;
+
+  tc = tile_cache_create();
+  tile_cache_get(tc, &view, V_ACT);
+  tile_cache_clear(tc);
+  tile_cache_get(tc, &view, V_ACT);
+  PRINT_TEST_RESULT(tile_cache_get_misses(tc) == 2);
+  tile_cache_destroy(tc);
+}
+
+void test1_tile_get_row()
+{
+  Tile_cache *tc = NULL;
+  const Tile *tile = NULL;
+
+  tc = tile_cache_create();
+  tile = tile_cache_get(tc, &view, V_ACT);
+  PRINT_TEST_RESULT(tile_get_row(tile, TILE_ROWS) == NULL && tile_get_row(tile, -1) == NULL);
+  tile_cache_destroy(tc);
+}
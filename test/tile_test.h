@@ -0,0 +1,79 @@
+/** 
+ * @brief It declares the tests for the tile module
+ * 
+ * @file tile_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TILE_TEST_H
+#define TILE_TEST_H
+
+/**
+ * @test Test cache creation
+ * @pre none
+ * @post Output != NULL
+ */
+void test1_tile_cache_create();
+
+/**
+ * @test Test destroying no cache
+ * @pre pointer to cache = NULL
+ * @post Output == ERROR
+ */
+void test1_tile_cache_destroy();
+
+/**
+ * @test Test getting a tile from no cache
+ * @pre pointer to cache = NULL
+ * @post Output == NULL
+ */
+void test1_tile_cache_get();
+/**
+ * @test Test getting the tile of an empty slot
+ * @pre view of a new game, nothing to the north
+ * @post Output == NULL
+ */
+void test2_tile_cache_get();
+/**
+ * @test Test the tile of the current space
+ * @pre view of a new game, beggar in the cell
+ * @post box with the name, the player and the beggar
+ */
+void test3_tile_cache_get();
+/**
+ * @test Test the tile of the space to the south
+ * @pre view of a new game
+ * @post box without bottom border
+ */
+void test4_tile_cache_get();
+/**
+ * @test Test getting the same tile twice
+ * @pre view of a new game
+ * @post same tile, rendered once
+ */
+void test5_tile_cache_get();
+/**
+ * @test Test getting a tile whose object marker changed
+ * @pre view of a new game with the marker of the cell changed
+ * @post tile rendered again with the new marker
+ */
+void test6_tile_cache_get();
+
+/**
+ * @test Test getting a tile after clearing the cache
+ * @pre tile already in the cache
+ * @post tile rendered again
+ */
+void test1_tile_cache_clear();
+
+/**
+ * @test Test getting a row out of a tile
+ * @pre tile of the current space
+ * @post Output == NULL
+ */
+void test1_tile_get_row();
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @brief It tests trigger module
+ *
+ * @file trigger_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/trigger.h"
+#include "trigger_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for trigger unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module trigger:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_trigger_add();
+  if (all || test == 2) test2_trigger_add();
+  if (all || test == 3) test3_trigger_add();
+  if (all || test == 4) test1_trigger_find();
+  if (all || test == 5) test2_trigger_find();
+  if (all || test == 6) test3_trigger_find();
+  if (all || test == 7) test1_trigger_get_type();
+  if (all || test == 8) test1_trigger_get_type_byName();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_trigger_add()
+{
+  Triggers *t = trigger_create();
+
+  trigger_add(t, T_DEATH, 42, 399, 127);
+  trigger_add(t, T_BROKEN, 392, NO_ID, NO_ID);
+  trigger_add(t, T_LIGHT, 121, NO_ID, NO_ID);
+
+  PRINT_TEST_RESULT(trigger_get_count(t) == 3 && trigger_get_type(t, 0) == T_DEATH && trigger_get_subject(t, 0) == 42 &&
+                    trigger_get_object(t, 0) == 399 && trigger_get_space(t, 0) == 127 &&
+                    trigger_get_type(t, 1) == T_BROKEN && trigger_get_subject(t, 1) == 392 && trigger_get_object(t, 1) == NO_ID &&
+                    trigger_get_type(t, 2) == T_LIGHT && trigger_get_subject(t, 2) == 121);
+  trigger_destroy(t);
+}
+
+void test2_trigger_add()
+{
+  Triggers *t = trigger_create();
+
+  PRINT_TEST_RESULT(trigger_add(t, T_DEATH, 42, NO_ID, 127) == ERROR && trigger_add(t, T_BROKEN, 392, 399, 127) == ERROR &&
+                    trigger_add(t, T_LIGHT, NO_ID, NO_ID, NO_ID) == ERROR && trigger_add(t, T_NONE, 121, NO_ID, NO_ID) == ERROR &&
+                    trigger_add(NULL, T_LIGHT, 121, NO_ID, NO_ID) == ERROR && trigger_get_count(t) == 0);
+  trigger_destroy(t);
+}
+
+void test3_trigger_add()
+{
+  Triggers *t = trigger_create();
+  int i;
+
+  for (i = 0; i < MAX_TRIGGERS; i++)
+  {
+    trigger_add(t, T_LIGHT, 100 + i, NO_ID, NO_ID);
+  }
+
+  PRINT_TEST_RESULT(trigger_add(t, T_LIGHT, 1, NO_ID, NO_ID) == ERROR && trigger_get_count(t) == MAX_TRIGGERS);
+  trigger_destroy(t);
+}
+
+void test1_trigger_find()
+{
+  Triggers *t = trigger_create();
+  int first, second;
+
+  trigger_add(t, T_DEATH, 42, 399, 127);
+  trigger_add(t, T_DEATH, 43, 385, 126);
+  trigger_add(t, T_DEATH, 42, 300, 127);
+
+  first = trigger_find(t, T_DEATH, 42, 0);
+  second = trigger_find(t, T_DEATH, 42, first + 1);
+
+  PRINT_TEST_RESULT(first == 0 && second == 2 && trigger_find(t, T_DEATH, 42, second + 1) == -1 &&
+                    trigger_find(t, T_BROKEN, 42, 0) == -1);
+  trigger_destroy(t);
+}
+
+void test2_trigger_find()
+{
+  Triggers *t = trigger_create();
+
+  trigger_add(t, T_DEATH, 42, 399, 127);
+  trigger_add(t, T_LIGHT, 121, NO_ID, NO_ID);
+
+  PRINT_TEST_RESULT(trigger_find(t, T_NONE, NO_ID, 0) == 0 && trigger_find(t, T_NONE, NO_ID, 1) == 1 &&
+                    trigger_find(t, T_NONE, NO_ID, 2) == -1);
+  trigger_destroy(t);
+}
+
+void test3_trigger_find()
+{
+  PRINT_TEST_RESULT(trigger_find(NULL, T_DEATH, 42, 0) == -1);
+}
+
+void test1_trigger_get_type()
+{
+  Triggers *t = trigger_create();
+
+  trigger_add(t, T_LIGHT, 121, NO_ID, NO_ID);
+
+  PRINT_TEST_RESULT(trigger_get_type(t, 1) == T_NONE && trigger_get_subject(t, -1) == NO_ID &&
+                    trigger_get_object(t, 5) == NO_ID && trigger_get_space(NULL, 0) == NO_ID);
+  trigger_destroy(t);
+}
+
+void test1_trigger_get_type_byName()
+{
+  PRINT_TEST_RESULT(trigger_get_type_byName("death") == T_DEATH && trigger_get_type_byName("Broken") == T_BROKEN &&
+                    trigger_get_type_byName("light") == T_LIGHT && trigger_get_type_byName("fall") == T_NONE);
+}
@@ -0,0 +1,66 @@
+/** 
+ * @brief It declares the tests for the trigger module
+ * 
+ * @file trigger_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TRIGGER_TEST_H
+#define TRIGGER_TEST_H
+
+/**
+ * @test Test adding a trigger
+ * @pre a death, a broken and a light trigger
+ * @post 3 triggers with their fields
+ */
+void test1_trigger_add();
+/**
+ * @test Test adding a wrong trigger
+ * @pre death without object, broken with object, no subject, T_NONE
+ * @post Output == ERROR
+ */
+void test2_trigger_add();
+/**
+ * @test Test adding more triggers than fit
+ * @pre MAX_TRIGGERS + 1 triggers
+ * @post Output == ERROR for the last one
+ */
+void test3_trigger_add();
+
+/**
+ * @test Test finding the triggers of an element
+ * @pre two death triggers of enemy 42 with one of enemy 43 in between
+ * @post both are found, in order, and then -1
+ */
+void test1_trigger_find();
+/**
+ * @test Test finding the triggers of any element
+ * @pre type T_NONE and subject NO_ID
+ * @post every trigger is found
+ */
+void test2_trigger_find();
+/**
+ * @test Test finding in no triggers
+ * @pre triggers = NULL
+ * @post Output == -1
+ */
+void test3_trigger_find();
+
+/**
+ * @test Test getting the fields of a trigger that does not exist
+ * @pre trigger out of range
+ * @post T_NONE and NO_ID
+ */
+void test1_trigger_get_type();
+
+/**
+ * @test Test getting a type by its name
+ * @pre names of types and a wrong one
+ * @post the types, T_NONE for the wrong one
+ */
+void test1_trigger_get_type_byName();
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * @brief It tests view_model module
+ *
+ * @file view_model_test.c
+ * @author Ignacio Nunez
+ * @version 1.0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/view_model.h"
+#include "game_fixture.h"
+#include "view_model_test.h"
+#include "test.h"
+
+#define MAX_TESTS 13       /*!< It defines the maximun tests in this file */
+#define MAP_FILE "map.dat" /*!< Map used by the tests */
+
+static View view;  /*!< View built by the tests */
+static View view2; /*!< Second view built by the tests */
+
+
+/**
+ * @brief Main function for view_model unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ */
+int main(int argc, char **argv)
+{
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module view_model:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 || test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  if (all || test == 1) test1_view_model_build();
+  if (all || test == 2) test2_view_model_build();
+  if (all || test == 3) test3_view_model_build();
+  if (all || test == 4) test4_view_model_build();
+  if (all || test == 5) test5_view_model_build();
+  if (all || test == 6) test6_view_model_build();
+  if (all || test == 7) test7_view_model_build();
+  if (all || test == 8) test8_view_model_build();
+  if (all || test == 9) test1_view_model_build_turn();
+  if (all || test == 10) test9_view_model_build();
+  if (all || test == 11) test10_view_model_build();
+  if (all || test == 12) test1_view_model_changed();
+  if (all || test == 13) test2_view_model_changed();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_view_model_build()
+{
+  PRINT_TEST_RESULT(view_model_build(&view, NULL, 1) == ERROR);
+}
+
+void test2_view_model_build()
+{
+  Game *game = NULL;
+
+  game = game_fixture_load(MAP_FILE);
+  PRINT_TEST_RESULT(view_model_build(NULL, game, 1) == ERROR);
+  game_destroy(game);
+}
+
+void test3_view_model_build()
+{
+  Game *game = NULL;
+  STATUS st;
+
+  game = game_fixture_load(MAP_FILE);
+  st = view_model_build(&view, game, 1);
+  PRINT_TEST_RESULT(st == OK && view.space[V_ACT].id == 11 && strcmp(view.space[V_ACT].name, "Cell           ") == 0 &&
+                    view.space[V_SOUTH].id == 121 && view.open[S] == TRUE && view.space[V_NORTH].id == NO_ID &&
+                    view.space[V_EAST].id == NO_ID && view.space[V_WEST].id == NO_ID);
+  game_destroy(game);
+}
+
+void test4_view_model_build()
+{
+  Game *game = NULL;
+
+  game = game_fixture_load(MAP_FILE);
+  view_model_build(&view, game, 1);
+  PRINT_TEST_RESULT(view.n_closed == 1 && view.closed[0].direction == U && strcmp(view.closed[0].name, "Cell_u") == 0);
+  game_destroy(game);
+}
+
+void test5_view_model_build()
+{
+  Game *game = NULL;
+
+  game = game_fixture_load(MAP_FILE);
+  view_model_build(&view, game, 1);
+  PRINT_TEST_RESULT(view.enemy_here == TRUE && strcmp(view.enemy_gdesc[0], " <o>  ") == 0 && view.n_enemies == 7 &&
+                    strcmp(view.enemies[0].name, "Beggar") == 0 && view.enemies[0].location == 11);
+  game_destroy(game);
+}
+
+void test6_view_model_build()
+{
+  Game *game = NULL;
+
+  game = game_fixture_load(MAP_FILE);
+  view_model_build(&view, game, 1);
+  view_model_build(&view2, game, 1);
+  PRINT_TEST_RESULT(memcmp(&view, &view2, sizeof(View)) == 0);
+  game_destroy(game);
+}
+
+void test7_view_model_build()
+{
+  Game *game = NULL;
+  int st;
+
+  game = game_fixture_load(MAP_FILE);
+  st = game_update(game, TAKE, "Torch1", "");
+  view_model_build(&view, game, st);
+  PRINT_TEST_RESULT(view.st == 1 && view.last_cmd == TAKE && view.n_inventory == 1 &&
+                    strcmp(view.inventory[0], "Torch1") == 0 && view.n_dialogue == 1 &&
+                    strcmp(view.dialogue[0], "You picked Torch1") == 0);
+  game_destroy(game);
+}
+
+void test8_view_model_build()
+{
+  Game *game = NULL;
+  int st;
+
+  game = game_fixture_load(MAP_FILE);
+  st = game_update(game, MOVE, "s", "");
+  view_model_build(&view, game, st);
+  PRINT_TEST_RESULT(view.space[V_ACT].id == 121 && view.space[V_NORTH].id == 11 && view.space[V_EAST].id == 16 &&
+                    view.space[V_EAST].hidden == (view.time == DAY ? TRUE : FALSE));
+  game_destroy(game);
+}
+
+void test9_view_model_build()
+{
+  Game *game = NULL;
+  int i;
+  BOOL found = FALSE;
+
+  game = game_fixture_load(MAP_FILE);
+  view_model_build(&view, game, 1);
+  for (i = 0; i < view.n_cells; i++)
+  {
+    if (view.cells[i].id == 11)
+    {
+      found = (view.cells[i].next[S] == 121 && view.cells[i].next[N] == NO_ID && strcmp(view.cells[i].name, "Cell") == 0) ? TRUE : FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(view.floor == FLOOR_0 && view.n_cells == 9 && found == TRUE);
+  game_destroy(game);
+}
+
+void test1_view_model_build_turn()
+{
+  Game *game = NULL;
+  unsigned long epoch;
+  int st;
+
+  game = game_fixture_load(MAP_FILE);
+  game_set_seed(game, 1);
+  view_model_build(&view, game, 1);
+  epoch = game_get_epoch(game);
+  st = game_update(game, INSPECT, "Nothing", "");
+  view_model_build_turn(&view, game, st);
+  view_model_build(&view2, game, st);
+  PRINT_TEST_RESULT(game_get_epoch(game) == epoch && view.last_cmd == INSPECT && memcmp(&view, &view2, sizeof(View)) == 0);
+  game_destroy(game);
+}
+
+void test10_view_model_build()
+{
+  Game *game = NULL;
+  int i, st = 0;
+
+  game = game_fixture_load(MAP_FILE);
+  game_set_seed(game, 1);
+  game_update(game, TAKE, "Torch1", "");
+  for (i = 0; i < VIEW_LOG; i++)
+  {
+    st = game_update(game, MOVE, "w", "");
+  }
+  view_model_build(&view, game, st);
+  PRINT_TEST_RESULT(view.n_dialogue == VIEW_LOG && strcmp(view.dialogue[VIEW_LOG - 1], "You can't move West, you remain in the Cell") == 0 &&
+                    view.n_events >= 1);
+  game_destroy(game);
+}
+
+void test1_view_model_changed()
+{
+  Game *game = NULL;
+  BOOL map, descript, dialogue;
+
+  game = game_fixture_load(MAP_FILE);
+  game_set_seed(game, 1);
+  view_model_build(&view, game, 1);
+  game_destroy(game);
+
+  /* The first field of each area changes only that area */
+  memcpy(&view2, &view, sizeof(View));
+  view2.space[V_ACT].id = NO_ID;
+  map = view_model_changed(&view, &view2, VA_MAP) == TRUE && view_model_changed(&view, &view2, VA_DESCRIPT) == FALSE &&
+        view_model_changed(&view, &view2, VA_DIALOGUE) == FALSE;
+
+  memcpy(&view2, &view, sizeof(View));
+  view2.player_location = NO_ID;
+  descript = view_model_changed(&view, &view2, VA_MAP) == FALSE && view_model_changed(&view, &view2, VA_DESCRIPT) == TRUE &&
+             view_model_changed(&view, &view2, VA_DIALOGUE) == FALSE;
+
+  memcpy(&view2, &view, sizeof(View));
+  view2.n_dialogue++;
+  dialogue = view_model_changed(&view, &view2, VA_MAP) == FALSE && view_model_changed(&view, &view2, VA_DESCRIPT) == FALSE &&
+             view_model_changed(&view, &view2, VA_DIALOGUE) == TRUE;
+
+  PRINT_TEST_RESULT(map == TRUE && descript == TRUE && dialogue == TRUE);
+}
+
+void test2_view_model_changed()
+{
+  Game *game = NULL;
+  BOOL map, descript, dialogue, none;
+
+  game = game_fixture_load(MAP_FILE);
+  game_set_seed(game, 1);
+  view_model_build(&view, game, 1);
+  game_destroy(game);
+
+  /* The last field of each area changes only that area */
+  memcpy(&view2, &view, sizeof(View));
+  view2.cells[MAX_SPACES - 1].id = view.cells[MAX_SPACES - 1].id + 1;
+  map = view_model_changed(&view, &view2, VA_MAP) == TRUE && view_model_changed(&view, &view2, VA_DESCRIPT) == FALSE &&
+        view_model_changed(&view, &view2, VA_DIALOGUE) == FALSE;
+
+  memcpy(&view2, &view, sizeof(View));
+  view2.game_over = view.game_over == TRUE ? FALSE : TRUE;
+  descript = view_model_changed(&view, &view2, VA_MAP) == FALSE && view_model_changed(&view, &view2, VA_DESCRIPT) == TRUE &&
+             view_model_changed(&view, &view2, VA_DIALOGUE) == FALSE;
+
+  memcpy(&view2, &view, sizeof(View));
+  view2.events[VIEW_LOG - 1][VIEW_LOG_LEN - 1] = 'x';
+  dialogue = view_model_changed(&view, &view2, VA_MAP) == FALSE && view_model_changed(&view, &view2, VA_DESCRIPT) == FALSE &&
+             view_model_changed(&view, &view2, VA_DIALOGUE) == TRUE;
+
+  /* The last command is in no area */
+  memcpy(&view2, &view, sizeof(View));
+  view2.last_cmd = EXIT;
+  view2.st = 2;
+  none = view_model_changed(&view, &view2, VA_MAP) == FALSE && view_model_changed(&view, &view2, VA_DESCRIPT) == FALSE &&
+         view_model_changed(&view, &view2, VA_DIALOGUE) == FALSE;
+
+  PRINT_TEST_RESULT(map == TRUE && descript == TRUE && dialogue == TRUE && none == TRUE);
+}
@@ -0,0 +1,93 @@
+/** 
+ * @brief It declares the tests for the view_model module
+ * 
+ * @file view_model_test.h
+ * @author Ignacio Nunez
+ * @version 1.0 
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef VIEW_MODEL_TEST_H
+#define VIEW_MODEL_TEST_H
+
+/**
+ * @test Test building the view of no game
+ * @pre pointer to game = NULL
+ * @post Output == ERROR
+ */
+void test1_view_model_build();
+/**
+ * @test Test building a view into no view
+ * @pre pointer to view = NULL
+ * @post Output == ERROR
+ */
+void test2_view_model_build();
+/**
+ * @test Test the spaces of the view of a new game
+ * @pre game loaded, player in the cell
+ * @post cell in the middle with its padded name and the corridor to the south
+ */
+void test3_view_model_build();
+/**
+ * @test Test the closed links of the view of a new game
+ * @pre game loaded, player in the cell
+ * @post only the trapdoor up is listed
+ */
+void test4_view_model_build();
+/**
+ * @test Test the enemies of the view of a new game
+ * @pre game loaded, beggar in the cell
+ * @post beggar drawn in the cell and every enemy listed
+ */
+void test5_view_model_build();
+/**
+ * @test Test building the view of the same game twice
+ * @pre game loaded
+ * @post both views are equal byte by byte
+ */
+void test6_view_model_build();
+/**
+ * @test Test the view after taking an object
+ * @pre Torch1 taken
+ * @post Torch1 in the inventory and a dialogue line saying so
+ */
+void test7_view_model_build();
+/**
+ * @test Test the view after moving
+ * @pre player moved south to the corridor
+ * @post corridor in the middle, secret chamber to the east hidden by day
+ */
+void test8_view_model_build();
+/**
+ * @test Test the spaces of the floor of the player
+ * @pre game loaded
+ * @post the nine spaces of the first floor, the cell links south to the corridor
+ */
+void test9_view_model_build();
+/**
+ * @test Test the scrollback of the dialogue
+ * @pre Torch1 taken, then VIEW_LOG moves to the west
+ * @post VIEW_LOG dialogue lines, the newest one last, and at least one event line
+ */
+void test10_view_model_build();
+/**
+ * @test Test rebuilding only the turn of a view
+ * @pre view built, then a command that changes nothing in the game
+ * @post the epoch is the same and the view equals a full build
+ */
+void test1_view_model_build_turn();
+/**
+ * @test Test the areas of a view that changed
+ * @pre a built view and copies of it with the first field of one area changed
+ * @post each copy differs only in the area of that field
+ */
+void test1_view_model_changed();
+/**
+ * @test Test the areas of a view that changed
+ * @pre a built view and copies of it with the last field of one area changed, or the last command
+ * @post each copy differs only in the area of that field, and in none for the last command
+ */
+void test2_view_model_changed();
+
+#endif